@@ -0,0 +1,167 @@
+#include "abft.h"
+#include "../blocked_game/blocked_gemm.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Safety factor on the worst-case rounding bound of a checksum
+static const double kAbftSafety = 2.0;
+
+static int tiles(int len, int block_size) {
+    return (len + block_size - 1) / block_size;
+}
+
+// ============================================================================
+// ENCODE
+//
+// Ac(I, :) = sum of the rows of A in block row I      (tiles_m × k)
+// Bc(:, J) = sum of the columns of B in block col J   (k × tiles_n)
+// col = block column sums of C0 + Ac * B,  row = block row sums of C0 + A * Bc
+//
+// Every entry of A*B is a dot product of a row of A and a column of B, with
+// rounding error at most gamma * |a_i| |b_j| (Cauchy-Schwarz); the bound of
+// a checksum is the sum of the bounds of its entries.
+// ============================================================================
+AbftChecksums abft_encode(const Matrix& A, const Matrix& B, const Matrix& C, int block_size) {
+    const int m = A.m, k = A.n, n = B.n;
+    const int tm = tiles(m, block_size), tn = tiles(n, block_size);
+    AbftChecksums s;
+    s.m = m;
+    s.n = n;
+    s.block_size = block_size;
+
+    Matrix Ac(tm, k), Bc(k, tn);
+    std::vector<double> a_norm(m, 0.0), b_norm(n, 0.0);
+    for (int i = 0; i < m; i++) {
+        const double* a = &A.data[static_cast<size_t>(i) * k];
+        double* ac = &Ac.data[static_cast<size_t>(i / block_size) * k];
+        for (int p = 0; p < k; p++) {
+            ac[p] += a[p];
+            a_norm[i] += a[p] * a[p];
+        }
+    }
+    for (int p = 0; p < k; p++) {
+        const double* b = &B.data[static_cast<size_t>(p) * n];
+        for (int j = 0; j < n; j++) {
+            Bc(p, j / block_size) += b[j];
+            b_norm[j] += b[j] * b[j];
+        }
+    }
+    for (double& v : a_norm) v = std::sqrt(v);
+    for (double& v : b_norm) v = std::sqrt(v);
+
+    s.col = Matrix(tm, n);
+    s.row = Matrix(m, tn);
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) {
+            s.col(i / block_size, j) += C(i, j);
+            s.row(i, j / block_size) += C(i, j);
+        }
+    }
+    gemm_blocked(Ac, B, s.col, block_size);
+    gemm_blocked(A, Bc, s.row, block_size);
+
+    const double gamma =
+        kAbftSafety * std::numeric_limits<double>::epsilon() * (k + 2.0 * block_size);
+    std::vector<double> a_block(tm, 0.0), b_block(tn, 0.0);
+    for (int i = 0; i < m; i++) a_block[i / block_size] += a_norm[i];
+    for (int j = 0; j < n; j++) b_block[j / block_size] += b_norm[j];
+    s.col_tol = Matrix(tm, n);
+    s.row_tol = Matrix(m, tn);
+    for (int I = 0; I < tm; I++) {
+        for (int j = 0; j < n; j++) s.col_tol(I, j) = gamma * a_block[I] * b_norm[j];
+    }
+    for (int i = 0; i < m; i++) {
+        for (int J = 0; J < tn; J++) s.row_tol(i, J) = gamma * a_norm[i] * b_block[J];
+    }
+    return s;
+}
+
+// ============================================================================
+// CHECK: one tile at a time. The tolerance also covers rounding in summing
+// C itself, proportional to the magnitudes summed. A NaN or Inf discrepancy
+// is always a mismatch.
+// ============================================================================
+static bool mismatch(double d, double tol) {
+    return !std::isfinite(d) || std::abs(d) > tol;
+}
+
+bool abft_check(const AbftChecksums& s, Matrix& C, bool correct, AbftReport* report) {
+    const int bs = s.block_size;
+    const double eps_c = kAbftSafety * std::numeric_limits<double>::epsilon() * bs;
+    AbftReport local;
+    AbftReport& r = report ? *report : local;
+    r = AbftReport();
+
+    std::vector<double> col_sum(bs), col_mag(bs);
+    std::vector<int> bad_rows, bad_cols;
+    for (int ii = 0; ii < s.m; ii += bs) {
+        const int I = ii / bs, i_max = std::min(ii + bs, s.m);
+        for (int jj = 0; jj < s.n; jj += bs) {
+            const int J = jj / bs, j_max = std::min(jj + bs, s.n);
+            r.tiles++;
+
+            bad_rows.clear();
+            bad_cols.clear();
+            std::fill(col_sum.begin(), col_sum.end(), 0.0);
+            std::fill(col_mag.begin(), col_mag.end(), 0.0);
+            for (int i = ii; i < i_max; i++) {
+                const double* c = &C.data[static_cast<size_t>(i) * s.n];
+                double row_sum = 0.0, row_mag = 0.0;
+                for (int j = jj; j < j_max; j++) {
+                    row_sum += c[j];
+                    row_mag += std::abs(c[j]);
+                    col_sum[j - jj] += c[j];
+                    col_mag[j - jj] += std::abs(c[j]);
+                }
+                if (mismatch(row_sum - s.row(i, J), s.row_tol(i, J) + eps_c * row_mag)) {
+                    bad_rows.push_back(i);
+                }
+            }
+            for (int j = jj; j < j_max; j++) {
+                if (mismatch(col_sum[j - jj] - s.col(I, j),
+                             s.col_tol(I, j) + eps_c * col_mag[j - jj])) {
+                    bad_cols.push_back(j);
+                }
+            }
+            if (bad_rows.empty() && bad_cols.empty()) continue;
+
+            r.detected++;
+            AbftFault f;
+            f.tile_row = I;
+            f.tile_col = J;
+            if (bad_rows.size() == 1 && bad_cols.size() == 1) {
+                f.i = bad_rows[0];
+                f.j = bad_cols[0];
+                if (correct) {
+                    // C(i, j) = expected column sum - the other entries of the column
+                    double others = 0.0;
+                    for (int i = ii; i < i_max; i++) {
+                        if (i != f.i) others += C(i, f.j);
+                    }
+                    const double fixed = s.col(I, f.j) - others;
+                    f.error = C(f.i, f.j) - fixed;
+                    C(f.i, f.j) = fixed;
+
+                    double row_sum = 0.0, row_mag = 0.0;
+                    for (int j = jj; j < j_max; j++) {
+                        row_sum += C(f.i, j);
+                        row_mag += std::abs(C(f.i, j));
+                    }
+                    f.corrected = !mismatch(row_sum - s.row(f.i, J),
+                                            s.row_tol(f.i, J) + eps_c * row_mag);
+                }
+            }
+            if (f.corrected) r.corrected++;
+            else r.uncorrectable++;
+            r.faults.push_back(f);
+        }
+    }
+    return r.uncorrectable == 0;
+}
+
+bool gemm_abft(const Matrix& A, const Matrix& B, Matrix& C, int block_size, AbftReport* report) {
+    const AbftChecksums sums = abft_encode(A, B, C, block_size);
+    gemm_blocked(A, B, C, block_size);
+    return abft_check(sums, C, true, report);
+}
@@ -0,0 +1,65 @@
+#ifndef ABFT_H
+#define ABFT_H
+
+#include <vector>
+#include "../src/matrix_utils.h"
+
+// Algorithm-based fault tolerance for GEMM (Huang & Abraham, 1984)
+//
+// C is split into the block_size × block_size tiles of gemm_blocked. Before
+// the multiply, A gets one checksum row per block row (the sum of its rows)
+// and B one checksum column per block column. Multiplying those through
+// gives, for every tile, the expected column sums and row sums of
+// C0 + A*B. After the multiply each tile is summed again:
+//
+//   no mismatch                       tile is correct
+//   one bad row i and one bad col j   single error at (i, j), recomputed
+//                                     from the column checksum
+//   anything else                     detected, not correctable
+//
+// The checksum products cost 2/block_size of the multiply (3% at 64), and
+// the check is one O(mn) pass. Running the multiply twice costs 100%.
+//
+// Mismatches are measured against a rounding bound built from row norms of
+// A and column norms of B, so errors smaller than roundoff of the checksum
+// go unnoticed; they are also harmless at that size.
+
+// Expected checksums of C0 + A*B, tile by tile
+struct AbftChecksums {
+    int m = 0, n = 0, block_size = 0;
+    Matrix col = Matrix(0, 0);       // col(I, j) = sum over rows i of block row I of C(i, j)
+    Matrix row = Matrix(0, 0);       // row(i, J) = sum over cols j of block col J of C(i, j)
+    Matrix col_tol = Matrix(0, 0);   // rounding bound for each entry of col
+    Matrix row_tol = Matrix(0, 0);   // rounding bound for each entry of row
+};
+
+// One tile whose checksums disagreed. (i, j) is the located entry, or -1
+// when the tile had more than one bad row or column.
+struct AbftFault {
+    int tile_row = 0, tile_col = 0;
+    int i = -1, j = -1;
+    double error = 0.0;              // C(i, j) before minus after correction
+    bool corrected = false;
+};
+
+struct AbftReport {
+    int tiles = 0;
+    int detected = 0;
+    int corrected = 0;
+    int uncorrectable = 0;
+    std::vector<AbftFault> faults;
+};
+
+// Checksums of C + A*B for the current C, taken before the multiply
+AbftChecksums abft_encode(const Matrix& A, const Matrix& B, const Matrix& C, int block_size);
+
+// Compare C against the checksums tile by tile; with correct, single errors
+// are repaired in place. Returns true when C is consistent at the end.
+bool abft_check(const AbftChecksums& sums, Matrix& C, bool correct, AbftReport* report);
+
+// C += A*B by gemm_blocked, checked and corrected. Returns false if some
+// tile had an error that could not be corrected.
+bool gemm_abft(const Matrix& A, const Matrix& B, Matrix& C, int block_size,
+               AbftReport* report = nullptr);
+
+#endif // ABFT_H
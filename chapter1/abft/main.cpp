@@ -0,0 +1,136 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <cstring>
+#include <cstdint>
+#include <cstdlib>
+#include "abft.h"
+#include "../blocked_game/blocked_gemm.h"
+
+void print_row(const char* label, double ms, double baseline_ms) {
+    std::cout << "  " << std::left << std::setw(36) << label << std::right
+              << std::setw(10) << ms << " ms" << std::setw(9) << 100.0 * (ms / baseline_ms - 1.0)
+              << " % overhead\n";
+}
+
+// Flip one bit of x: the usual model of a silent data corruption
+double flip_bit(double x, int bit) {
+    uint64_t u;
+    std::memcpy(&u, &x, sizeof u);
+    u ^= uint64_t(1) << bit;
+    std::memcpy(&x, &u, sizeof u);
+    return x;
+}
+
+// Cost: plain multiply, ABFT, and the multiply run twice and compared
+void benchmark_size(int n, int block_size) {
+    Matrix A(n, n), B(n, n);
+    A.fill_random();
+    B.fill_random();
+    Timer timer;
+
+    std::cout << "Matrix size: " << n << "×" << n << " (block_size=" << block_size << ")\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    Matrix C(n, n);
+    timer.start();
+    gemm_blocked(A, B, C, block_size);
+    double t_plain = timer.elapsed_ms();
+
+    Matrix C_abft(n, n);
+    AbftReport report;
+    timer.start();
+    AbftChecksums sums = abft_encode(A, B, C_abft, block_size);
+    double t_encode = timer.elapsed_ms();
+    gemm_blocked(A, B, C_abft, block_size);
+    timer.start();
+    abft_check(sums, C_abft, true, &report);
+    double t_check = timer.elapsed_ms();
+
+    Matrix D(n, n);
+    timer.start();
+    gemm_blocked(A, B, D, block_size);
+    Matrix E(n, n);
+    gemm_blocked(A, B, E, block_size);
+    bool same = D.data == E.data;
+    double t_twice = timer.elapsed_ms();
+
+    print_row("gemm_blocked:", t_plain, t_plain);
+    print_row("ABFT (encode + gemm + check):", t_plain + t_encode + t_check, t_plain);
+    std::cout << "    encode " << t_encode << " ms, check " << t_check << " ms, "
+              << report.tiles << " tiles\n";
+    print_row("Run twice and compare:", t_twice, t_plain);
+    if (!same) std::cout << "    (the two runs differ!)\n";
+    std::cout << "\n";
+}
+
+// One bit flip in each of `faults` random tiles, grouped by which bits were hit
+void fault_campaign(int n, int block_size, int faults) {
+    Matrix A(n, n), B(n, n), C(n, n);
+    A.fill_random();
+    B.fill_random();
+    AbftChecksums sums = abft_encode(A, B, C, block_size);
+    gemm_blocked(A, B, C, block_size);
+    const Matrix clean = C;
+
+    std::mt19937 gen(12345);
+    const int tiles = (n + block_size - 1) / block_size;
+    struct Range { const char* label; int lo, hi; int injected = 0, detected = 0, corrected = 0; };
+    std::vector<Range> ranges = {{"mantissa bits 0-31", 0, 31}, {"mantissa bits 32-51", 32, 51},
+                                 {"exponent and sign", 52, 63}};
+
+    for (Range& r : ranges) {
+        for (int f = 0; f < faults; f++) {
+            Matrix X = clean;
+            // a random tile, a random entry in it, a random bit in the range
+            const int I = gen() % tiles, J = gen() % tiles;
+            const int i = std::min(n - 1, I * block_size + static_cast<int>(gen() % block_size));
+            const int j = std::min(n - 1, J * block_size + static_cast<int>(gen() % block_size));
+            const int bit = r.lo + static_cast<int>(gen() % (r.hi - r.lo + 1));
+            X(i, j) = flip_bit(X(i, j), bit);
+
+            AbftReport report;
+            abft_check(sums, X, true, &report);
+            r.injected++;
+            r.detected += report.detected;
+            r.corrected += report.corrected;
+        }
+    }
+
+    std::cout << "Bit flips, one per check, n=" << n << ":\n";
+    for (const Range& r : ranges) {
+        std::cout << "  " << std::left << std::setw(22) << r.label << std::right
+                  << std::setw(5) << r.injected << " injected" << std::setw(6) << r.detected
+                  << " detected" << std::setw(6) << r.corrected << " corrected\n";
+    }
+    std::cout << "\n";
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "================================================================\n";
+    std::cout << "ABFT GEMM BENCHMARK\n";
+    std::cout << "Checksum-carrying GEMM vs running the multiply twice\n";
+    std::cout << "================================================================\n\n";
+
+    std::vector<int> sizes = {500, 1000, 2000};
+    int block_size = 64;
+
+    // Usage: ./abft_bench [n] [block_size]
+    if (argc > 1) sizes = {atoi(argv[1])};
+    if (argc > 2) block_size = atoi(argv[2]);
+
+    for (int n : sizes) {
+        benchmark_size(n, block_size);
+    }
+    fault_campaign(500, block_size, 200);
+
+    std::cout << "What to look for:\n";
+    std::cout << "  • ABFT costs a few percent; running twice costs 100%\n";
+    std::cout << "  • Exponent and high mantissa flips are always caught and fixed\n";
+    std::cout << "  • Flips in the low mantissa bits change C by less than the\n";
+    std::cout << "    rounding error of the checksums and pass unnoticed\n";
+    std::cout << "Usage: " << argv[0] << " [n] [block_size]\n";
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+#include <iostream>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "abft.h"
+#include "../blocked_game/blocked_gemm.h"
+
+// A, B, C0 and the fault-free result of gemm_blocked
+struct Problem {
+    Matrix A, B, C0, clean;
+    Problem(int m, int k, int n, int bs) : A(m, k), B(k, n), C0(m, n), clean(m, n) {
+        A.fill_random();
+        B.fill_random();
+        C0.fill_random();
+        clean = C0;
+        gemm_blocked(A, B, clean, bs);
+    }
+};
+
+// No faults: no false alarms, and C is exactly what gemm_blocked computes,
+// for shapes that are not multiples of the block size and for large k
+bool test_clean() {
+    std::cout << "Testing fault-free products (no false alarms)... ";
+
+    const std::vector<std::vector<int>> shapes = {
+        {1, 1, 1}, {64, 64, 64}, {100, 37, 130}, {65, 3000, 70}, {300, 300, 300}};
+    for (const auto& s : shapes) {
+        Problem p(s[0], s[1], s[2], 64);
+        Matrix C = p.C0;
+        AbftReport report;
+        if (!gemm_abft(p.A, p.B, C, 64, &report) || report.detected != 0 ||
+            C.data != p.clean.data) {
+            std::cout << "FAILED (" << s[0] << "x" << s[1] << "x" << s[2] << ", "
+                      << report.detected << " false alarms)\n";
+            return false;
+        }
+        const int tiles = ((s[0] + 63) / 64) * ((s[2] + 63) / 64);
+        if (report.tiles != tiles) {
+            std::cout << "FAILED (" << report.tiles << " tiles checked)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// One corrupted entry in each of several tiles, including NaN and Inf, is
+// located and repaired
+bool test_single_errors() {
+    std::cout << "Testing single errors per tile are corrected... ";
+
+    const int bs = 32;
+    Problem p(150, 80, 120, bs);
+    AbftChecksums sums = abft_encode(p.A, p.B, p.C0, bs);
+    Matrix C = p.clean;
+
+    // Entry overwritten with value, or value added to it
+    struct Fault { int i, j; double value; bool add; };
+    const std::vector<Fault> faults = {
+        {0, 0, 1.0e3, false},
+        {40, 70, -0.5, false},
+        {149, 119, std::numeric_limits<double>::quiet_NaN(), false},
+        {100, 10, std::numeric_limits<double>::infinity(), false},
+        {65, 33, 1e-6, true},
+    };
+    for (const Fault& f : faults) {
+        C(f.i, f.j) = f.add ? C(f.i, f.j) + f.value : f.value;
+    }
+
+    AbftReport report;
+    bool ok = abft_check(sums, C, true, &report);
+    if (!ok || report.detected != static_cast<int>(faults.size()) ||
+        report.corrected != report.detected) {
+        std::cout << "FAILED (" << report.detected << " detected, " << report.corrected
+                  << " corrected)\n";
+        return false;
+    }
+    for (const AbftFault& f : report.faults) {
+        bool known = false;
+        for (const Fault& g : faults) known |= (f.i == g.i && f.j == g.j);
+        if (!known) {
+            std::cout << "FAILED (located (" << f.i << ", " << f.j << "))\n";
+            return false;
+        }
+    }
+    if (max_abs_diff(C, p.clean) > 1e-11) {
+        std::cout << "FAILED (corrected C off by " << max_abs_diff(C, p.clean) << ")\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Two errors in one tile are detected but not corrected; with correction
+// off, a single error is reported and C is left alone
+bool test_uncorrectable() {
+    std::cout << "Testing multiple errors and detect-only mode... ";
+
+    const int bs = 32;
+    Problem p(64, 50, 64, bs);
+    AbftChecksums sums = abft_encode(p.A, p.B, p.C0, bs);
+
+    Matrix C = p.clean;
+    C(3, 4) += 1.0;
+    C(10, 20) -= 2.0;
+    C(40, 40) += 5.0;        // alone in its tile: corrected
+    AbftReport report;
+    if (abft_check(sums, C, true, &report) || report.detected != 2 || report.corrected != 1 ||
+        report.uncorrectable != 1) {
+        std::cout << "FAILED (two errors in a tile)\n";
+        return false;
+    }
+    for (const AbftFault& f : report.faults) {
+        if (!f.corrected && (f.i != -1 || f.tile_row != 0 || f.tile_col != 0)) {
+            std::cout << "FAILED (uncorrectable fault located)\n";
+            return false;
+        }
+    }
+
+    Matrix D = p.clean;
+    D(5, 5) += 1.0;
+    Matrix corrupted = D;
+    if (abft_check(sums, D, false, &report) || report.detected != 1 ||
+        report.faults[0].i != 5 || report.faults[0].j != 5 || D.data != corrupted.data) {
+        std::cout << "FAILED (detect-only)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Errors far below the rounding of the checksums pass unnoticed; errors a
+// few orders above it are caught
+bool test_threshold() {
+    std::cout << "Testing detection threshold... ";
+
+    const int bs = 64;
+    Problem p(128, 500, 128, bs);
+    AbftChecksums sums = abft_encode(p.A, p.B, p.C0, bs);
+
+    Matrix C = p.clean;
+    C(7, 9) += 1e-14;
+    AbftReport report;
+    if (!abft_check(sums, C, true, &report) || report.detected != 0) {
+        std::cout << "FAILED (roundoff-sized change flagged)\n";
+        return false;
+    }
+
+    C = p.clean;
+    C(7, 9) += 1e-7;
+    if (!abft_check(sums, C, true, &report) || report.corrected != 1 ||
+        std::abs(C(7, 9) - p.clean(7, 9)) > 1e-10) {
+        std::cout << "FAILED (1e-7 error missed)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing ABFT GEMM\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_clean();
+    all_passed &= test_single_errors();
+    all_passed &= test_uncorrectable();
+    all_passed &= test_threshold();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -9,6 +9,11 @@ void gemm_ikj(const Matrix& A, const Matrix& B, Matrix& C);
 // Blocked version based on Golub & Van Loan Section 1.3.5
 void gemm_blocked(const Matrix& A, const Matrix& B, Matrix& C, int block_size);
 
+// Block kernel of gemm_blocked, for callers that choose their own blocks:
+// C(ii:i_max, jj:j_max) += A(ii:i_max, kk:k_max) * B(kk:k_max, jj:j_max)
+void inner_block_outer_loop(const Matrix& A, const Matrix& B, Matrix& C,
+                            int ii, int kk, int jj, int i_max, int j_max, int k_max);
+
 // Convenience wrappers for different block sizes
 void gemm_blocked_32(const Matrix& A, const Matrix& B, Matrix& C);
 void gemm_blocked_64(const Matrix& A, const Matrix& B, Matrix& C);
@@ -0,0 +1,140 @@
+#include "covariance.h"
+#include "../syrk/syrk.h"
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+CovarianceAccumulator::CovarianceAccumulator(int dim, int block_size)
+    : dim_(dim), block_size_(block_size), mean_(dim, 0.0), scatter_(dim, dim) {}
+
+void CovarianceAccumulator::add_outer(const std::vector<double>& delta, double weight) {
+    for (int i = 0; i < dim_; i++) {
+        const double w_i = weight * delta[i];
+        double* m_row = &scatter_(i, 0);
+        for (int j = 0; j <= i; j++) m_row[j] += w_i * delta[j];
+    }
+}
+
+// Tile edge of the transpose that forms the second SYRK operand
+static const int kTransposeTile = 32;
+
+// Resize M to rows×cols, keeping its allocation when it shrinks
+static void reshape(Matrix& M, int rows, int cols) {
+    M.m = rows;
+    M.n = cols;
+    M.data.resize(static_cast<size_t>(rows) * cols);
+}
+
+// ============================================================================
+// BATCH UPDATE: one pass for the batch mean, one writing the centered rows
+// into the workspace, one transposing them, then SYRK on the two operands.
+// The batch itself is only read.
+// ============================================================================
+void CovarianceAccumulator::add_batch(const Matrix& X) {
+    add_rows(X, 0, X.m);
+}
+
+void CovarianceAccumulator::add_rows(const Matrix& X, int r0, int rows) {
+    const int b = rows;
+    if (b == 0) return;
+
+    std::vector<double> batch_mean(dim_, 0.0);
+    for (int k = 0; k < b; k++) {
+        const double* x = &X(r0 + k, 0);
+        for (int j = 0; j < dim_; j++) batch_mean[j] += x[j];
+    }
+    for (auto& v : batch_mean) v /= b;
+
+    reshape(centered_, b, dim_);
+    for (int k = 0; k < b; k++) {
+        const double* x = &X(r0 + k, 0);
+        double* xc = &centered_(k, 0);
+        for (int j = 0; j < dim_; j++) xc[j] = x[j] - batch_mean[j];
+    }
+    reshape(centered_t_, dim_, b);
+    const int tb = kTransposeTile;
+    for (int kk = 0; kk < b; kk += tb) {
+        for (int jj = 0; jj < dim_; jj += tb) {
+            const int k_max = std::min(kk + tb, b), j_max = std::min(jj + tb, dim_);
+            for (int k = kk; k < k_max; k++) {
+                for (int j = jj; j < j_max; j++) centered_t_(j, k) = centered_(k, j);
+            }
+        }
+    }
+    // M += Xc^T * Xc, lower triangle
+    syrk_operands(centered_t_, centered_, scatter_, Triangle::Lower, block_size_);
+
+    if (count_ == 0) {
+        mean_ = batch_mean;
+        count_ = b;
+        return;
+    }
+    const double n = static_cast<double>(count_);
+    const double total = n + b;
+    std::vector<double> delta(dim_);
+    for (int j = 0; j < dim_; j++) delta[j] = batch_mean[j] - mean_[j];
+    add_outer(delta, n * b / total);
+    for (int j = 0; j < dim_; j++) mean_[j] += delta[j] * (b / total);
+    count_ += b;
+}
+
+void CovarianceAccumulator::merge(const CovarianceAccumulator& other) {
+    if (other.count_ == 0) return;
+    if (count_ == 0) {
+        count_ = other.count_;
+        mean_ = other.mean_;
+        scatter_ = other.scatter_;
+        return;
+    }
+    const double n = static_cast<double>(count_);
+    const double b = static_cast<double>(other.count_);
+    const double total = n + b;
+    std::vector<double> delta(dim_);
+    for (int j = 0; j < dim_; j++) delta[j] = other.mean_[j] - mean_[j];
+    for (size_t p = 0; p < scatter_.data.size(); p++) scatter_.data[p] += other.scatter_.data[p];
+    add_outer(delta, n * b / total);
+    for (int j = 0; j < dim_; j++) mean_[j] += delta[j] * (b / total);
+    count_ += other.count_;
+}
+
+Matrix CovarianceAccumulator::covariance(bool unbiased) const {
+    Matrix C = scatter_;
+    const double denom = static_cast<double>(unbiased ? count_ - 1 : count_);
+    if (denom > 0) {
+        for (auto& v : C.data) v /= denom;
+    }
+    symmetrize(C, Triangle::Lower);
+    return C;
+}
+
+// ============================================================================
+// PARALLEL DRIVER: static schedule over batches, one accumulator per thread
+// ============================================================================
+CovarianceAccumulator accumulate_rows(const Matrix& X, int batch_rows, int block_size) {
+    const int batches = (X.m + batch_rows - 1) / batch_rows;
+#ifdef _OPENMP
+    const int threads = omp_get_max_threads();
+#else
+    const int threads = 1;
+#endif
+    std::vector<CovarianceAccumulator> partial(threads, CovarianceAccumulator(X.n, block_size));
+
+    #pragma omp parallel num_threads(threads)
+    {
+#ifdef _OPENMP
+        CovarianceAccumulator& acc = partial[omp_get_thread_num()];
+#else
+        CovarianceAccumulator& acc = partial[0];
+#endif
+        #pragma omp for schedule(static)
+        for (int t = 0; t < batches; t++) {
+            const int r0 = t * batch_rows;
+            acc.add_rows(X, r0, std::min(batch_rows, X.m - r0));
+        }
+    }
+
+    for (int t = 1; t < threads; t++) partial[0].merge(partial[t]);
+    return partial[0];
+}
@@ -0,0 +1,67 @@
+#ifndef COVARIANCE_H
+#define COVARIANCE_H
+
+#include <vector>
+#include "../src/matrix_utils.h"
+
+// Streaming mean and covariance of observations arriving in row batches
+// Chan, Golub & LeVeque, "Algorithms for Computing the Sample Variance"
+// (1983), pairwise update; the scatter products go through chapter1/syrk.
+//
+// The accumulator keeps the count n, the mean mu and the scatter matrix
+//   M = sum_k (x_k - mu)(x_k - mu)^T          (lower triangle only)
+// A batch X (b rows) is centered on its own mean mu_b, so its scatter
+//   S_b = (X - 1 mu_b^T)^T (X - 1 mu_b^T)    (SYRK, lower triangle)
+// never forms the large sums of the one-pass formula sum x x^T - n mu mu^T,
+// which cancel catastrophically when |mu| >> std. Batches and partial
+// accumulators are combined by
+//   delta = mu_b - mu,   n' = n + b
+//   mu'   = mu + delta * b / n'
+//   M'    = M + S_b + delta delta^T * n b / n'
+// so merging per-thread accumulators is exact up to rounding, in any order.
+
+class CovarianceAccumulator {
+public:
+    explicit CovarianceAccumulator(int dim = 0, int block_size = 64);
+
+    // Add the rows of X (X.n == dim) as observations
+    void add_batch(const Matrix& X);
+
+    // Add rows r0 .. r0+rows-1 of X, without copying them out first
+    void add_rows(const Matrix& X, int r0, int rows);
+
+    // Absorb another accumulator of the same dimension
+    void merge(const CovarianceAccumulator& other);
+
+    int dim() const { return dim_; }
+    long long count() const { return count_; }
+    const std::vector<double>& mean() const { return mean_; }
+
+    // Scatter matrix M, lower triangle (the strict upper triangle is zero)
+    const Matrix& scatter() const { return scatter_; }
+
+    // Finalize: M / (n - 1) (unbiased) or M / n, both triangles filled.
+    // The accumulator is unchanged and can keep taking batches.
+    Matrix covariance(bool unbiased = true) const;
+
+private:
+    // M += delta delta^T * weight, lower triangle
+    void add_outer(const std::vector<double>& delta, double weight);
+
+    int dim_;
+    int block_size_;
+    long long count_ = 0;
+    std::vector<double> mean_;
+    Matrix scatter_;
+
+    // Centered batch and its transpose, the two SYRK operands; kept between
+    // batches so a stream of equal batches allocates nothing after the first
+    Matrix centered_ = Matrix(0, 0);
+    Matrix centered_t_ = Matrix(0, 0);
+};
+
+// Accumulate the rows of X in batches of batch_rows. With OpenMP each thread
+// feeds its own accumulator and the partials are merged in thread order.
+CovarianceAccumulator accumulate_rows(const Matrix& X, int batch_rows, int block_size = 64);
+
+#endif // COVARIANCE_H
@@ -0,0 +1,179 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "covariance.h"
+#include "../blocked_game/blocked_gemm.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Two-pass reference on the materialized data: mean, then Xc^T Xc / (n-1)
+Matrix reference_covariance(const Matrix& X, std::vector<double>& mean) {
+    const int n = X.m, d = X.n;
+    mean.assign(d, 0.0);
+    for (int k = 0; k < n; k++) {
+        for (int j = 0; j < d; j++) mean[j] += X(k, j);
+    }
+    for (auto& v : mean) v /= n;
+    Matrix Xc = X;
+    for (int k = 0; k < n; k++) {
+        for (int j = 0; j < d; j++) Xc(k, j) -= mean[j];
+    }
+    Matrix C(d, d);
+    gemm_ikj(Xc.transpose(), Xc, C);
+    for (auto& v : C.data) v /= (n - 1);
+    return C;
+}
+
+// Observations with a large common offset: the regime where the one-pass
+// formula sum x x^T - n mu mu^T loses all its digits
+Matrix offset_data(int n, int d, double offset) {
+    Matrix X(n, d);
+    X.fill_random();
+    for (int k = 0; k < n; k++) {
+        for (int j = 0; j < d; j++) X(k, j) += offset + 0.5 * X(k, (j + 1) % d);
+    }
+    return X;
+}
+
+double max_rel_diff(const Matrix& A, const Matrix& B) {
+    double d = 0.0, scale = 0.0;
+    for (size_t i = 0; i < A.data.size(); i++) {
+        d = std::max(d, std::abs(A.data[i] - B.data[i]));
+        scale = std::max(scale, std::abs(B.data[i]));
+    }
+    return d / scale;
+}
+
+bool test_batches() {
+    std::cout << "Testing batched accumulation against two-pass covariance... ";
+
+    const int n = 1000, d = 37;
+    Matrix X = offset_data(n, d, 3.0);
+    std::vector<double> mean_ref;
+    Matrix C_ref = reference_covariance(X, mean_ref);
+
+    // Batch sizes that do and do not divide n, down to single rows
+    for (int batch : {1, 7, 64, 333, 1000}) {
+        CovarianceAccumulator acc(d, 16), by_rows(d, 16);
+        for (int r0 = 0; r0 < n; r0 += batch) {
+            acc.add_batch(X.block(r0, 0, std::min(batch, n - r0), d));
+            by_rows.add_rows(X, r0, std::min(batch, n - r0));
+        }
+        // add_rows reads X in place, with the same arithmetic
+        if (by_rows.scatter().data != acc.scatter().data || by_rows.mean() != acc.mean()) {
+            std::cout << "FAILED (add_rows differs, batch=" << batch << ")\n";
+            return false;
+        }
+        double mean_err = 0.0;
+        for (int j = 0; j < d; j++) {
+            mean_err = std::max(mean_err, std::abs(acc.mean()[j] - mean_ref[j]));
+        }
+        if (acc.count() != n || mean_err > 1e-13 || max_rel_diff(acc.covariance(), C_ref) > 1e-12) {
+            std::cout << "FAILED (batch=" << batch << ")\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_merge_and_offset() {
+    std::cout << "Testing merges and a large mean offset... ";
+
+    const int n = 1200, d = 20;
+    Matrix X = offset_data(n, d, 1e8);
+    std::vector<double> mean_ref;
+    Matrix C_ref = reference_covariance(X, mean_ref);
+
+    // Three partial accumulators merged in two different orders
+    CovarianceAccumulator a(d), b(d), c(d);
+    a.add_batch(X.block(0, 0, 100, d));
+    b.add_batch(X.block(100, 0, 700, d));
+    c.add_batch(X.block(800, 0, 400, d));
+    CovarianceAccumulator abc = a, cba = c;
+    abc.merge(b);
+    abc.merge(c);
+    cba.merge(b);
+    cba.merge(a);
+    CovarianceAccumulator empty(d);
+    cba.merge(empty);
+
+    // The one-pass formula on the same data, to show what is at stake
+    Matrix S(d, d);
+    gemm_ikj(X.transpose(), X, S);
+    Matrix C_naive(d, d);
+    for (int i = 0; i < d; i++) {
+        for (int j = 0; j < d; j++) {
+            C_naive(i, j) = (S(i, j) - n * mean_ref[i] * mean_ref[j]) / (n - 1);
+        }
+    }
+
+    double err_abc = max_rel_diff(abc.covariance(), C_ref);
+    double err_cba = max_rel_diff(cba.covariance(), C_ref);
+    double err_naive = max_rel_diff(C_naive, C_ref);
+    if (err_abc > 1e-7 || err_cba > 1e-7 || !(err_naive > 1e3 * err_abc)) {
+        std::cout << "FAILED (errors " << err_abc << ", " << err_cba << ", one-pass "
+                  << err_naive << ")\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Per-thread partial accumulators give the same result for any thread count
+bool test_thread_counts() {
+    std::cout << "Testing accumulate_rows over thread counts... ";
+
+    const int n = 3000, d = 50;
+    Matrix X = offset_data(n, d, 10.0);
+    std::vector<double> mean_ref;
+    Matrix C_ref = reference_covariance(X, mean_ref);
+
+    std::vector<int> thread_counts = {1};
+#ifdef _OPENMP
+    const int saved = omp_get_max_threads();
+    thread_counts = {1, 2, 3, 8};
+#endif
+    for (int threads : thread_counts) {
+#ifdef _OPENMP
+        omp_set_num_threads(threads);
+#endif
+        CovarianceAccumulator acc = accumulate_rows(X, 128);
+        if (acc.count() != n || max_rel_diff(acc.covariance(), C_ref) > 1e-12) {
+            std::cout << "FAILED (" << threads << " threads)\n";
+            return false;
+        }
+    }
+#ifdef _OPENMP
+    omp_set_num_threads(saved);
+#endif
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Streaming Covariance\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_batches();
+    all_passed &= test_merge_and_offset();
+    all_passed &= test_thread_counts();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
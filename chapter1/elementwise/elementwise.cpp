@@ -0,0 +1,165 @@
+#include "elementwise.h"
+#include "../src/span_ops.h"
+#include <algorithm>
+
+static void resize_like(const Matrix& X, Matrix& out) {
+    if (out.m != X.m || out.n != X.n) out = Matrix(X.m, X.n);
+}
+
+static long num_chunks(size_t size) {
+    return static_cast<long>((size + kElementwiseChunk - 1) / kElementwiseChunk);
+}
+
+static int chunk_len(size_t size, size_t offset) {
+    return static_cast<int>(std::min<size_t>(kElementwiseChunk, size - offset));
+}
+
+// ============================================================================
+// MAP / ZIP: one call of f per chunk, chunks split over threads
+// ============================================================================
+void elementwise_map(const Matrix& X, Matrix& out, const MapKernel& f) {
+    resize_like(X, out);
+    const size_t size = X.data.size();
+    const double* x = X.data.data();
+    double* o = out.data.data();
+
+    #pragma omp parallel for schedule(static)
+    for (long t = 0; t < num_chunks(size); t++) {
+        const size_t off = static_cast<size_t>(t) * kElementwiseChunk;
+        f(x + off, o + off, chunk_len(size, off));
+    }
+}
+
+void elementwise_zip2(const Matrix& X, const Matrix& Y, Matrix& out, const Zip2Kernel& f) {
+    resize_like(X, out);
+    const size_t size = X.data.size();
+    const double* x = X.data.data();
+    const double* y = Y.data.data();
+    double* o = out.data.data();
+
+    #pragma omp parallel for schedule(static)
+    for (long t = 0; t < num_chunks(size); t++) {
+        const size_t off = static_cast<size_t>(t) * kElementwiseChunk;
+        f(x + off, y + off, o + off, chunk_len(size, off));
+    }
+}
+
+void elementwise_zip3(const Matrix& X, const Matrix& Y, const Matrix& Z, Matrix& out,
+                      const Zip3Kernel& f) {
+    resize_like(X, out);
+    const size_t size = X.data.size();
+    const double* x = X.data.data();
+    const double* y = Y.data.data();
+    const double* z = Z.data.data();
+    double* o = out.data.data();
+
+    #pragma omp parallel for schedule(static)
+    for (long t = 0; t < num_chunks(size); t++) {
+        const size_t off = static_cast<size_t>(t) * kElementwiseChunk;
+        f(x + off, y + off, z + off, o + off, chunk_len(size, off));
+    }
+}
+
+// ============================================================================
+// PIPELINE STAGES: one pass of run_stage over a chunk per stage, while the
+// chunk is in L1. Scale, shift and clamp are the loops of src/span_ops.h.
+// ============================================================================
+ElementwisePipeline& ElementwisePipeline::scale(double alpha) {
+    stages_.push_back({Kind::Scale, alpha});
+    return *this;
+}
+
+ElementwisePipeline& ElementwisePipeline::shift(double beta) {
+    stages_.push_back({Kind::Shift, beta});
+    return *this;
+}
+
+ElementwisePipeline& ElementwisePipeline::clamp(double lo, double hi) {
+    stages_.push_back({Kind::Clamp, lo, hi});
+    return *this;
+}
+
+ElementwisePipeline& ElementwisePipeline::hadamard(const Matrix& Y) {
+    stages_.push_back({Kind::Hadamard, 0.0, 0.0, &Y});
+    return *this;
+}
+
+ElementwisePipeline& ElementwisePipeline::divide(const Matrix& Y) {
+    stages_.push_back({Kind::Divide, 0.0, 0.0, &Y});
+    return *this;
+}
+
+ElementwisePipeline& ElementwisePipeline::map(MapKernel f) {
+    stages_.push_back({Kind::Map, 0.0, 0.0, nullptr, std::move(f)});
+    return *this;
+}
+
+ElementwisePipeline& ElementwisePipeline::zip(const Matrix& Y, Zip2Kernel f) {
+    stages_.push_back({Kind::Zip, 0.0, 0.0, &Y, nullptr, std::move(f)});
+    return *this;
+}
+
+void ElementwisePipeline::run_stage(const Stage& s, double* c, size_t offset, int len) const {
+    // Locals, so the stores to c cannot alias the parameters and the
+    // loops vectorize
+    const double a = s.a, b = s.b;
+    const double* y = s.y ? s.y->data.data() + offset : nullptr;
+    switch (s.kind) {
+        case Kind::Scale:
+            scale_span(c, len, a);
+            break;
+        case Kind::Shift:
+            shift_span(c, len, a);
+            break;
+        case Kind::Clamp:
+            clamp_span(c, len, a, b);
+            break;
+        case Kind::Hadamard:
+            for (int k = 0; k < len; k++) c[k] *= y[k];
+            break;
+        case Kind::Divide:
+            for (int k = 0; k < len; k++) c[k] /= y[k];
+            break;
+        case Kind::Map:
+            s.map(c, c, len);
+            break;
+        case Kind::Zip:
+            s.zip(c, y, c, len);
+            break;
+    }
+}
+
+// ============================================================================
+// FUSED: copy a chunk of X into out (skipped when out is X), run every
+// stage on it, move on
+// ============================================================================
+void ElementwisePipeline::apply(const Matrix& X, Matrix& out) const {
+    resize_like(X, out);
+    const size_t size = X.data.size();
+    const double* x = X.data.data();
+    double* o = out.data.data();
+
+    #pragma omp parallel for schedule(static)
+    for (long t = 0; t < num_chunks(size); t++) {
+        const size_t off = static_cast<size_t>(t) * kElementwiseChunk;
+        const int len = chunk_len(size, off);
+        double* c = o + off;
+        if (c != x + off) std::copy(x + off, x + off + len, c);
+        for (const Stage& s : stages_) run_stage(s, c, off, len);
+    }
+}
+
+void ElementwisePipeline::apply_passes(const Matrix& X, Matrix& out) const {
+    resize_like(X, out);
+    const size_t size = X.data.size();
+    if (&out != &X) out.data = X.data;
+    double* o = out.data.data();
+
+    for (const Stage& s : stages_) {
+        #pragma omp parallel for schedule(static)
+        for (long t = 0; t < num_chunks(size); t++) {
+            const size_t off = static_cast<size_t>(t) * kElementwiseChunk;
+            run_stage(s, o + off, off, chunk_len(size, off));
+        }
+    }
+}
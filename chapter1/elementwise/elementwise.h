@@ -0,0 +1,81 @@
+#ifndef ELEMENTWISE_H
+#define ELEMENTWISE_H
+
+#include <functional>
+#include <vector>
+#include "../src/matrix_utils.h"
+
+// Fused elementwise kernels over Matrix
+//
+// Elementwise work is bandwidth bound: scale, shift, clamp, a Hadamard
+// product and a division written as five loops read and write the whole
+// matrix five times. Here every operation runs on chunks of kElementwiseChunk
+// contiguous entries (16 KB, resident in L1), and all stages of a pipeline
+// finish one chunk before the next is loaded, so the matrix goes through
+// memory once. Chunks are split over OpenMP threads.
+//
+// Functors act on spans, not single entries: they are called once per chunk
+// with raw pointers and write their own loop, which the compiler vectorizes,
+// and the std::function call is paid once per chunk. They must be safe to
+// call from several threads at once.
+
+const int kElementwiseChunk = 2048;
+
+// out[k] = f(x[k]) for k < len
+using MapKernel = std::function<void(const double* x, double* out, int len)>;
+using Zip2Kernel = std::function<void(const double* x, const double* y, double* out, int len)>;
+using Zip3Kernel = std::function<void(const double* x, const double* y, const double* z,
+                                      double* out, int len)>;
+
+// out = f(X), f(X, Y), f(X, Y, Z) entrywise. All operands have the shape of
+// X; out is resized if needed and may be one of the inputs.
+void elementwise_map(const Matrix& X, Matrix& out, const MapKernel& f);
+void elementwise_zip2(const Matrix& X, const Matrix& Y, Matrix& out, const Zip2Kernel& f);
+void elementwise_zip3(const Matrix& X, const Matrix& Y, const Matrix& Z, Matrix& out,
+                      const Zip3Kernel& f);
+
+// ============================================================================
+// A chain of elementwise stages applied in one pass:
+//
+//   ElementwisePipeline p;
+//   p.scale(1.0 / 255).shift(-0.5).hadamard(mask).divide(sigma).clamp(-3, 3);
+//   p.apply(X, out);
+//
+// Matrices passed to hadamard/divide/zip are held by reference and must have
+// the shape of X when apply() runs.
+// ============================================================================
+class ElementwisePipeline {
+public:
+    ElementwisePipeline& scale(double alpha);              // c = alpha * c
+    ElementwisePipeline& shift(double beta);               // c = c + beta
+    ElementwisePipeline& clamp(double lo, double hi);      // c = min(max(c, lo), hi)
+    ElementwisePipeline& hadamard(const Matrix& Y);        // c = c * y
+    ElementwisePipeline& divide(const Matrix& Y);          // c = c / y
+    ElementwisePipeline& map(MapKernel f);                 // c = f(c)
+    ElementwisePipeline& zip(const Matrix& Y, Zip2Kernel f);   // c = f(c, y)
+
+    int stages() const { return static_cast<int>(stages_.size()); }
+
+    // out = stages(X), fused; out is resized if needed and may be X
+    void apply(const Matrix& X, Matrix& out) const;
+
+    // The unfused reference: one full pass over out per stage
+    void apply_passes(const Matrix& X, Matrix& out) const;
+
+private:
+    enum class Kind { Scale, Shift, Clamp, Hadamard, Divide, Map, Zip };
+    struct Stage {
+        Kind kind;
+        double a = 0.0, b = 0.0;
+        const Matrix* y = nullptr;
+        MapKernel map = nullptr;
+        Zip2Kernel zip = nullptr;
+    };
+
+    // Stage s on c[0 .. len-1], the entries starting at flat index offset
+    void run_stage(const Stage& s, double* c, size_t offset, int len) const;
+
+    std::vector<Stage> stages_;
+};
+
+#endif // ELEMENTWISE_H
@@ -0,0 +1,106 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include "elementwise.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// bytes: the minimum traffic of the whole job (every operand read once,
+// out written once), so GB/s compares each variant against one pass
+void print_row(const char* label, double ms, double bytes, double baseline_ms) {
+    std::cout << "  " << std::left << std::setw(32) << label << std::right
+              << std::setw(10) << ms << " ms" << std::setw(10) << bytes / (ms * 1e6)
+              << " GB/s" << std::setw(9) << baseline_ms / ms << "x\n";
+}
+
+// Six-step preprocessing: scale, shift, mask, normalize, add bias, clamp
+void benchmark_size(int m, int n) {
+    Matrix X(m, n), mask(m, n), sigma(m, n), bias(m, n), out(m, n);
+    X.fill_random();
+    mask.fill_random();
+    sigma.fill_random();
+    bias.fill_random();
+    for (double& v : sigma.data) v = 1.5 + v;
+    const size_t size = X.data.size();
+    Timer timer;
+
+    std::cout << "Matrix size: " << m << "×" << n << " (" << 8.0 * size / 1e6
+              << " MB per operand)\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    // Today's path: one loop per step, each a full sweep over memory
+    timer.start();
+    for (size_t i = 0; i < size; i++) out.data[i] = 2.0 * X.data[i];
+    for (size_t i = 0; i < size; i++) out.data[i] -= 0.25;
+    for (size_t i = 0; i < size; i++) out.data[i] *= mask.data[i];
+    for (size_t i = 0; i < size; i++) out.data[i] /= sigma.data[i];
+    for (size_t i = 0; i < size; i++) out.data[i] += bias.data[i];
+    for (size_t i = 0; i < size; i++) out.data[i] = std::min(std::max(out.data[i], -1.0), 1.0);
+    double t_loops = timer.elapsed_ms();
+
+    ElementwisePipeline p;
+    p.scale(2.0).shift(-0.25).hadamard(mask).divide(sigma)
+     .zip(bias, [](const double* x, const double* y, double* o, int len) {
+         for (int k = 0; k < len; k++) o[k] = x[k] + y[k];
+     })
+     .clamp(-1.0, 1.0);
+
+    timer.start();
+    p.apply_passes(X, out);
+    double t_passes = timer.elapsed_ms();
+
+    timer.start();
+    p.apply(X, out);
+    double t_fused = timer.elapsed_ms();
+
+    // The bias and clamp folded into a single zip3 after the first four stages
+    // is not the point here; this is the hand-fused loop the pipeline should match
+    timer.start();
+    for (size_t i = 0; i < size; i++) {
+        double c = (2.0 * X.data[i] - 0.25) * mask.data[i] / sigma.data[i] + bias.data[i];
+        out.data[i] = std::min(std::max(c, -1.0), 1.0);
+    }
+    double t_hand = timer.elapsed_ms();
+
+    const double bytes = 5.0 * 8.0 * size;
+    print_row("Six loops (today):", t_loops, bytes, t_loops);
+    print_row("Pipeline, one pass per stage:", t_passes, bytes, t_loops);
+    print_row("Pipeline, fused:", t_fused, bytes, t_loops);
+    print_row("Hand-fused loop (serial):", t_hand, bytes, t_loops);
+    std::cout << "\n";
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "================================================================\n";
+    std::cout << "FUSED ELEMENTWISE BENCHMARK\n";
+    std::cout << "One loop per operation vs one chunked pass for the whole chain\n";
+    std::cout << "================================================================\n";
+#ifdef _OPENMP
+    std::cout << "Threads: " << omp_get_max_threads() << "\n\n";
+#else
+    std::cout << "Threads: 1 (compiled without -fopenmp)\n\n";
+#endif
+
+    std::vector<std::pair<int, int>> sizes = {{1000, 1000}, {4000, 4000}};
+
+    // Usage: ./elementwise_bench [m] [n]
+    if (argc > 2) sizes = {{atoi(argv[1]), atoi(argv[2])}};
+
+    for (auto [m, n] : sizes) {
+        benchmark_size(m, n);
+    }
+
+    std::cout << "What to look for:\n";
+    std::cout << "  • Once the operands outgrow the caches, six loops cost about six\n";
+    std::cout << "    sweeps over memory; the fused pipeline costs about one\n";
+    std::cout << "  • The fused pipeline should be close to the hand-fused loop: the\n";
+    std::cout << "    stages run back to back on a chunk that sits in L1\n";
+    std::cout << "  • GB/s counts the minimum traffic (four operands read, one written)\n";
+    std::cout << "Usage: " << argv[0] << " [m] [n]\n";
+
+    return 0;
+}
@@ -0,0 +1,232 @@
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "elementwise.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Shapes around the chunk size: empty, single entry, partial last chunk
+const std::vector<std::pair<int, int>> kShapes = {
+    {0, 0}, {1, 1}, {1, 2047}, {32, 64}, {33, 65}, {100, 300}};
+
+Matrix positive(int m, int n) {
+    Matrix Y(m, n);
+    Y.fill_random();
+    for (double& v : Y.data) v = 1.5 + v;
+    return Y;
+}
+
+bool same(const Matrix& A, const Matrix& B) {
+    return A.m == B.m && A.n == B.n && A.data == B.data;
+}
+
+// A preprocessing pipeline that uses every stage kind
+ElementwisePipeline make_pipeline(const Matrix& mask, const Matrix& sigma, const Matrix& bias) {
+    ElementwisePipeline p;
+    p.scale(2.0).shift(-0.25).hadamard(mask).divide(sigma)
+     .map([](const double* x, double* out, int len) {
+         for (int k = 0; k < len; k++) out[k] = x[k] * x[k] - x[k];
+     })
+     .zip(bias, [](const double* x, const double* y, double* out, int len) {
+         for (int k = 0; k < len; k++) out[k] = x[k] + 0.5 * y[k];
+     })
+     .clamp(-0.3, 0.4);
+    return p;
+}
+
+// map, zip2 and zip3 against entry-by-entry loops
+bool test_map_zip() {
+    std::cout << "Testing map/zip2/zip3 against scalar loops... ";
+
+    for (auto [m, n] : kShapes) {
+        Matrix X(m, n), Y(m, n), Z(m, n);
+        X.fill_random();
+        Y.fill_random();
+        Z.fill_random();
+
+        Matrix out(0, 0);
+        elementwise_map(X, out, [](const double* x, double* o, int len) {
+            for (int k = 0; k < len; k++) o[k] = std::exp(x[k]);
+        });
+        for (size_t i = 0; i < X.data.size(); i++) {
+            if (out.data[i] != std::exp(X.data[i])) {
+                std::cout << "FAILED (map, " << m << "×" << n << ")\n";
+                return false;
+            }
+        }
+
+        elementwise_zip2(X, Y, out, [](const double* x, const double* y, double* o, int len) {
+            for (int k = 0; k < len; k++) o[k] = x[k] * y[k] + 1.0;
+        });
+        for (size_t i = 0; i < X.data.size(); i++) {
+            if (out.data[i] != X.data[i] * Y.data[i] + 1.0) {
+                std::cout << "FAILED (zip2, " << m << "×" << n << ")\n";
+                return false;
+            }
+        }
+
+        elementwise_zip3(X, Y, Z, out,
+                         [](const double* x, const double* y, const double* z, double* o, int len) {
+            for (int k = 0; k < len; k++) o[k] = x[k] > 0.0 ? y[k] : z[k];
+        });
+        if (out.m != m || out.n != n) {
+            std::cout << "FAILED (output shape)\n";
+            return false;
+        }
+        for (size_t i = 0; i < X.data.size(); i++) {
+            if (out.data[i] != (X.data[i] > 0.0 ? Y.data[i] : Z.data[i])) {
+                std::cout << "FAILED (zip3, " << m << "×" << n << ")\n";
+                return false;
+            }
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// The fused pass runs the same operations in the same order per entry,
+// so it matches the stage-by-stage passes bit for bit
+bool test_fused_matches_passes() {
+    std::cout << "Testing fused pipeline against one pass per stage... ";
+
+    for (auto [m, n] : kShapes) {
+        Matrix X(m, n), bias(m, n);
+        X.fill_random();
+        bias.fill_random();
+        Matrix mask = positive(m, n), sigma = positive(m, n);
+        ElementwisePipeline p = make_pipeline(mask, sigma, bias);
+
+        Matrix fused(0, 0), passes(0, 0);
+        p.apply(X, fused);
+        p.apply_passes(X, passes);
+        if (!same(fused, passes)) {
+            std::cout << "FAILED (" << m << "×" << n << ")\n";
+            return false;
+        }
+        for (double v : fused.data) {
+            if (v < -0.3 || v > 0.4) {
+                std::cout << "FAILED (clamp not applied)\n";
+                return false;
+            }
+        }
+    }
+
+    // Spot check the stage semantics on one entry
+    Matrix X(1, 1), mask(1, 1), sigma(1, 1), bias(1, 1), out(0, 0);
+    X(0, 0) = 0.5;
+    mask(0, 0) = 0.8;
+    sigma(0, 0) = 2.0;
+    bias(0, 0) = 0.2;
+    make_pipeline(mask, sigma, bias).apply(X, out);
+    double c = (2.0 * 0.5 - 0.25) * 0.8 / 2.0;
+    c = c * c - c + 0.5 * 0.2;
+    c = std::min(std::max(c, -0.3), 0.4);
+    if (out(0, 0) != c) {
+        std::cout << "FAILED (got " << out(0, 0) << ", expected " << c << ")\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// out may be the input: the fused pass, the reference and map/zip all work in place
+bool test_in_place() {
+    std::cout << "Testing in-place application... ";
+
+    const int m = 77, n = 91;
+    Matrix X(m, n), bias(m, n);
+    X.fill_random();
+    bias.fill_random();
+    Matrix mask = positive(m, n), sigma = positive(m, n);
+    ElementwisePipeline p = make_pipeline(mask, sigma, bias);
+
+    Matrix expected(0, 0);
+    p.apply(X, expected);
+
+    Matrix A = X, B = X;
+    p.apply(A, A);
+    p.apply_passes(B, B);
+    if (!same(A, expected) || !same(B, expected)) {
+        std::cout << "FAILED (pipeline)\n";
+        return false;
+    }
+
+    Matrix C = X;
+    elementwise_zip2(C, bias, C, [](const double* x, const double* y, double* o, int len) {
+        for (int k = 0; k < len; k++) o[k] = x[k] - y[k];
+    });
+    for (size_t i = 0; i < X.data.size(); i++) {
+        if (C.data[i] != X.data[i] - bias.data[i]) {
+            std::cout << "FAILED (zip2)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Chunks are independent, so every thread count gives identical results
+bool test_thread_counts() {
+    std::cout << "Testing pipelines over thread counts... ";
+
+    const int m = 300, n = 257;
+    Matrix X(m, n), bias(m, n);
+    X.fill_random();
+    bias.fill_random();
+    Matrix mask = positive(m, n), sigma = positive(m, n);
+    ElementwisePipeline p = make_pipeline(mask, sigma, bias);
+
+    Matrix expected(0, 0);
+    p.apply_passes(X, expected);
+
+    std::vector<int> thread_counts = {1};
+#ifdef _OPENMP
+    const int saved = omp_get_max_threads();
+    thread_counts = {1, 2, 3, 8};
+#endif
+    for (int threads : thread_counts) {
+#ifdef _OPENMP
+        omp_set_num_threads(threads);
+#endif
+        Matrix out(0, 0);
+        p.apply(X, out);
+        if (!same(out, expected)) {
+            std::cout << "FAILED (" << threads << " threads)\n";
+            return false;
+        }
+    }
+#ifdef _OPENMP
+    omp_set_num_threads(saved);
+#endif
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Fused Elementwise Kernels\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_map_zip();
+    all_passed &= test_fused_matches_passes();
+    all_passed &= test_in_place();
+    all_passed &= test_thread_counts();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,394 @@
+#include "gemm_dispatch.h"
+#include "../blocked_game/blocked_gemm.h"
+#include "../src/dot.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// gemm() may run on several threads while the logger is replaced. Each call
+// takes a reference under the mutex and logs outside it, so a logger being
+// replaced stays alive until the calls using it return.
+static std::mutex g_logger_mutex;
+static std::shared_ptr<const GemmLogger> g_logger;
+
+const char* gemm_kernel_name(GemmKernel kernel) {
+    switch (kernel) {
+        case GemmKernel::Small:      return "small";
+        case GemmKernel::Ikj:        return "ikj";
+        case GemmKernel::Blocked:    return "blocked";
+        case GemmKernel::TallSkinny: return "tall-skinny";
+        case GemmKernel::Strassen:   return "strassen";
+        case GemmKernel::Parallel:   return "parallel";
+    }
+    return "?";
+}
+
+void set_gemm_logger(GemmLogger logger) {
+    std::shared_ptr<const GemmLogger> next;
+    if (logger) next = std::make_shared<const GemmLogger>(std::move(logger));
+    std::lock_guard<std::mutex> lock(g_logger_mutex);
+    g_logger.swap(next);
+}
+
+static int thread_budget(const GemmOptions& opts) {
+    if (opts.threads > 0) return opts.threads;
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+// ============================================================================
+// SMALL: acc holds row i of C for the whole k loop. Called with a literal
+// n, the cloned copy has fixed trip counts and acc lives in registers.
+// ============================================================================
+static inline void register_rows(const double* a, const double* b, double* c, int m, int k,
+                                 int n) {
+    for (int i = 0; i < m; i++) {
+        double acc[kSmallDim];
+        double* ci = c + static_cast<size_t>(i) * n;
+        const double* ai = a + static_cast<size_t>(i) * k;
+        for (int j = 0; j < n; j++) acc[j] = ci[j];
+        for (int p = 0; p < k; p++) {
+            const double s = ai[p];
+            const double* bp = b + static_cast<size_t>(p) * n;
+            for (int j = 0; j < n; j++) acc[j] += s * bp[j];
+        }
+        for (int j = 0; j < n; j++) ci[j] = acc[j];
+    }
+}
+
+void gemm_small(const Matrix& A, const Matrix& B, Matrix& C) {
+    const double* a = A.data.data();
+    const double* b = B.data.data();
+    double* c = C.data.data();
+    const int m = A.m, k = A.n;
+    if (B.n > kSmallDim) {
+        gemm_ikj(A, B, C);
+        return;
+    }
+    switch (B.n) {
+        case 1:  register_rows(a, b, c, m, k, 1); break;
+        case 2:  register_rows(a, b, c, m, k, 2); break;
+        case 3:  register_rows(a, b, c, m, k, 3); break;
+        case 4:  register_rows(a, b, c, m, k, 4); break;
+        case 8:  register_rows(a, b, c, m, k, 8); break;
+        default: register_rows(a, b, c, m, k, B.n); break;
+    }
+}
+
+// ============================================================================
+// TALL-SKINNY: C(i, j) += dot(A(i, :), B(:, j)) with B transposed once, so
+// both operands of every dot product are contiguous. kDotLanes partial sums
+// keep the dot product vectorized without reassociation flags.
+// ============================================================================
+const int kDotLanes = 16;
+
+void gemm_tall_skinny(const Matrix& A, const Matrix& B, Matrix& C, int threads) {
+    const Matrix Bt = B.transpose();
+    const int m = A.m, k = A.n, n = B.n;
+
+    #pragma omp parallel for schedule(static) num_threads(threads) if (threads > 1)
+    for (int i = 0; i < m; i++) {
+        const double* ai = A.data.data() + static_cast<size_t>(i) * k;
+        double* ci = C.data.data() + static_cast<size_t>(i) * n;
+        for (int j = 0; j < n; j++) {
+            ci[j] += dot_lanes<kDotLanes>(ai, Bt.data.data() + static_cast<size_t>(j) * k, k);
+        }
+    }
+}
+
+// ============================================================================
+// PARALLEL BLOCKED: the loops of gemm_blocked, block rows of C over threads
+// ============================================================================
+void gemm_blocked_parallel(const Matrix& A, const Matrix& B, Matrix& C, int block_size,
+                           int threads) {
+    const int m = A.m, r = A.n, n = B.n;
+    const int blocks = (m + block_size - 1) / block_size;
+
+    #pragma omp parallel for schedule(static) num_threads(threads)
+    for (int bi = 0; bi < blocks; bi++) {
+        const int ii = bi * block_size;
+        const int i_max = std::min(ii + block_size, m);
+        for (int jj = 0; jj < n; jj += block_size) {
+            const int j_max = std::min(jj + block_size, n);
+            for (int kk = 0; kk < r; kk += block_size) {
+                inner_block_outer_loop(A, B, C, ii, kk, jj, i_max, j_max,
+                                       std::min(kk + block_size, r));
+            }
+        }
+    }
+}
+
+// ============================================================================
+// STRASSEN
+//
+//   M1 = (A11 + A22)(B11 + B22)     C11 += M1 + M4 - M5 + M7
+//   M2 = (A21 + A22) B11            C12 += M3 + M5
+//   M3 = A11 (B12 - B22)            C21 += M2 + M4
+//   M4 = A22 (B21 - B11)            C22 += M1 - M2 + M3 + M6
+//   M5 = (A11 + A12) B22
+//   M6 = (A21 - A11)(B11 + B12)
+//   M7 = (A12 - A22)(B21 + B22)
+// ============================================================================
+static Matrix plus(const Matrix& X, const Matrix& Y, double sign) {
+    Matrix Z(X.m, X.n);
+    for (size_t i = 0; i < Z.data.size(); i++) Z.data[i] = X.data[i] + sign * Y.data[i];
+    return Z;
+}
+
+// C(r0 : r0+rows, c0 : c0+cols) += sum of sign_i * M_i(0 : rows, 0 : cols)
+static void add_into(Matrix& C, int r0, int c0, int rows, int cols,
+                     std::initializer_list<const Matrix*> terms,
+                     std::initializer_list<double> signs) {
+    for (int i = 0; i < rows; i++) {
+        double* ci = &C(r0 + i, c0);
+        auto s = signs.begin();
+        for (const Matrix* M : terms) {
+            const double* mi = &M->data[static_cast<size_t>(i) * M->n];
+            const double sign = *s++;
+            for (int j = 0; j < cols; j++) ci[j] += sign * mi[j];
+        }
+    }
+}
+
+void gemm_strassen(const Matrix& A, const Matrix& B, Matrix& C, int cutoff, int block_size) {
+    const int m = A.m, k = A.n, n = B.n;
+    if (std::min({m, k, n}) <= cutoff) {
+        gemm_blocked(A, B, C, block_size);
+        return;
+    }
+
+    if (m % 2 || k % 2 || n % 2) {
+        Matrix Ap(m + m % 2, k + k % 2), Bp(k + k % 2, n + n % 2), Cp(m + m % 2, n + n % 2);
+        Ap.set_block(0, 0, A);
+        Bp.set_block(0, 0, B);
+        gemm_strassen(Ap, Bp, Cp, cutoff, block_size);
+        add_into(C, 0, 0, m, n, {&Cp}, {1.0});
+        return;
+    }
+
+    const int hm = m / 2, hk = k / 2, hn = n / 2;
+    const Matrix A11 = A.block(0, 0, hm, hk), A12 = A.block(0, hk, hm, hk);
+    const Matrix A21 = A.block(hm, 0, hm, hk), A22 = A.block(hm, hk, hm, hk);
+    const Matrix B11 = B.block(0, 0, hk, hn), B12 = B.block(0, hn, hk, hn);
+    const Matrix B21 = B.block(hk, 0, hk, hn), B22 = B.block(hk, hn, hk, hn);
+
+    auto product = [&](const Matrix& X, const Matrix& Y) {
+        Matrix M(hm, hn);
+        gemm_strassen(X, Y, M, cutoff, block_size);
+        return M;
+    };
+    const Matrix M1 = product(plus(A11, A22, 1.0), plus(B11, B22, 1.0));
+    const Matrix M2 = product(plus(A21, A22, 1.0), B11);
+    const Matrix M3 = product(A11, plus(B12, B22, -1.0));
+    const Matrix M4 = product(A22, plus(B21, B11, -1.0));
+    const Matrix M5 = product(plus(A11, A12, 1.0), B22);
+    const Matrix M6 = product(plus(A21, A11, -1.0), plus(B11, B12, 1.0));
+    const Matrix M7 = product(plus(A12, A22, -1.0), plus(B21, B22, 1.0));
+
+    add_into(C, 0, 0, hm, hn, {&M1, &M4, &M5, &M7}, {1.0, 1.0, -1.0, 1.0});
+    add_into(C, 0, hn, hm, hn, {&M3, &M5}, {1.0, 1.0});
+    add_into(C, hm, 0, hm, hn, {&M2, &M4}, {1.0, 1.0});
+    add_into(C, hm, hn, hm, hn, {&M1, &M2, &M3, &M6}, {1.0, -1.0, 1.0, 1.0});
+}
+
+// ============================================================================
+// COST MODEL (nanoseconds; GFLOPS and GB/s are flops and bytes per ns)
+//
+// time = flops / rate + inner loop starts * loop_ns + memory bytes / bandwidth
+//
+// Memory bytes assume an operand is read once if it fits in the cache and
+// once per reuse otherwise, the re-reads coming from the last-level cache
+// when the operand fits there. Parallel kernels divide the compute term by the
+// threads that have work and pay one fork; bandwidth is shared.
+// ============================================================================
+// Nanoseconds per byte for re-reading an operand of the given size: from the
+// last-level cache if it fits there, from memory otherwise
+static double reread_ns_per_byte(double bytes, const GemmMachine& mc) {
+    return 1.0 / (bytes > mc.llc_bytes ? mc.bandwidth_gbs : mc.llc_gbs);
+}
+
+static double ikj_ns(double m, double k, double n, const GemmMachine& mc) {
+    const double b_bytes = 8.0 * k * n;
+    const double once = 8.0 * (m * k + 2.0 * m * n) + b_bytes;
+    const double reread = b_bytes > mc.cache_bytes ? (m - 1.0) * b_bytes : 0.0;
+    return 2.0 * m * k * n / mc.stream_gflops + m * k * mc.loop_ns +
+           once / mc.bandwidth_gbs + reread * reread_ns_per_byte(b_bytes, mc);
+}
+
+// Blocked: compute and memory separately, so the parallel kernel can split
+// the compute term only. A block row of A is reused across jj if it fits in
+// the cache; B is read once per block row unless it fits.
+static void blocked_ns(double m, double k, double n, int bs, const GemmMachine& mc,
+                       double& compute, double& memory) {
+    const double jb = std::ceil(n / bs), ib = std::ceil(m / bs);
+    compute = 2.0 * m * k * n / mc.stream_gflops + m * k * jb * mc.loop_ns;
+    const double a_bytes = 8.0 * m * k, b_bytes = 8.0 * k * n;
+    const double a_reads = 8.0 * bs * k > mc.cache_bytes ? jb - 1.0 : 0.0;
+    const double b_reads = b_bytes > mc.cache_bytes ? ib - 1.0 : 0.0;
+    memory = (a_bytes + b_bytes + 16.0 * m * n) / mc.bandwidth_gbs +
+             a_reads * a_bytes * reread_ns_per_byte(a_bytes, mc) +
+             b_reads * b_bytes * reread_ns_per_byte(b_bytes, mc);
+}
+
+static double small_ns(double m, double k, double n, const GemmMachine& mc) {
+    return 2.0 * m * k * n / mc.register_gflops + m * mc.loop_ns;
+}
+
+// Tall-skinny: one dot product per entry of C, B transposed once, A read once
+static double tall_skinny_ns(double m, double k, double n, const GemmMachine& mc) {
+    return 2.0 * m * k * n / mc.register_gflops + m * n * mc.loop_ns +
+           8.0 * (m * k + 2.0 * k * n + 2.0 * m * n) / mc.bandwidth_gbs;
+}
+
+static double strassen_ns(double m, double k, double n, int cutoff, int bs,
+                          const GemmMachine& mc) {
+    if (std::min({m, k, n}) <= cutoff) {
+        double compute, memory;
+        blocked_ns(m, k, n, bs, mc, compute, memory);
+        return compute + memory;
+    }
+    const double hm = std::ceil(m / 2), hk = std::ceil(k / 2), hn = std::ceil(n / 2);
+    // quadrant copies, ten operand sums, seven products, four updates of C
+    const double bytes = 8.0 * (3.5 * (m * k + k * n) + 4.0 * m * n);
+    return 7.0 * strassen_ns(hm, hk, hn, cutoff, bs, mc) + bytes / mc.add_gbs;
+}
+
+GemmDecision gemm_plan(int m, int k, int n, const GemmOptions& opts) {
+    const GemmMachine& mc = opts.machine;
+    const int threads = thread_budget(opts);
+    GemmDecision d;
+    d.m = m;
+    d.k = k;
+    d.n = n;
+    for (int i = 0; i < kGemmKernels; i++) d.candidates[i].kernel = static_cast<GemmKernel>(i);
+    const double M = m, K = k, N = n;
+
+    GemmCandidate& small = d.candidates[static_cast<int>(GemmKernel::Small)];
+    small.eligible = m <= kSmallDim && k <= kSmallDim && n <= kSmallDim;
+    small.predicted_ms = small_ns(M, K, N, mc) * 1e-6;
+
+    GemmCandidate& ikj = d.candidates[static_cast<int>(GemmKernel::Ikj)];
+    ikj.eligible = true;
+    ikj.predicted_ms = ikj_ns(M, K, N, mc) * 1e-6;
+
+    // Block size: the cheapest of 32, 64, 128 whose three tiles fit the cache
+    GemmCandidate& blocked = d.candidates[static_cast<int>(GemmKernel::Blocked)];
+    double best_compute = 0.0, best_memory = 0.0;
+    blocked.eligible = true;
+    for (int bs : {32, 64, 128}) {
+        if (3.0 * 8.0 * bs * bs > mc.cache_bytes && bs > 32) continue;
+        double compute, memory;
+        blocked_ns(M, K, N, bs, mc, compute, memory);
+        if (blocked.block_size == 0 || compute + memory < blocked.predicted_ms * 1e6) {
+            blocked.block_size = bs;
+            blocked.predicted_ms = (compute + memory) * 1e-6;
+            best_compute = compute;
+            best_memory = memory;
+        }
+    }
+
+    GemmCandidate& tall = d.candidates[static_cast<int>(GemmKernel::TallSkinny)];
+    tall.eligible = n <= kNarrowCols;
+    tall.threads = std::max(1, std::min(threads, (m + 63) / 64));
+    tall.predicted_ms = (tall_skinny_ns(M, K, N, mc) / tall.threads +
+                         (tall.threads > 1 ? mc.fork_us * 1e3 : 0.0)) * 1e-6;
+
+    GemmCandidate& strassen = d.candidates[static_cast<int>(GemmKernel::Strassen)];
+    strassen.eligible = opts.allow_strassen && std::min({m, k, n}) > opts.strassen_cutoff;
+    strassen.block_size = blocked.block_size;
+    strassen.predicted_ms =
+        strassen_ns(M, K, N, opts.strassen_cutoff, blocked.block_size, mc) * 1e-6;
+
+    // Parallel: block rows over threads, the busiest thread sets the time
+    GemmCandidate& parallel = d.candidates[static_cast<int>(GemmKernel::Parallel)];
+    const int row_blocks = (m + blocked.block_size - 1) / blocked.block_size;
+    parallel.threads = std::max(1, std::min(threads, row_blocks));
+    parallel.eligible = parallel.threads > 1;
+    parallel.block_size = blocked.block_size;
+    const double per_thread = std::ceil(static_cast<double>(row_blocks) / parallel.threads);
+    parallel.predicted_ms = (best_compute * per_thread / std::max(row_blocks, 1) + best_memory +
+                             mc.fork_us * 1e3) * 1e-6;
+
+    // Cheapest eligible candidate; ties go to the earlier kernel
+    bool found = false;
+    for (const GemmCandidate& c : d.candidates) {
+        if (c.eligible && (!found || c.predicted_ms < d.choice.predicted_ms)) {
+            d.choice = c;
+            found = true;
+        }
+    }
+    return d;
+}
+
+// ============================================================================
+// DISPATCH
+// ============================================================================
+void gemm_run(const GemmCandidate& c, const Matrix& A, const Matrix& B, Matrix& C,
+              const GemmOptions& opts) {
+    switch (c.kernel) {
+        case GemmKernel::Small:
+            gemm_small(A, B, C);
+            break;
+        case GemmKernel::Ikj:
+            gemm_ikj(A, B, C);
+            break;
+        case GemmKernel::Blocked:
+            gemm_blocked(A, B, C, c.block_size > 0 ? c.block_size : 64);
+            break;
+        case GemmKernel::TallSkinny:
+            gemm_tall_skinny(A, B, C, c.threads);
+            break;
+        case GemmKernel::Strassen:
+            gemm_strassen(A, B, C, opts.strassen_cutoff, c.block_size > 0 ? c.block_size : 64);
+            break;
+        case GemmKernel::Parallel:
+            gemm_blocked_parallel(A, B, C, c.block_size > 0 ? c.block_size : 64, c.threads);
+            break;
+    }
+}
+
+void gemm(const Matrix& A, const Matrix& B, Matrix& C, const GemmOptions& opts,
+          GemmDecision* decision) {
+    const GemmDecision d = gemm_plan(A.m, A.n, B.n, opts);
+    std::shared_ptr<const GemmLogger> logger;
+    {
+        std::lock_guard<std::mutex> lock(g_logger_mutex);
+        logger = g_logger;
+    }
+    if (logger) (*logger)(d);
+    if (decision) *decision = d;
+    gemm_run(d.choice, A, B, C, opts);
+}
+
+static void describe(std::ostringstream& out, const GemmCandidate& c) {
+    out << std::left << std::setw(12) << gemm_kernel_name(c.kernel) << std::right;
+    if (c.block_size > 0) out << " bs=" << std::setw(3) << c.block_size;
+    else out << "       ";
+    out << " threads=" << std::setw(2) << c.threads
+        << std::setw(12) << c.predicted_ms << " ms";
+}
+
+std::string gemm_explain(const GemmDecision& d) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3);
+    out << "gemm " << d.m << "x" << d.k << " * " << d.k << "x" << d.n << " -> ";
+    describe(out, d.choice);
+    out << "\n";
+    for (const GemmCandidate& c : d.candidates) {
+        if (!c.eligible) continue;
+        out << "    ";
+        describe(out, c);
+        out << "\n";
+    }
+    return out.str();
+}
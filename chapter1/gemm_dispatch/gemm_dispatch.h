@@ -0,0 +1,105 @@
+#ifndef GEMM_DISPATCH_H
+#define GEMM_DISPATCH_H
+
+#include <functional>
+#include <string>
+#include "../src/matrix_utils.h"
+
+// One GEMM entry point that picks its kernel
+//
+// gemm(A, B, C) computes C += A*B like every kernel in chapter1. It prices
+// each candidate kernel with an analytic cost model from the shape, the
+// thread budget and a few machine parameters, then runs the cheapest one.
+// The decision, with the predicted time of every candidate, can be returned
+// to the caller or sent to a logger.
+
+enum class GemmKernel { Small, Ikj, Blocked, TallSkinny, Strassen, Parallel };
+const int kGemmKernels = 6;
+
+const char* gemm_kernel_name(GemmKernel kernel);
+
+// Matrices with every dimension up to kSmallDim are small; C with up to
+// kNarrowCols columns is tall-skinny
+const int kSmallDim = 8;
+const int kNarrowCols = 16;
+
+// Machine parameters of the cost model. The defaults are tunable starting
+// values for one core with about 2 MB of L2 and a large shared L3. main.cpp
+// prints predicted against measured times, so they can be checked and
+// adjusted on another machine.
+struct GemmMachine {
+    double register_gflops = 12.0;   // register-resident kernels (small, tall-skinny)
+    double stream_gflops = 6.0;      // C row loaded and stored for every k (ikj, blocked)
+    double loop_ns = 3.0;            // starting one inner j loop
+    double bandwidth_gbs = 10.0;     // main memory
+    double cache_bytes = 2.0e6;      // the cache a block must fit in
+    double llc_bytes = 30.0e6;       // last-level cache share of one core
+    double llc_gbs = 40.0;           // re-reads that hit the last-level cache
+    double fork_us = 5.0;            // one OpenMP parallel region
+    double add_gbs = 6.0;            // matrix additions and copies in Strassen
+};
+
+struct GemmOptions {
+    int threads = 0;                 // thread budget; 0 means omp_get_max_threads()
+    bool allow_strassen = false;     // Strassen's error bound is normwise only
+    int strassen_cutoff = 512;       // recurse while every dimension is above this
+    GemmMachine machine;
+};
+
+struct GemmCandidate {
+    GemmKernel kernel = GemmKernel::Ikj;
+    bool eligible = false;
+    int block_size = 0;
+    int threads = 1;
+    double predicted_ms = 0.0;
+};
+
+struct GemmDecision {
+    int m = 0, k = 0, n = 0;         // C is m×n, the inner dimension is k
+    GemmCandidate choice;
+    GemmCandidate candidates[kGemmKernels];   // indexed by GemmKernel
+};
+
+// Price every candidate for C(m×n) += A(m×k) * B(k×n) and pick the cheapest
+GemmDecision gemm_plan(int m, int k, int n, const GemmOptions& opts = GemmOptions());
+
+// C += A*B with the planned kernel; the decision is stored if asked for
+void gemm(const Matrix& A, const Matrix& B, Matrix& C,
+          const GemmOptions& opts = GemmOptions(), GemmDecision* decision = nullptr);
+
+// Run a given candidate (for benchmarks and tests)
+void gemm_run(const GemmCandidate& c, const Matrix& A, const Matrix& B, Matrix& C,
+              const GemmOptions& opts = GemmOptions());
+
+// One line for the choice, then every eligible candidate with its predicted time
+std::string gemm_explain(const GemmDecision& decision);
+
+// Called with every decision gemm() takes; pass nullptr to stop logging.
+// Setting the logger is safe while gemm() runs on other threads, but the
+// logger itself is called from every thread that calls gemm(), so it must
+// be thread-safe. Calls already in progress finish with the old logger.
+using GemmLogger = std::function<void(const GemmDecision&)>;
+void set_gemm_logger(GemmLogger logger);
+
+// ============================================================================
+// Candidate kernels not found elsewhere in chapter1
+// ============================================================================
+
+// C += A*B holding each row of C in registers across the k loop, with the
+// widths 1, 2, 3, 4 and 8 specialized. Wider B falls back to gemm_ikj.
+void gemm_small(const Matrix& A, const Matrix& B, Matrix& C);
+
+// C += A*B as m*n dot products against B transposed, rows over threads.
+// Meant for B.n <= kNarrowCols, where the C row is too short for ikj.
+void gemm_tall_skinny(const Matrix& A, const Matrix& B, Matrix& C, int threads);
+
+// gemm_blocked with block rows of C split over threads
+void gemm_blocked_parallel(const Matrix& A, const Matrix& B, Matrix& C, int block_size,
+                           int threads);
+
+// Strassen's seven products (Golub & Van Loan, Section 1.3.11), recursing
+// while every dimension is above cutoff, gemm_blocked below; odd
+// dimensions are padded with a zero row or column
+void gemm_strassen(const Matrix& A, const Matrix& B, Matrix& C, int cutoff, int block_size);
+
+#endif // GEMM_DISPATCH_H
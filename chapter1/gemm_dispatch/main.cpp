@@ -0,0 +1,92 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include "gemm_dispatch.h"
+#include "../blocked_game/blocked_gemm.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Average time of f over enough repetitions for ~0.2 GFLOP of work
+template <typename F>
+double time_ms(F f, int m, int k, int n) {
+    const int reps = std::max(1, static_cast<int>(2e8 / (2.0 * m * k * n)));
+    Timer timer;
+    f();
+    timer.start();
+    for (int r = 0; r < reps; r++) f();
+    return timer.elapsed_ms() / reps;
+}
+
+// Every eligible candidate with its predicted and measured time, then the
+// dispatcher against the fixed choices callers make today
+void benchmark_shape(int m, int k, int n, const GemmOptions& opts) {
+    Matrix A(m, k), B(k, n), C(m, n);
+    A.fill_random();
+    B.fill_random();
+
+    GemmDecision d = gemm_plan(m, k, n, opts);
+    std::cout << "Shape: " << m << "x" << k << " * " << k << "x" << n << "\n";
+    std::cout << std::fixed << std::setprecision(4);
+
+    double best = 0.0;
+    GemmKernel best_kernel = GemmKernel::Ikj;
+    for (const GemmCandidate& c : d.candidates) {
+        if (!c.eligible) continue;
+        double ms = time_ms([&] { gemm_run(c, A, B, C, opts); }, m, k, n);
+        std::cout << "  " << std::left << std::setw(12) << gemm_kernel_name(c.kernel) << std::right
+                  << " predicted " << std::setw(11) << c.predicted_ms << " ms   measured "
+                  << std::setw(11) << ms << " ms" << (c.kernel == d.choice.kernel ? "  <- gemm()" : "")
+                  << "\n";
+        if (best == 0.0 || ms < best) {
+            best = ms;
+            best_kernel = c.kernel;
+        }
+    }
+
+    const double t_gemm = time_ms([&] { gemm(A, B, C, opts); }, m, k, n);
+    const double t_ikj = time_ms([&] { gemm_ikj(A, B, C); }, m, k, n);
+    const double t_b64 = time_ms([&] { gemm_blocked_64(A, B, C); }, m, k, n);
+    std::cout << "  gemm(): " << t_gemm << " ms, best " << gemm_kernel_name(best_kernel)
+              << " " << best << " ms\n" << std::setprecision(2)
+              << "  Time relative to gemm(): always ikj " << t_ikj / t_gemm
+              << "x, always blocked_64 " << t_b64 / t_gemm << "x\n\n";
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "================================================================\n";
+    std::cout << "GEMM DISPATCH BENCHMARK\n";
+    std::cout << "Cost-model kernel choice vs every candidate and fixed choices\n";
+    std::cout << "================================================================\n";
+#ifdef _OPENMP
+    std::cout << "Threads: " << omp_get_max_threads() << "\n\n";
+#else
+    std::cout << "Threads: 1 (compiled without -fopenmp)\n\n";
+#endif
+
+    std::vector<std::vector<int>> shapes = {
+        {4, 4, 4}, {8, 8, 8}, {100, 100, 100}, {1000, 1000, 1000}, {2000, 2000, 2000},
+        {100000, 64, 4}, {4000, 4000, 4}, {4, 4000, 4000}, {64, 100000, 64}};
+    GemmOptions opts;
+
+    // Usage: ./gemm_dispatch_bench [m k n] [strassen]
+    if (argc > 3) shapes = {{atoi(argv[1]), atoi(argv[2]), atoi(argv[3])}};
+    if (argc > 4) opts.allow_strassen = atoi(argv[4]) != 0;
+
+    for (const auto& s : shapes) {
+        benchmark_shape(s[0], s[1], s[2], opts);
+    }
+
+    std::cout << "What to look for:\n";
+    std::cout << "  • gemm() should be within noise of the best candidate for every\n";
+    std::cout << "    shape; no single fixed kernel is\n";
+    std::cout << "  • Narrow C (n <= 16) is where ikj and blocked lose the most: the\n";
+    std::cout << "    inner loop is a few entries long\n";
+    std::cout << "  • Predicted times only need to rank the candidates; when they are\n";
+    std::cout << "    off by a constant factor on another machine, adjust GemmMachine\n";
+    std::cout << "Usage: " << argv[0] << " [m k n] [strassen]\n";
+
+    return 0;
+}
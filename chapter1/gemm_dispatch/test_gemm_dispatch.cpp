@@ -0,0 +1,222 @@
+#include <atomic>
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "gemm_dispatch.h"
+#include "../blocked_game/blocked_gemm.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// C0 + A*B by the ikj control, for random A, B and C0
+struct Problem {
+    Matrix A, B, C0, expected;
+    Problem(int m, int k, int n) : A(m, k), B(k, n), C0(m, n), expected(m, n) {
+        A.fill_random();
+        B.fill_random();
+        C0.fill_random();
+        expected = C0;
+        gemm_ikj(A, B, expected);
+    }
+};
+
+// Every candidate, forced, gives C += A*B, including shapes that are odd at
+// every Strassen level
+bool test_candidates() {
+    std::cout << "Testing every candidate kernel against ikj... ";
+
+    const std::vector<std::vector<int>> shapes = {
+        {1, 1, 1}, {4, 4, 4}, {8, 3, 8}, {7, 5, 2}, {67, 45, 53}, {130, 70, 16}, {200, 33, 1}};
+    GemmOptions opts;
+    opts.strassen_cutoff = 8;
+    for (const auto& s : shapes) {
+        Problem p(s[0], s[1], s[2]);
+        for (int kernel = 0; kernel < kGemmKernels; kernel++) {
+            GemmCandidate c;
+            c.kernel = static_cast<GemmKernel>(kernel);
+            c.block_size = 32;
+            c.threads = 3;
+            Matrix C = p.C0;
+            gemm_run(c, p.A, p.B, C, opts);
+            if (max_abs_diff(C, p.expected) > 1e-11 * std::max(1, s[1])) {
+                std::cout << "FAILED (" << gemm_kernel_name(c.kernel) << ", " << s[0] << "x"
+                          << s[1] << "x" << s[2] << ")\n";
+                return false;
+            }
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// The plan follows the shape: tiny products to the small kernel, narrow C to
+// tall-skinny, large square products to a blocked kernel, Strassen only
+// when allowed and parallel only with a thread budget
+bool test_plan_choices() {
+    std::cout << "Testing planned kernels by shape... ";
+
+    GemmOptions serial;
+    serial.threads = 1;
+    struct Case { int m, k, n; GemmKernel expected; };
+    const std::vector<Case> cases = {
+        {4, 4, 4, GemmKernel::Small},
+        {100000, 64, 4, GemmKernel::TallSkinny},
+        {4000, 4000, 4, GemmKernel::TallSkinny},
+        {2000, 2000, 2000, GemmKernel::Blocked},
+    };
+    for (const Case& c : cases) {
+        GemmDecision d = gemm_plan(c.m, c.k, c.n, serial);
+        if (d.choice.kernel != c.expected) {
+            std::cout << "FAILED (" << c.m << "x" << c.k << "x" << c.n << " chose "
+                      << gemm_kernel_name(d.choice.kernel) << ")\n";
+            return false;
+        }
+    }
+
+    GemmDecision d = gemm_plan(2000, 2000, 2000, serial);
+    if (d.candidates[static_cast<int>(GemmKernel::Strassen)].eligible ||
+        d.candidates[static_cast<int>(GemmKernel::Parallel)].eligible) {
+        std::cout << "FAILED (Strassen or parallel eligible by default)\n";
+        return false;
+    }
+
+    GemmOptions wide = serial;
+    wide.threads = 8;
+    wide.allow_strassen = true;
+    d = gemm_plan(2000, 2000, 2000, wide);
+    const GemmCandidate& par = d.candidates[static_cast<int>(GemmKernel::Parallel)];
+    if (!d.candidates[static_cast<int>(GemmKernel::Strassen)].eligible || !par.eligible ||
+        par.threads != 8 || d.choice.kernel != GemmKernel::Parallel) {
+        std::cout << "FAILED (thread budget ignored)\n";
+        return false;
+    }
+
+    // The choice is the cheapest eligible candidate
+    for (const GemmCandidate& c : d.candidates) {
+        if (c.eligible && c.predicted_ms < d.choice.predicted_ms) {
+            std::cout << "FAILED (cheaper candidate skipped)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// gemm() runs the planned kernel, returns the decision and logs it
+bool test_dispatch_and_log() {
+    std::cout << "Testing gemm() dispatch, decision and logger... ";
+
+    std::vector<GemmDecision> log;
+    set_gemm_logger([&](const GemmDecision& d) { log.push_back(d); });
+
+    const std::vector<std::vector<int>> shapes = {{3, 3, 3}, {500, 40, 2}, {150, 150, 150}};
+    for (const auto& s : shapes) {
+        Problem p(s[0], s[1], s[2]);
+        Matrix C = p.C0;
+        GemmDecision d;
+        gemm(p.A, p.B, C, GemmOptions(), &d);
+        if (max_abs_diff(C, p.expected) > 1e-11 * s[1] || d.m != s[0] || d.k != s[1] ||
+            d.n != s[2] || log.empty() || log.back().choice.kernel != d.choice.kernel) {
+            std::cout << "FAILED (" << s[0] << "x" << s[1] << "x" << s[2] << ")\n";
+            set_gemm_logger(nullptr);
+            return false;
+        }
+        if (gemm_explain(d).find(gemm_kernel_name(d.choice.kernel)) == std::string::npos) {
+            std::cout << "FAILED (explain)\n";
+            set_gemm_logger(nullptr);
+            return false;
+        }
+    }
+    set_gemm_logger(nullptr);
+
+    Problem p(5, 5, 5);
+    Matrix C = p.C0;
+    gemm(p.A, p.B, C);
+    if (log.size() != shapes.size()) {
+        std::cout << "FAILED (logger not removed)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// The logger can be replaced while other threads call gemm(); every call
+// is logged exactly once, by the old or the new logger
+bool test_concurrent_logger() {
+    std::cout << "Testing logger replaced during concurrent gemm() calls... ";
+
+    const int calls = 400;
+    std::atomic<int> first(0), second(0);
+    const Problem p(4, 4, 4);
+    set_gemm_logger([&](const GemmDecision&) { first++; });
+
+    bool correct = true;
+    #pragma omp parallel for schedule(dynamic) num_threads(4) reduction(&&:correct)
+    for (int t = 0; t < calls; t++) {
+        if (t == calls / 2) set_gemm_logger([&](const GemmDecision&) { second++; });
+        Matrix C = p.C0;
+        gemm(p.A, p.B, C);
+        correct = correct && max_abs_diff(C, p.expected) <= 1e-12;
+    }
+    set_gemm_logger(nullptr);
+
+    if (!correct || first + second != calls || second == 0) {
+        std::cout << "FAILED (" << first << " + " << second << " of " << calls << " calls logged)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Threaded kernels give the same result for every thread count
+bool test_thread_counts() {
+    std::cout << "Testing threaded kernels over thread counts... ";
+
+    Problem wide(300, 120, 90), narrow(1000, 200, 3);
+    std::vector<int> thread_counts = {1};
+#ifdef _OPENMP
+    thread_counts = {1, 2, 3, 8};
+#endif
+    for (int threads : thread_counts) {
+        Matrix C1 = wide.C0, C2 = narrow.C0;
+        gemm_blocked_parallel(wide.A, wide.B, C1, 64, threads);
+        gemm_tall_skinny(narrow.A, narrow.B, C2, threads);
+        if (max_abs_diff(C1, wide.expected) > 1e-11 * 120 ||
+            max_abs_diff(C2, narrow.expected) > 1e-11 * 200) {
+            std::cout << "FAILED (" << threads << " threads)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing GEMM Dispatcher\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_candidates();
+    all_passed &= test_plan_choices();
+    all_passed &= test_dispatch_and_log();
+    all_passed &= test_concurrent_logger();
+    all_passed &= test_thread_counts();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,101 @@
+#include "gemm_epilogue.h"
+#include "../blocked_game/blocked_gemm.h"
+#include "../src/span_ops.h"
+#include <algorithm>
+#include <cmath>
+
+// ============================================================================
+// EPILOGUE STAGES on a contiguous span of C(i, j0 .. j0+len-1), at most one
+// tile row. Scale, shift and clamp come from src/span_ops.h.
+// ============================================================================
+static void bias_span(double* c, int len, const double* bias) {
+    for (int k = 0; k < len; k++) c[k] += bias[k];
+}
+
+static void activation_span(double* c, int len, Activation activation) {
+    switch (activation) {
+        case Activation::None:
+            break;
+        case Activation::ReLU:
+            for (int k = 0; k < len; k++) c[k] = std::max(c[k], 0.0);
+            break;
+        case Activation::Tanh:
+            for (int k = 0; k < len; k++) c[k] = std::tanh(c[k]);
+            break;
+        case Activation::Sigmoid:
+            for (int k = 0; k < len; k++) c[k] = 1.0 / (1.0 + std::exp(-c[k]));
+            break;
+    }
+}
+
+static bool has_clamp(const EpilogueSpec& spec) {
+    return spec.clamp_lo > -std::numeric_limits<double>::infinity() ||
+           spec.clamp_hi < std::numeric_limits<double>::infinity();
+}
+
+GemmEpilogue make_epilogue(const EpilogueSpec& spec) {
+    const bool clamp = has_clamp(spec);
+    return [spec, clamp](int i, int j0, double* c, int len) {
+        if (spec.scale != 1.0) scale_span(c, len, spec.scale);
+        if (spec.column_bias) bias_span(c, len, spec.column_bias->data() + j0);
+        if (spec.row_bias) shift_span(c, len, (*spec.row_bias)[i]);
+        activation_span(c, len, spec.activation);
+        if (clamp) clamp_span(c, len, spec.clamp_lo, spec.clamp_hi);
+    };
+}
+
+// ============================================================================
+// FUSED GEMM: same block order as gemm_blocked (ii, jj, kk). Tile (ii, jj)
+// of C is final once the kk loop ends, and is still in cache.
+// ============================================================================
+void gemm_blocked_epilogue(const Matrix& A, const Matrix& B, Matrix& C, int block_size,
+                           const GemmEpilogue& epilogue) {
+    const int m = A.m;
+    const int n = B.n;
+    const int r = A.n;
+
+    for (int ii = 0; ii < m; ii += block_size) {
+        const int i_max = std::min(ii + block_size, m);
+        for (int jj = 0; jj < n; jj += block_size) {
+            const int j_max = std::min(jj + block_size, n);
+            for (int kk = 0; kk < r; kk += block_size) {
+                const int k_max = std::min(kk + block_size, r);
+                inner_block_outer_loop(A, B, C, ii, kk, jj, i_max, j_max, k_max);
+            }
+            for (int i = ii; i < i_max; i++) epilogue(i, jj, &C(i, jj), j_max - jj);
+        }
+    }
+}
+
+void gaxpy_row_oriented_epilogue(const Matrix& A, const std::vector<double>& x,
+                                 std::vector<double>& y, const GemmEpilogue& epilogue) {
+    for (int i = 0; i < A.m; i++) {
+        const double* a_row = &A(i, 0);
+        double s = y[i];
+        for (int j = 0; j < A.n; j++) s += a_row[j] * x[j];
+        y[i] = s;
+        epilogue(i, 0, &y[i], 1);
+    }
+}
+
+// ============================================================================
+// UNFUSED REFERENCE: one full pass over C per stage
+// ============================================================================
+void apply_epilogue_passes(Matrix& C, const EpilogueSpec& spec) {
+    auto each_row = [&](auto&& stage) {
+        for (int i = 0; i < C.m; i++) stage(i, &C(i, 0));
+    };
+    if (spec.scale != 1.0) each_row([&](int, double* c) { scale_span(c, C.n, spec.scale); });
+    if (spec.column_bias) {
+        each_row([&](int, double* c) { bias_span(c, C.n, spec.column_bias->data()); });
+    }
+    if (spec.row_bias) {
+        each_row([&](int i, double* c) { shift_span(c, C.n, (*spec.row_bias)[i]); });
+    }
+    if (spec.activation != Activation::None) {
+        each_row([&](int, double* c) { activation_span(c, C.n, spec.activation); });
+    }
+    if (has_clamp(spec)) {
+        each_row([&](int, double* c) { clamp_span(c, C.n, spec.clamp_lo, spec.clamp_hi); });
+    }
+}
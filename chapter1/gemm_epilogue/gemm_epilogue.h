@@ -0,0 +1,54 @@
+#ifndef GEMM_EPILOGUE_H
+#define GEMM_EPILOGUE_H
+
+#include <functional>
+#include <limits>
+#include <vector>
+#include "../src/matrix_utils.h"
+
+// GEMM and gaxpy with a fused epilogue
+//
+// A layer such as C = relu(alpha * A*B + bias) is usually a GEMM followed by
+// passes over C for the bias, the scaling and the nonlinearity. Each of those
+// passes streams all of C from memory again. Here the epilogue runs on each
+// C tile of gemm_blocked right after its last k-block, while the tile is
+// still in cache, so C is written once.
+
+// Applied in place to c[0 .. len-1] = C(i, j0 .. j0+len-1), the finished
+// entries of one tile row. It is called once per tile row, so the call
+// overhead is paid once per block_size entries.
+using GemmEpilogue = std::function<void(int i, int j0, double* c, int len)>;
+
+enum class Activation { None, ReLU, Tanh, Sigmoid };
+
+// The usual layer epilogue, applied in this order:
+//   c = scale * c
+//   c = c + column_bias[j] + row_bias[i]      (either may be null)
+//   c = activation(c)
+//   c = min(max(c, clamp_lo), clamp_hi)
+struct EpilogueSpec {
+    double scale = 1.0;
+    const std::vector<double>* column_bias = nullptr;   // one per column of C
+    const std::vector<double>* row_bias = nullptr;      // one per row of C
+    Activation activation = Activation::None;
+    double clamp_lo = -std::numeric_limits<double>::infinity();
+    double clamp_hi = std::numeric_limits<double>::infinity();
+};
+
+GemmEpilogue make_epilogue(const EpilogueSpec& spec);
+
+// C = epilogue(C + A*B): the loops of gemm_blocked, with the epilogue run on
+// each tile once its k loop is done
+void gemm_blocked_epilogue(const Matrix& A, const Matrix& B, Matrix& C, int block_size,
+                           const GemmEpilogue& epilogue);
+
+// y = epilogue(y + A*x), row-oriented: y(i) is final after the dot product
+// with row i and gets the epilogue as the n×1 entry (i, 0)
+void gaxpy_row_oriented_epilogue(const Matrix& A, const std::vector<double>& x,
+                                 std::vector<double>& y, const GemmEpilogue& epilogue);
+
+// The unfused reference: spec applied to every entry of C in separate
+// passes, one per stage
+void apply_epilogue_passes(Matrix& C, const EpilogueSpec& spec);
+
+#endif // GEMM_EPILOGUE_H
@@ -0,0 +1,84 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include "gemm_epilogue.h"
+#include "../blocked_game/blocked_gemm.h"
+
+void print_row(const char* label, double ms, double flops) {
+    std::cout << "  " << std::left << std::setw(28) << label << std::right
+              << std::setw(10) << ms << " ms" << std::setw(10) << flops / (ms * 1e6)
+              << " GFLOPS\n";
+}
+
+// C = relu(0.5 * A*B + bias): GEMM then four passes vs fused epilogue
+void benchmark_shape(int m, int n, int r, int block_size) {
+    Matrix A(m, r), B(r, n);
+    A.fill_random();
+    B.fill_random();
+    std::vector<double> bias(n, 0.1);
+    EpilogueSpec spec;
+    spec.scale = 0.5;
+    spec.column_bias = &bias;
+    spec.activation = Activation::ReLU;
+    spec.clamp_hi = 6.0;
+    Timer timer;
+
+    std::cout << "C = min(relu(0.5*A*B + bias), 6), A " << m << "×" << r << ", B " << r
+              << "×" << n << " (block_size=" << block_size << ")\n";
+    std::cout << std::fixed << std::setprecision(3);
+
+    Matrix C(m, n);
+    timer.start();
+    gemm_blocked(A, B, C, block_size);
+    double t_gemm = timer.elapsed_ms();
+    timer.start();
+    apply_epilogue_passes(C, spec);
+    double t_passes = timer.elapsed_ms();
+
+    Matrix C_fused(m, n);
+    timer.start();
+    gemm_blocked_epilogue(A, B, C_fused, block_size, make_epilogue(spec));
+    double t_fused = timer.elapsed_ms();
+
+    const double flops = 2.0 * m * n * r;
+    print_row("GEMM:", t_gemm, flops);
+    std::cout << "  " << std::left << std::setw(28) << "+ 4 passes over C:" << std::right
+              << std::setw(10) << t_passes << " ms" << std::setw(10)
+              << 4 * 16.0 * m * n / (t_passes * 1e6) << " GB/s\n";
+    print_row("GEMM + passes:", t_gemm + t_passes, flops);
+    print_row("Fused epilogue:", t_fused, flops);
+    std::cout << "  " << std::left << std::setw(28) << "Speedup:" << std::right
+              << std::setw(10) << (t_gemm + t_passes) / t_fused << "x\n\n";
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "================================================================\n";
+    std::cout << "GEMM EPILOGUE FUSION BENCHMARK\n";
+    std::cout << "Bias, scale, activation and clamp on the hot C tile\n";
+    std::cout << "================================================================\n\n";
+
+    // Small inner dimensions are where the passes over C are expensive
+    // relative to the GEMM itself
+    std::vector<std::vector<int>> shapes = {{4000, 2000, 16}, {4000, 2000, 64}, {1000, 1000, 1000}};
+    int block_size = 64;
+
+    // Usage: ./epilogue_bench [m n r] [block_size]
+    if (argc > 3) shapes = {{atoi(argv[1]), atoi(argv[2]), atoi(argv[3])}};
+    if (argc > 4) block_size = atoi(argv[4]);
+
+    for (const auto& s : shapes) {
+        benchmark_shape(s[0], s[1], s[2], block_size);
+    }
+
+    std::cout << "What to look for:\n";
+    std::cout << "  • Each separate pass reads and writes all of C; with small r\n";
+    std::cout << "    the passes cost as much as the GEMM\n";
+    std::cout << "  • The fused epilogue runs on a tile still in L1/L2 and adds\n";
+    std::cout << "    almost nothing to the GEMM time\n";
+    std::cout << "  • For square GEMMs the O(n^2) passes are lost in the O(n^3)\n";
+    std::cout << "    flops and fusion does not matter\n";
+    std::cout << "Usage: " << argv[0] << " [m n r] [block_size]\n";
+
+    return 0;
+}
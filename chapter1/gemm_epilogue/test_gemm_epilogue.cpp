@@ -0,0 +1,148 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "gemm_epilogue.h"
+#include "../blocked_game/blocked_gemm.h"
+#include "../row_v_col/gaxpy.h"
+
+// A few layer epilogues covering every stage
+std::vector<EpilogueSpec> test_specs(const std::vector<double>* col_bias,
+                                     const std::vector<double>* row_bias) {
+    std::vector<EpilogueSpec> specs(5);
+    specs[1].scale = 0.5;
+    specs[1].column_bias = col_bias;
+    specs[1].activation = Activation::ReLU;
+    specs[2].row_bias = row_bias;
+    specs[2].activation = Activation::Tanh;
+    specs[3].scale = -2.0;
+    specs[3].activation = Activation::Sigmoid;
+    specs[3].clamp_lo = 0.1;
+    specs[3].clamp_hi = 0.9;
+    specs[4].column_bias = col_bias;
+    specs[4].row_bias = row_bias;
+    specs[4].clamp_lo = -0.25;
+    return specs;
+}
+
+bool test_fused_gemm() {
+    std::cout << "Testing fused GEMM against GEMM + separate passes... ";
+
+    for (auto [m, n, r] : {std::tuple{1, 1, 1}, {7, 5, 3}, {64, 64, 64}, {100, 130, 70}}) {
+        Matrix A(m, r), B(r, n), C0(m, n);
+        A.fill_random();
+        B.fill_random();
+        C0.fill_random();
+        std::vector<double> col_bias(n), row_bias(m);
+        for (int j = 0; j < n; j++) col_bias[j] = std::sin(1.0 + j);
+        for (int i = 0; i < m; i++) row_bias[i] = std::cos(2.0 + i);
+
+        for (const EpilogueSpec& spec : test_specs(&col_bias, &row_bias)) {
+            for (int block_size : {8, 32, 64}) {
+                Matrix C_ref = C0;
+                gemm_blocked(A, B, C_ref, block_size);
+                apply_epilogue_passes(C_ref, spec);
+
+                Matrix C = C0;
+                gemm_blocked_epilogue(A, B, C, block_size, make_epilogue(spec));
+                if (!(max_abs_diff(C.data, C_ref.data) <= 1e-13 * r)) {
+                    std::cout << "FAILED (" << m << "x" << n << "x" << r << ", block="
+                              << block_size << ")\n";
+                    return false;
+                }
+            }
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Every entry of C reaches the epilogue exactly once, with its own (i, j)
+bool test_epilogue_coverage() {
+    std::cout << "Testing that each entry is finished exactly once... ";
+
+    const int m = 70, n = 45, r = 33;
+    Matrix A(m, r), B(r, n), C(m, n);
+    A.fill_random();
+    B.fill_random();
+    Matrix C_ref(m, n);
+    gemm_blocked(A, B, C_ref, 16);
+
+    Matrix calls(m, n);
+    bool positions_ok = true;
+    GemmEpilogue record = [&](int i, int j0, double* c, int len) {
+        for (int k = 0; k < len; k++) {
+            calls(i, j0 + k) += 1.0;
+            if (c != &C(i, j0)) positions_ok = false;
+            // The tile must be final when the epilogue sees it
+            if (c[k] != C_ref(i, j0 + k)) positions_ok = false;
+        }
+    };
+    gemm_blocked_epilogue(A, B, C, 16, record);
+    for (double v : calls.data) {
+        if (v != 1.0) positions_ok = false;
+    }
+    if (!positions_ok) {
+        std::cout << "FAILED\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_fused_gaxpy() {
+    std::cout << "Testing fused gaxpy against gaxpy + separate passes... ";
+
+    const int m = 150, n = 90;
+    Matrix A(m, n);
+    A.fill_random();
+    std::vector<double> x(n), y0(m), row_bias(m);
+    for (int j = 0; j < n; j++) x[j] = std::sin(0.5 * j);
+    for (int i = 0; i < m; i++) {
+        y0[i] = std::cos(0.3 * i);
+        row_bias[i] = 0.01 * i;
+    }
+
+    // For y as an m×1 matrix the bias per entry is the row bias
+    for (const EpilogueSpec& spec : test_specs(nullptr, &row_bias)) {
+        Matrix Y_ref(m, 1);
+        std::vector<double> y_ref = y0;
+        gaxpy_row_oriented(A, x, y_ref);
+        Y_ref.data = y_ref;
+        apply_epilogue_passes(Y_ref, spec);
+
+        std::vector<double> y = y0;
+        gaxpy_row_oriented_epilogue(A, x, y, make_epilogue(spec));
+        if (!(max_abs_diff(y, Y_ref.data) <= 1e-13 * n)) {
+            std::cout << "FAILED\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing GEMM Epilogue Fusion\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_fused_gemm();
+    all_passed &= test_epilogue_coverage();
+    all_passed &= test_fused_gaxpy();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
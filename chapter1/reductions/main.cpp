@@ -0,0 +1,123 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include "reductions.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// GB/s counts one read of A
+void print_row(const char* label, double ms, double bytes, double baseline_ms) {
+    std::cout << "  " << std::left << std::setw(32) << label << std::right
+              << std::setw(10) << ms << " ms" << std::setw(10) << bytes / (ms * 1e6)
+              << " GB/s" << std::setw(9) << baseline_ms / ms << "x\n";
+}
+
+// Today's path: one scalar scan per quantity
+double scans_as_written(const Matrix& A) {
+    const int m = A.m, n = A.n;
+    double ss = 0.0;
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) ss += A(i, j) * A(i, j);
+    }
+    std::vector<double> col(n, 0.0);
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) col[j] += std::abs(A(i, j));
+    }
+    double ninf = 0.0;
+    for (int i = 0; i < m; i++) {
+        double s = 0.0;
+        for (int j = 0; j < n; j++) s += std::abs(A(i, j));
+        ninf = std::max(ninf, s);
+    }
+    double mx = 0.0;
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) mx = std::max(mx, std::abs(A(i, j)));
+    }
+    std::vector<double> rows(m, 0.0), cols(n, 0.0);
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) rows[i] += A(i, j);
+    }
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) cols[j] += A(i, j);
+    }
+    double lo = A(0, 0), hi = A(0, 0);
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) {
+            lo = std::min(lo, A(i, j));
+            hi = std::max(hi, A(i, j));
+        }
+    }
+    return std::sqrt(ss) + *std::max_element(col.begin(), col.end()) + ninf + mx +
+           rows[0] + cols[0] + lo + hi;
+}
+
+void benchmark_size(int m, int n) {
+    Matrix A(m, n);
+    A.fill_random();
+    Timer timer;
+    volatile double sink = 0.0;
+
+    std::cout << "Matrix size: " << m << "×" << n << " (" << 8.0 * m * n / 1e6 << " MB)\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    timer.start();
+    sink = sink + scans_as_written(A);
+    double t_written = timer.elapsed_ms();
+
+    // The seven reductions as seven calls: vectorized, still seven passes
+    timer.start();
+    sink = sink + norm_frobenius(A) + norm_one(A) + norm_inf(A) + norm_max(A) +
+           row_sums(A)[0] + col_sums(A)[0] + reduce_matrix(A, kReduceMinMax).min;
+    double t_calls = timer.elapsed_ms();
+
+    timer.start();
+    sink = sink + reduce_matrix(A, kReduceAll).frobenius;
+    double t_fused = timer.elapsed_ms();
+
+    timer.start();
+    sink = sink + norm_frobenius(A);
+    double t_frob = timer.elapsed_ms();
+
+    const double bytes = 8.0 * m * n;
+    print_row("Seven scalar scans (today):", t_written, 7.0 * bytes, t_written);
+    print_row("Seven reduce_matrix calls:", t_calls, 7.0 * bytes, t_written);
+    print_row("One fused pass (all seven):", t_fused, bytes, t_written);
+    print_row("Frobenius norm alone:", t_frob, bytes, t_written);
+    std::cout << "\n";
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "================================================================\n";
+    std::cout << "MATRIX REDUCTIONS BENCHMARK\n";
+    std::cout << "Norms, sums and min/max: separate scans vs one fused pass\n";
+    std::cout << "================================================================\n";
+#ifdef _OPENMP
+    std::cout << "Threads: " << omp_get_max_threads() << "\n\n";
+#else
+    std::cout << "Threads: 1 (compiled without -fopenmp)\n\n";
+#endif
+
+    std::vector<std::pair<int, int>> sizes = {{1000, 1000}, {4000, 4000}, {100000, 100}};
+
+    // Usage: ./reductions_bench [m] [n]
+    if (argc > 2) sizes = {{atoi(argv[1]), atoi(argv[2])}};
+
+    for (auto [m, n] : sizes) {
+        benchmark_size(m, n);
+    }
+
+    std::cout << "What to look for:\n";
+    std::cout << "  • The fused pass reads A once; its time should be close to the\n";
+    std::cout << "    Frobenius norm alone, not to the sum of seven passes\n";
+    std::cout << "  • The scalar scans are additionally slowed by ordered floating\n";
+    std::cout << "    point sums, which the compiler may not vectorize\n";
+    std::cout << "  • GB/s counts the bytes each variant has to read\n";
+    std::cout << "Usage: " << argv[0] << " [m] [n]\n";
+
+    return 0;
+}
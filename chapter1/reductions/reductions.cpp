@@ -0,0 +1,168 @@
+#include "reductions.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Below this max |a_ij| the squares start to lose digits to underflow
+static const double kTinyEntry = 1e-150;
+
+// One thread's share of the scalar results and column accumulators
+struct ReducePartial {
+    double sumsq = 0.0;
+    double max_abs = 0.0;
+    double max_row_abs = 0.0;
+    double lo = std::numeric_limits<double>::infinity();
+    double hi = -std::numeric_limits<double>::infinity();
+    std::vector<double> col_abs;
+    std::vector<double> col_sum;
+};
+
+// ============================================================================
+// ONE ROW: every requested reduction is its own simd loop over an L1-sized
+// segment of the row
+// ============================================================================
+static void reduce_row(const double* a, int n, unsigned what, ReducePartial& p,
+                       double* row_sum) {
+    double row_abs = 0.0, rsum = 0.0;
+    for (int j0 = 0; j0 < n; j0 += kReduceChunk) {
+        const int len = std::min(kReduceChunk, n - j0);
+        const double* s = a + j0;
+
+        if (what & kReduceFrobenius) {
+            double ss = 0.0;
+            #pragma omp simd reduction(+:ss)
+            for (int k = 0; k < len; k++) ss += s[k] * s[k];
+            p.sumsq += ss;
+        }
+        if (what & (kReduceFrobenius | kReduceMaxAbs)) {
+            double mx = p.max_abs;
+            #pragma omp simd reduction(max:mx)
+            for (int k = 0; k < len; k++) {
+                const double v = std::abs(s[k]);
+                mx = v > mx ? v : mx;
+            }
+            p.max_abs = mx;
+        }
+        if (what & kReduceNormInf) {
+            double t = 0.0;
+            #pragma omp simd reduction(+:t)
+            for (int k = 0; k < len; k++) t += std::abs(s[k]);
+            row_abs += t;
+        }
+        if (what & kReduceRowSums) {
+            double t = 0.0;
+            #pragma omp simd reduction(+:t)
+            for (int k = 0; k < len; k++) t += s[k];
+            rsum += t;
+        }
+        if (what & kReduceNorm1) {
+            double* c = p.col_abs.data() + j0;
+            #pragma omp simd
+            for (int k = 0; k < len; k++) c[k] += std::abs(s[k]);
+        }
+        if (what & kReduceColSums) {
+            double* c = p.col_sum.data() + j0;
+            #pragma omp simd
+            for (int k = 0; k < len; k++) c[k] += s[k];
+        }
+        if (what & kReduceMinMax) {
+            double lo = p.lo, hi = p.hi;
+            #pragma omp simd reduction(min:lo) reduction(max:hi)
+            for (int k = 0; k < len; k++) {
+                lo = s[k] < lo ? s[k] : lo;
+                hi = s[k] > hi ? s[k] : hi;
+            }
+            p.lo = lo;
+            p.hi = hi;
+        }
+    }
+    p.max_row_abs = std::max(p.max_row_abs, row_abs);
+    if (row_sum) *row_sum = rsum;
+}
+
+// sqrt(sum (a_ij / scale)^2) * scale: the second pass when the plain sum of
+// squares overflowed or underflowed
+static double scaled_frobenius(const Matrix& A, double scale) {
+    const double inv = 1.0 / scale;
+    const double* a = A.data.data();
+    const long size = static_cast<long>(A.data.size());
+    double ss = 0.0;
+    #pragma omp parallel for simd schedule(static) reduction(+:ss)
+    for (long k = 0; k < size; k++) ss += (a[k] * inv) * (a[k] * inv);
+    return std::sqrt(ss) * scale;
+}
+
+// ============================================================================
+// DRIVER: static schedule over rows, partials merged in thread order
+// ============================================================================
+MatrixReductions reduce_matrix(const Matrix& A, unsigned what) {
+    const int m = A.m, n = A.n;
+    MatrixReductions r;
+    if (what & kReduceRowSums) r.row_sums.assign(m, 0.0);
+
+#ifdef _OPENMP
+    const int threads = omp_get_max_threads();
+#else
+    const int threads = 1;
+#endif
+    std::vector<ReducePartial> partial(threads);
+
+    #pragma omp parallel num_threads(threads)
+    {
+#ifdef _OPENMP
+        ReducePartial& p = partial[omp_get_thread_num()];
+#else
+        ReducePartial& p = partial[0];
+#endif
+        if (what & kReduceNorm1) p.col_abs.assign(n, 0.0);
+        if (what & kReduceColSums) p.col_sum.assign(n, 0.0);
+
+        #pragma omp for schedule(static)
+        for (int i = 0; i < m; i++) {
+            reduce_row(A.data.data() + static_cast<size_t>(i) * n, n, what, p,
+                       (what & kReduceRowSums) ? &r.row_sums[i] : nullptr);
+        }
+    }
+
+    ReducePartial& total = partial[0];
+    for (int t = 1; t < threads; t++) {
+        const ReducePartial& p = partial[t];
+        total.sumsq += p.sumsq;
+        total.max_abs = std::max(total.max_abs, p.max_abs);
+        total.max_row_abs = std::max(total.max_row_abs, p.max_row_abs);
+        total.lo = std::min(total.lo, p.lo);
+        total.hi = std::max(total.hi, p.hi);
+        for (size_t j = 0; j < p.col_abs.size(); j++) total.col_abs[j] += p.col_abs[j];
+        for (size_t j = 0; j < p.col_sum.size(); j++) total.col_sum[j] += p.col_sum[j];
+    }
+
+    if (what & kReduceFrobenius) {
+        if (std::isinf(total.sumsq) || (total.max_abs > 0.0 && total.max_abs < kTinyEntry)) {
+            r.frobenius = scaled_frobenius(A, total.max_abs);
+        } else {
+            r.frobenius = std::sqrt(total.sumsq);
+        }
+    }
+    if ((what & kReduceNorm1) && n > 0) {
+        r.norm1 = *std::max_element(total.col_abs.begin(), total.col_abs.end());
+    }
+    if (what & kReduceNormInf) r.norm_inf = total.max_row_abs;
+    if (what & kReduceMaxAbs) r.max_abs = total.max_abs;
+    if ((what & kReduceMinMax) && m > 0 && n > 0) {
+        r.min = total.lo;
+        r.max = total.hi;
+    }
+    if (what & kReduceColSums) r.col_sums = std::move(total.col_sum);
+    return r;
+}
+
+double norm_frobenius(const Matrix& A) { return reduce_matrix(A, kReduceFrobenius).frobenius; }
+double norm_one(const Matrix& A) { return reduce_matrix(A, kReduceNorm1).norm1; }
+double norm_inf(const Matrix& A) { return reduce_matrix(A, kReduceNormInf).norm_inf; }
+double norm_max(const Matrix& A) { return reduce_matrix(A, kReduceMaxAbs).max_abs; }
+std::vector<double> row_sums(const Matrix& A) { return reduce_matrix(A, kReduceRowSums).row_sums; }
+std::vector<double> col_sums(const Matrix& A) { return reduce_matrix(A, kReduceColSums).col_sums; }
@@ -0,0 +1,57 @@
+#ifndef REDUCTIONS_H
+#define REDUCTIONS_H
+
+#include <vector>
+#include "../src/matrix_utils.h"
+
+// Norms and reductions of a matrix in one pass
+//
+// Each row is processed in column segments of kReduceChunk entries. Every
+// requested reduction runs as its own `omp simd` loop over the segment,
+// which is in L1 by then, so asking for several reductions still reads A from
+// memory once. Rows are split statically over OpenMP threads. Each thread
+// keeps its own column accumulators, and the partials are merged in thread
+// order.
+
+const int kReduceChunk = 2048;
+
+// Which reductions to compute; combine with |
+enum ReduceFlags : unsigned {
+    kReduceFrobenius = 1u << 0,     // sqrt(sum a_ij^2)
+    kReduceNorm1     = 1u << 1,     // max_j sum_i |a_ij|
+    kReduceNormInf   = 1u << 2,     // max_i sum_j |a_ij|
+    kReduceMaxAbs    = 1u << 3,     // max |a_ij|
+    kReduceRowSums   = 1u << 4,     // sum_j a_ij for every i
+    kReduceColSums   = 1u << 5,     // sum_i a_ij for every j
+    kReduceMinMax    = 1u << 6,     // min and max a_ij
+    kReduceAll       = (1u << 7) - 1
+};
+
+// Fields that were not requested are left at 0 (or empty). All norms of an
+// empty matrix are 0, and so are min and max.
+struct MatrixReductions {
+    double frobenius = 0.0;
+    double norm1 = 0.0;
+    double norm_inf = 0.0;
+    double max_abs = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    std::vector<double> row_sums;
+    std::vector<double> col_sums;
+};
+
+// The requested reductions of A in one pass. The Frobenius norm is a plain
+// sum of squares; if that overflows, or every entry is small enough for the
+// squares to lose digits, a second pass rescales by max |a_ij| as LAPACK's
+// dlange does.
+MatrixReductions reduce_matrix(const Matrix& A, unsigned what);
+
+// One reduction each, for single use
+double norm_frobenius(const Matrix& A);
+double norm_one(const Matrix& A);
+double norm_inf(const Matrix& A);
+double norm_max(const Matrix& A);
+std::vector<double> row_sums(const Matrix& A);
+std::vector<double> col_sums(const Matrix& A);
+
+#endif // REDUCTIONS_H
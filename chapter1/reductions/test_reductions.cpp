@@ -0,0 +1,173 @@
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "reductions.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Straightforward loops over the entries, one reduction at a time
+MatrixReductions reference(const Matrix& A) {
+    MatrixReductions r;
+    r.row_sums.assign(A.m, 0.0);
+    r.col_sums.assign(A.n, 0.0);
+    std::vector<double> col_abs(A.n, 0.0);
+    double ss = 0.0;
+    for (int i = 0; i < A.m; i++) {
+        double row_abs = 0.0;
+        for (int j = 0; j < A.n; j++) {
+            const double a = A(i, j);
+            ss += a * a;
+            row_abs += std::abs(a);
+            col_abs[j] += std::abs(a);
+            r.row_sums[i] += a;
+            r.col_sums[j] += a;
+            r.max_abs = std::max(r.max_abs, std::abs(a));
+            r.min = (i == 0 && j == 0) ? a : std::min(r.min, a);
+            r.max = (i == 0 && j == 0) ? a : std::max(r.max, a);
+        }
+        r.norm_inf = std::max(r.norm_inf, row_abs);
+    }
+    for (double c : col_abs) r.norm1 = std::max(r.norm1, c);
+    r.frobenius = std::sqrt(ss);
+    return r;
+}
+
+double rel(double a, double b) {
+    return std::abs(a - b) / std::max(std::abs(b), 1e-300);
+}
+
+// Every field against the reference; sums to a relative tolerance,
+// max/min exactly
+bool matches(const MatrixReductions& r, const MatrixReductions& ref, double tol) {
+    return rel(r.frobenius, ref.frobenius) <= tol && rel(r.norm1, ref.norm1) <= tol &&
+           rel(r.norm_inf, ref.norm_inf) <= tol && r.max_abs == ref.max_abs &&
+           r.min == ref.min && r.max == ref.max &&
+           max_abs_diff(r.row_sums, ref.row_sums) <= tol * std::max(1.0, ref.norm_inf) &&
+           max_abs_diff(r.col_sums, ref.col_sums) <= tol * std::max(1.0, ref.norm1);
+}
+
+// All reductions fused, against the reference, including rows wider than
+// one segment and empty shapes
+bool test_fused() {
+    std::cout << "Testing fused reductions against scalar loops... ";
+
+    const std::vector<std::pair<int, int>> shapes = {
+        {0, 0}, {0, 5}, {5, 0}, {1, 1}, {37, 53}, {200, 100}, {3, 5000}, {5000, 3}};
+    for (auto [m, n] : shapes) {
+        Matrix A(m, n);
+        A.fill_random();
+        MatrixReductions r = reduce_matrix(A, kReduceAll);
+        if (!matches(r, reference(A), 1e-13)) {
+            std::cout << "FAILED (" << m << "×" << n << ")\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Single requests fill only their own field and agree with the fused pass
+bool test_single() {
+    std::cout << "Testing single reductions and requested fields... ";
+
+    Matrix A(120, 90);
+    A.fill_random();
+    const MatrixReductions all = reduce_matrix(A, kReduceAll);
+
+    if (norm_frobenius(A) != all.frobenius || norm_one(A) != all.norm1 ||
+        norm_inf(A) != all.norm_inf || norm_max(A) != all.max_abs ||
+        row_sums(A) != all.row_sums || col_sums(A) != all.col_sums) {
+        std::cout << "FAILED (single vs fused)\n";
+        return false;
+    }
+
+    MatrixReductions r = reduce_matrix(A, kReduceNorm1 | kReduceMinMax);
+    if (r.frobenius != 0.0 || r.norm_inf != 0.0 || r.max_abs != 0.0 ||
+        !r.row_sums.empty() || !r.col_sums.empty() ||
+        r.norm1 != all.norm1 || r.min != all.min || r.max != all.max) {
+        std::cout << "FAILED (unrequested fields set)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// The sum of squares overflows above 1e154 and underflows below 1e-154;
+// the rescaled second pass recovers the norm in both cases
+bool test_frobenius_scaling() {
+    std::cout << "Testing Frobenius norm near overflow and underflow... ";
+
+    Matrix A(50, 40);
+    A.fill_random();
+    const double base = norm_frobenius(A);
+    for (double s : {1e200, 1e-200, 1e300}) {
+        Matrix B = A;
+        for (double& v : B.data) v *= s;
+        double f = norm_frobenius(B);
+        if (!std::isfinite(f) || rel(f, base * s) > 1e-13) {
+            std::cout << "FAILED (scale " << s << ": " << f << ")\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Row results and max/min do not depend on the thread count; sums only
+// through their rounding
+bool test_thread_counts() {
+    std::cout << "Testing reductions over thread counts... ";
+
+    Matrix A(1001, 777);
+    A.fill_random();
+    const MatrixReductions ref = reference(A);
+
+    std::vector<int> thread_counts = {1};
+#ifdef _OPENMP
+    const int saved = omp_get_max_threads();
+    thread_counts = {1, 2, 3, 8};
+#endif
+    for (int threads : thread_counts) {
+#ifdef _OPENMP
+        omp_set_num_threads(threads);
+#endif
+        if (!matches(reduce_matrix(A, kReduceAll), ref, 1e-13)) {
+            std::cout << "FAILED (" << threads << " threads)\n";
+            return false;
+        }
+    }
+#ifdef _OPENMP
+    omp_set_num_threads(saved);
+#endif
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Single-Pass Matrix Reductions\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_fused();
+    all_passed &= test_single();
+    all_passed &= test_frobenius_scaling();
+    all_passed &= test_thread_counts();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
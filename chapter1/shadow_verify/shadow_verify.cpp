@@ -0,0 +1,214 @@
+#include "shadow_verify.h"
+#include <cmath>
+#include <limits>
+
+// Safety factor on the worst-case rounding bound
+static const double kShadowSafety = 2.0;
+
+static uint64_t splitmix64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// ============================================================================
+// FREIVALDS CHECK
+//
+// With D = C_after - C_before, compare d = D x against z = A (B x). Entry by
+// entry, the rounding in the kernel and in both products is bounded by
+//   gamma * ( |A| (|B| |x|) + (|C_before| + |C_after|) |x| ),
+// gamma = eps * (k + n + 2), so any row above that bound is a real error.
+// ============================================================================
+bool freivalds_check(const Matrix& A, const Matrix& B, const Matrix& C_before,
+                     const Matrix& C_after, int probes, uint64_t seed,
+                     ShadowMismatch* mismatch) {
+    const int m = A.m, k = A.n, n = B.n;
+    const double gamma =
+        kShadowSafety * std::numeric_limits<double>::epsilon() * (k + n + 2.0);
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<> dis(-1.0, 1.0);
+
+    // All probes go through A, B and C in one pass; each row is reused
+    // from L1 across the probes instead of being streamed again
+    std::vector<std::vector<double>> x(probes, std::vector<double>(n));
+    std::vector<std::vector<double>> y(probes, std::vector<double>(k));
+    std::vector<std::vector<double>> y_abs(probes, std::vector<double>(k));
+    for (auto& xq : x) {
+        for (double& v : xq) v = dis(gen);
+    }
+
+    // y = B x and |B| |x|
+    for (int p = 0; p < k; p++) {
+        const double* b = &B.data[static_cast<size_t>(p) * n];
+        for (int q = 0; q < probes; q++) {
+            const double* xq = x[q].data();
+            double s = 0.0, s_abs = 0.0;
+#pragma omp simd reduction(+:s, s_abs)
+            for (int j = 0; j < n; j++) {
+                s += b[j] * xq[j];
+                s_abs += std::abs(b[j]) * std::abs(xq[j]);
+            }
+            y[q][p] = s;
+            y_abs[q][p] = s_abs;
+        }
+    }
+
+    bool ok = true;
+    double worst = 0.0;
+    for (int i = 0; i < m; i++) {
+        const double* a = &A.data[static_cast<size_t>(i) * k];
+        const double* c0 = &C_before.data[static_cast<size_t>(i) * n];
+        const double* c1 = &C_after.data[static_cast<size_t>(i) * n];
+        for (int q = 0; q < probes; q++) {
+            const double* yq = y[q].data();
+            const double* yq_abs = y_abs[q].data();
+            const double* xq = x[q].data();
+            double z = 0.0, z_abs = 0.0;
+#pragma omp simd reduction(+:z, z_abs)
+            for (int p = 0; p < k; p++) {
+                z += a[p] * yq[p];
+                z_abs += std::abs(a[p]) * yq_abs[p];
+            }
+            double d = 0.0, d_abs = 0.0;
+#pragma omp simd reduction(+:d, d_abs)
+            for (int j = 0; j < n; j++) {
+                d += (c1[j] - c0[j]) * xq[j];
+                d_abs += (std::abs(c0[j]) + std::abs(c1[j])) * std::abs(xq[j]);
+            }
+
+            // A NaN or Inf in the result is always a mismatch. A zero row of A
+            // with zero rows of C has a zero bound and passes on its exact
+            // zero residual.
+            const double residual = std::abs(d - z);
+            const double tol = gamma * (z_abs + d_abs);
+            if (std::isfinite(residual) && residual <= tol) continue;
+            const double ratio = std::isfinite(residual) && tol > 0.0
+                                     ? residual / tol
+                                     : std::numeric_limits<double>::infinity();
+            if (ok || ratio > worst) {
+                ok = false;
+                worst = ratio;
+                if (mismatch) {
+                    mismatch->m = m;
+                    mismatch->k = k;
+                    mismatch->n = n;
+                    mismatch->row = i;
+                    mismatch->residual = residual;
+                    mismatch->tolerance = tol;
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+// ============================================================================
+// VERIFIER
+// ============================================================================
+ShadowVerifier::ShadowVerifier(const ShadowOptions& options) : options_(options) {
+    const double rate = std::min(1.0, std::max(0.0, options_.sample_rate));
+    threshold_ = rate >= 1.0 ? std::numeric_limits<uint64_t>::max()
+                             : static_cast<uint64_t>(std::ldexp(rate, 64));
+    thread_ = std::thread(&ShadowVerifier::worker, this);
+}
+
+ShadowVerifier::~ShadowVerifier() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    work_ready_.notify_one();
+    thread_.join();
+}
+
+bool ShadowVerifier::sample(uint64_t call) const {
+    if (threshold_ == std::numeric_limits<uint64_t>::max()) return true;
+    return splitmix64(options_.seed ^ splitmix64(call)) < threshold_;
+}
+
+void ShadowVerifier::gemm(const char* kernel_name, const GemmFunction& kernel,
+                          const Matrix& A, const Matrix& B, Matrix& C) {
+    const uint64_t call = calls_.fetch_add(1, std::memory_order_relaxed);
+    if (!sample(call)) {
+        kernel(A, B, C);
+        return;
+    }
+
+    // Reserve a queue slot first, so a full queue never costs the copies
+    bool reserved = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (pending_ < options_.max_pending) {
+            pending_++;
+            stats_.sampled++;
+            reserved = true;
+        } else {
+            stats_.dropped++;
+        }
+    }
+    if (!reserved) {
+        kernel(A, B, C);
+        return;
+    }
+
+    Job job{kernel_name, call, A, B, C, Matrix(0, 0)};
+    kernel(A, B, C);
+    job.C_after = C;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(job));
+    }
+    work_ready_.notify_one();
+}
+
+void ShadowVerifier::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    work_done_.wait(lock, [this] { return pending_ == 0; });
+}
+
+void ShadowVerifier::worker() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        work_ready_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+        // Queued checks are finished before stopping
+        if (queue_.empty()) return;
+        Job job = std::move(queue_.front());
+        queue_.pop_front();
+
+        lock.unlock();
+        check(job);
+        lock.lock();
+        pending_--;
+        work_done_.notify_all();
+    }
+}
+
+void ShadowVerifier::check(const Job& job) {
+    ShadowMismatch mismatch;
+    const bool ok = freivalds_check(job.A, job.B, job.C_before, job.C_after, options_.probes,
+                                    options_.seed ^ splitmix64(~job.call), &mismatch);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.verified++;
+        if (ok) return;
+        stats_.mismatches++;
+        mismatch.kernel = job.kernel;
+        mismatch.call = job.call;
+        mismatches_.push_back(mismatch);
+    }
+    // Outside the lock, so the handler may call stats() or mismatches()
+    if (options_.on_mismatch) options_.on_mismatch(mismatch);
+}
+
+ShadowStats ShadowVerifier::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ShadowStats s = stats_;
+    s.calls = calls_.load(std::memory_order_relaxed);
+    return s;
+}
+
+std::vector<ShadowMismatch> ShadowVerifier::mismatches() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return mismatches_;
+}
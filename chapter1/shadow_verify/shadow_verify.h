@@ -0,0 +1,108 @@
+#ifndef SHADOW_VERIFY_H
+#define SHADOW_VERIFY_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../src/matrix_utils.h"
+
+// Sampled shadow verification of GEMM kernels in production
+//
+// A small fraction of calls is chosen at random. For a chosen call, A, B and
+// C before the call are copied, the kernel runs as usual, and the result is
+// copied too. A background thread then checks C_after - C_before = A*B with
+// Freivalds' test: for a random vector x, compare (C_after - C_before) x
+// with A (B x). That is O(mk + kn + mn) work instead of a second multiply,
+// and an error anywhere in C survives a probe only with probability zero
+// in exact arithmetic.
+//
+// Unsampled calls pay one atomic increment and a hash. Sampled calls pay
+// the copies on the calling thread; the check itself is off the critical
+// path. When the queue is full the sample is dropped rather than blocking
+// the caller.
+
+using GemmFunction = std::function<void(const Matrix&, const Matrix&, Matrix&)>;
+
+// A sampled call whose result failed the check
+struct ShadowMismatch {
+    std::string kernel;
+    int m = 0, k = 0, n = 0;         // C is m×n, the inner dimension is k
+    uint64_t call = 0;               // index of the call on this verifier
+    int row = -1;                    // row with the largest residual / tolerance
+    double residual = 0.0;           // |((C_after - C_before) x - A(Bx))_row|
+    double tolerance = 0.0;          // rounding bound for that row
+};
+
+struct ShadowOptions {
+    double sample_rate = 1e-3;       // fraction of calls checked; 0 off, 1 every call
+    int probes = 2;                  // random vectors per check
+    int max_pending = 4;             // queued checks before samples are dropped
+    uint64_t seed = 0x5eed;          // for the sampling decision and the probes
+    std::function<void(const ShadowMismatch&)> on_mismatch;   // called on the worker thread
+};
+
+struct ShadowStats {
+    uint64_t calls = 0;
+    uint64_t sampled = 0;
+    uint64_t dropped = 0;            // sampled while the queue was full
+    uint64_t verified = 0;
+    uint64_t mismatches = 0;
+};
+
+class ShadowVerifier {
+public:
+    explicit ShadowVerifier(const ShadowOptions& options = ShadowOptions());
+    ~ShadowVerifier();               // finishes queued checks, then joins the worker
+
+    ShadowVerifier(const ShadowVerifier&) = delete;
+    ShadowVerifier& operator=(const ShadowVerifier&) = delete;
+
+    // C += A*B by kernel; the call is checked in the background if sampled
+    void gemm(const char* kernel_name, const GemmFunction& kernel,
+              const Matrix& A, const Matrix& B, Matrix& C);
+
+    // Block until every queued check has finished
+    void flush();
+
+    ShadowStats stats() const;
+    std::vector<ShadowMismatch> mismatches() const;
+
+private:
+    struct Job {
+        std::string kernel;
+        uint64_t call;
+        Matrix A, B, C_before, C_after;
+    };
+
+    bool sample(uint64_t call) const;
+    void worker();
+    void check(const Job& job);
+
+    ShadowOptions options_;
+    uint64_t threshold_;             // sample when hash(call) < threshold_
+
+    mutable std::mutex mutex_;
+    std::condition_variable work_ready_, work_done_;
+    std::deque<Job> queue_;
+    int pending_ = 0;                // queued or being checked
+    bool stop_ = false;
+    std::atomic<uint64_t> calls_{0};
+    ShadowStats stats_;
+    std::vector<ShadowMismatch> mismatches_;
+    std::thread thread_;
+};
+
+// Freivalds' test of C_after - C_before = A*B with `probes` random vectors.
+// Returns true if every row is within its rounding bound; otherwise fills
+// *mismatch (kernel and call are left to the caller).
+bool freivalds_check(const Matrix& A, const Matrix& B, const Matrix& C_before,
+                     const Matrix& C_after, int probes, uint64_t seed,
+                     ShadowMismatch* mismatch);
+
+#endif // SHADOW_VERIFY_H
@@ -0,0 +1,237 @@
+#include <iostream>
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <vector>
+#include "shadow_verify.h"
+#include "../blocked_game/blocked_gemm.h"
+
+// gemm_ikj that corrupts C(m/2, n/2) on every call
+void gemm_faulty(const Matrix& A, const Matrix& B, Matrix& C) {
+    gemm_ikj(A, B, C);
+    C(C.m / 2, C.n / 2) += 1e-6;
+}
+
+// Correct products pass for awkward shapes; one bad entry, NaN or Inf fails
+// and the bad row is reported
+bool test_freivalds() {
+    std::cout << "Testing Freivalds check... ";
+
+    const std::vector<std::vector<int>> shapes = {
+        {1, 1, 1}, {7, 300, 5}, {100, 37, 130}, {64, 5000, 64}, {400, 400, 400}};
+    for (const auto& s : shapes) {
+        Matrix A(s[0], s[1]), B(s[1], s[2]), C0(s[0], s[2]);
+        A.fill_random();
+        B.fill_random();
+        C0.fill_random();
+        Matrix C = C0;
+        gemm_blocked(A, B, C, 64);
+        ShadowMismatch mm;
+        if (!freivalds_check(A, B, C0, C, 2, 1, &mm)) {
+            std::cout << "FAILED (false alarm at " << s[0] << "x" << s[1] << "x" << s[2]
+                      << ", residual " << mm.residual << " > " << mm.tolerance << ")\n";
+            return false;
+        }
+
+        const int i = s[0] / 3, j = s[2] - 1;
+        const double bad[] = {1e-6, std::numeric_limits<double>::quiet_NaN(),
+                              std::numeric_limits<double>::infinity()};
+        for (double v : bad) {
+            Matrix D = C;
+            D(i, j) = std::isfinite(v) ? D(i, j) + v : v;
+            if (freivalds_check(A, B, C0, D, 2, 1, &mm) || mm.row != i || mm.m != s[0] ||
+                mm.k != s[1] || mm.n != s[2]) {
+                std::cout << "FAILED (error " << v << " missed at " << s[0] << "x" << s[1] << "x"
+                          << s[2] << ")\n";
+                return false;
+            }
+        }
+    }
+
+    // Zero bound: all-zero operands, and zero rows of A over zero rows of C
+    Matrix Z(4, 4);
+    if (!freivalds_check(Z, Z, Z, Z, 2, 1, nullptr)) {
+        std::cout << "FAILED (false alarm on zero matrices)\n";
+        return false;
+    }
+    Matrix A(6, 5), B(5, 7), C0(6, 7);
+    A.fill_random();
+    B.fill_random();
+    C0.fill_random();
+    for (int p = 0; p < A.n; p++) A(2, p) = 0.0;
+    for (int j = 0; j < C0.n; j++) C0(2, j) = 0.0;
+    Matrix C = C0;
+    gemm_ikj(A, B, C);
+    ShadowMismatch mm;
+    if (!freivalds_check(A, B, C0, C, 2, 1, &mm)) {
+        std::cout << "FAILED (false alarm on a zero row, row " << mm.row << ")\n";
+        return false;
+    }
+    C(2, 3) = 1e-300;
+    if (freivalds_check(A, B, C0, C, 2, 1, &mm) || mm.row != 2) {
+        std::cout << "FAILED (error in a zero row missed)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// The sampled fraction follows sample_rate, and C is the kernel's result
+// whether or not the call was sampled
+bool test_sampling() {
+    std::cout << "Testing sample rate... ";
+
+    Matrix A(8, 8), B(8, 8);
+    A.fill_random();
+    B.fill_random();
+    Matrix expected(8, 8);
+    gemm_ikj(A, B, expected);
+
+    const double rates[] = {0.0, 0.1, 1.0};
+    const int calls = 5000;
+    for (double rate : rates) {
+        ShadowOptions opts;
+        opts.sample_rate = rate;
+        opts.max_pending = calls;
+        ShadowVerifier verifier(opts);
+        for (int c = 0; c < calls; c++) {
+            Matrix C(8, 8);
+            verifier.gemm("ikj", gemm_ikj, A, B, C);
+            if (C.data != expected.data) {
+                std::cout << "FAILED (C changed at rate " << rate << ")\n";
+                return false;
+            }
+        }
+        verifier.flush();
+        ShadowStats s = verifier.stats();
+        const double expected_samples = rate * calls;
+        if (s.calls != calls || s.dropped != 0 || s.verified != s.sampled || s.mismatches != 0 ||
+            std::abs(s.sampled - expected_samples) > 0.2 * expected_samples) {
+            std::cout << "FAILED (rate " << rate << ": " << s.sampled << " sampled)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// A kernel that gets one entry wrong is reported with its name, shape and
+// call index, through the handler and through mismatches()
+bool test_faulty_kernel() {
+    std::cout << "Testing faulty kernel is reported... ";
+
+    int handled = 0;
+    ShadowOptions opts;
+    opts.sample_rate = 1.0;
+    opts.on_mismatch = [&handled](const ShadowMismatch&) { handled++; };
+    ShadowVerifier verifier(opts);
+
+    Matrix A(60, 40), B(40, 50);
+    A.fill_random();
+    B.fill_random();
+    for (int c = 0; c < 3; c++) {
+        Matrix C(60, 50);
+        verifier.gemm("blocked_64", gemm_blocked_64, A, B, C);
+    }
+    Matrix C(60, 50);
+    verifier.gemm("faulty", gemm_faulty, A, B, C);
+    verifier.flush();
+
+    ShadowStats s = verifier.stats();
+    std::vector<ShadowMismatch> mm = verifier.mismatches();
+    if (s.verified != 4 || s.mismatches != 1 || handled != 1 || mm.size() != 1 ||
+        mm[0].kernel != "faulty" || mm[0].call != 3 || mm[0].row != 30 || mm[0].m != 60 ||
+        mm[0].k != 40 || mm[0].n != 50) {
+        std::cout << "FAILED (" << s.mismatches << " mismatches, " << handled << " handled)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// With no queue room every sample is dropped and the caller never waits
+bool test_dropped() {
+    std::cout << "Testing full queue drops samples... ";
+
+    ShadowOptions opts;
+    opts.sample_rate = 1.0;
+    opts.max_pending = 0;
+    ShadowVerifier verifier(opts);
+    Matrix A(10, 10), B(10, 10), C(10, 10);
+    A.fill_random();
+    B.fill_random();
+    for (int c = 0; c < 100; c++) verifier.gemm("faulty", gemm_faulty, A, B, C);
+    verifier.flush();
+
+    ShadowStats s = verifier.stats();
+    if (s.calls != 100 || s.dropped != 100 || s.sampled != 0 || s.verified != 0) {
+        std::cout << "FAILED (" << s.dropped << " dropped, " << s.sampled << " sampled)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Several caller threads share one verifier; every call is accounted for
+bool test_concurrent_callers() {
+    std::cout << "Testing concurrent callers... ";
+
+    ShadowOptions opts;
+    opts.sample_rate = 0.5;
+    opts.max_pending = 2;
+    ShadowVerifier verifier(opts);
+    Matrix A(50, 50), B(50, 50);
+    A.fill_random();
+    B.fill_random();
+
+    const int callers = 4, calls = 200;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < callers; t++) {
+        threads.emplace_back([&] {
+            for (int c = 0; c < calls; c++) {
+                Matrix C(50, 50);
+                verifier.gemm("blocked_32", gemm_blocked_32, A, B, C);
+            }
+        });
+    }
+    for (std::thread& t : threads) t.join();
+    verifier.flush();
+
+    ShadowStats s = verifier.stats();
+    if (s.calls != callers * calls || s.verified != s.sampled || s.mismatches != 0 ||
+        s.sampled == 0) {
+        std::cout << "FAILED (" << s.calls << " calls, " << s.sampled << " sampled, "
+                  << s.verified << " verified)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Shadow Verification\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_freivalds();
+    all_passed &= test_sampling();
+    all_passed &= test_faulty_kernel();
+    all_passed &= test_dropped();
+    all_passed &= test_concurrent_callers();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
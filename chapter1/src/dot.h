@@ -0,0 +1,38 @@
+#ifndef DOT_H
+#define DOT_H
+
+// Dot products of contiguous vectors for the kernels that reduce along a
+// row. A single running sum is a serial dependency chain the compiler may
+// not reorder without -ffast-math, so the loop would be latency-bound;
+// independent partial sums let it vectorize.
+
+// Four partial sums
+inline double dot(const double* x, const double* y, int len) {
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    int p = 0;
+    for (; p + 4 <= len; p += 4) {
+        s0 += x[p] * y[p];
+        s1 += x[p + 1] * y[p + 1];
+        s2 += x[p + 2] * y[p + 2];
+        s3 += x[p + 3] * y[p + 3];
+    }
+    for (; p < len; p++) s0 += x[p] * y[p];
+    return (s0 + s1) + (s2 + s3);
+}
+
+// Lanes partial sums, for long vectors where four do not cover the latency
+// of the adds across several vector registers
+template <int Lanes>
+inline double dot_lanes(const double* x, const double* y, int len) {
+    double s[Lanes] = {0.0};
+    int p = 0;
+    for (; p + Lanes <= len; p += Lanes) {
+        for (int l = 0; l < Lanes; l++) s[l] += x[p + l] * y[p + l];
+    }
+    double t = 0.0;
+    for (int l = 0; l < Lanes; l++) t += s[l];
+    for (; p < len; p++) t += x[p] * y[p];
+    return t;
+}
+
+#endif // DOT_H
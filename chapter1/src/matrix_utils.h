@@ -4,6 +4,9 @@
 #include <vector>
 #include <random>
 #include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 // Matrix class with row-major storage (C++ default)
 class Matrix {
@@ -32,8 +35,88 @@ public:
             val = dis(gen);
         }
     }
+
+    // Copy out the rows×cols block whose top-left corner is (r0, c0)
+    Matrix block(int r0, int c0, int rows, int cols) const {
+        Matrix B(rows, cols);
+        for (int i = 0; i < rows; i++) {
+            std::copy(&data[(r0 + i) * n + c0], &data[(r0 + i) * n + c0] + cols,
+                      &B.data[i * cols]);
+        }
+        return B;
+    }
+
+    // Write B back into the block whose top-left corner is (r0, c0)
+    void set_block(int r0, int c0, const Matrix& B) {
+        for (int i = 0; i < B.m; i++) {
+            std::copy(&B.data[i * B.n], &B.data[i * B.n] + B.n,
+                      &data[(r0 + i) * n + c0]);
+        }
+    }
+
+    // Explicit transpose - lets row-major kernels read both operands by row
+    Matrix transpose() const {
+        Matrix T(n, m);
+        for (int i = 0; i < m; i++) {
+            for (int j = 0; j < n; j++) {
+                T.data[j * m + i] = data[i * n + j];
+            }
+        }
+        return T;
+    }
 };
 
+// ============================================================================
+// Checks shared by the test programs
+// ============================================================================
+
+// max |A(i,j) - B(i,j)|, or infinity if the shapes differ
+inline double max_abs_diff(const Matrix& A, const Matrix& B) {
+    if (A.m != B.m || A.n != B.n) return std::numeric_limits<double>::infinity();
+    double d = 0.0;
+    for (size_t i = 0; i < A.data.size(); i++) d = std::max(d, std::abs(A.data[i] - B.data[i]));
+    return d;
+}
+
+// max |a(i) - b(i)|, or infinity if the lengths differ
+inline double max_abs_diff(const std::vector<double>& a, const std::vector<double>& b) {
+    if (a.size() != b.size()) return std::numeric_limits<double>::infinity();
+    double d = 0.0;
+    for (size_t i = 0; i < a.size(); i++) d = std::max(d, std::abs(a[i] - b[i]));
+    return d;
+}
+
+// ||Q^T*Q - I||_max
+inline double orthogonality_error(const Matrix& Q) {
+    const Matrix Qt = Q.transpose();
+    double d = 0.0;
+    for (int i = 0; i < Q.n; i++) {
+        for (int j = 0; j <= i; j++) {
+            double s = 0.0;
+            for (int k = 0; k < Q.m; k++) s += Qt(i, k) * Qt(j, k);
+            d = std::max(d, std::abs(s - (i == j ? 1.0 : 0.0)));
+        }
+    }
+    return d;
+}
+
+// Random symmetric positive definite n×n matrix, B*B^T + n*I
+inline Matrix random_spd(int n) {
+    Matrix B(n, n);
+    B.fill_random();
+    Matrix A(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j <= i; j++) {
+            double s = 0.0;
+            for (int k = 0; k < n; k++) s += B(i, k) * B(j, k);
+            A(i, j) = s;
+            A(j, i) = s;
+        }
+        A(i, i) += n;
+    }
+    return A;
+}
+
 // Benchmark configuration - groups shared test parameters
 struct BenchmarkConfig {
     const Matrix& A;
@@ -0,0 +1,23 @@
+#ifndef SPAN_OPS_H
+#define SPAN_OPS_H
+
+#include <algorithm>
+
+// In-place stages over a contiguous span c[0 .. len-1], for kernels that
+// apply a chain of cheap operations to a block while it is still in L1.
+// Each stage is its own loop, so each vectorizes on its own. The
+// parameters are passed by value, so stores to c cannot alias them.
+
+inline void scale_span(double* c, int len, double scale) {
+    for (int k = 0; k < len; k++) c[k] *= scale;
+}
+
+inline void shift_span(double* c, int len, double shift) {
+    for (int k = 0; k < len; k++) c[k] += shift;
+}
+
+inline void clamp_span(double* c, int len, double lo, double hi) {
+    for (int k = 0; k < len; k++) c[k] = std::min(std::max(c[k], lo), hi);
+}
+
+#endif // SPAN_OPS_H
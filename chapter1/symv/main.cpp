@@ -0,0 +1,78 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include "symv.h"
+#include "../row_v_col/gaxpy.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+void print_row(const char* label, double ms, double bytes) {
+    std::cout << "  " << std::left << std::setw(28) << label << std::right
+              << std::setw(10) << ms << " ms" << std::setw(10) << bytes / (ms * 1e6)
+              << " GB/s of A\n";
+}
+
+// y += A*x through the full matrix vs the lower triangle only
+void benchmark_size(int n, int iterations) {
+    Matrix A(n, n);
+    A.fill_random();
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < i; j++) A(j, i) = A(i, j);
+    }
+    std::vector<double> x(n, 1.0), y(n, 0.0);
+    Timer timer;
+
+    std::cout << "Matrix size: " << n << "×" << n << " (" << iterations << " iterations)\n";
+    std::cout << std::fixed << std::setprecision(3);
+
+    gaxpy_row_oriented(A, x, y);   // warm-up
+    timer.start();
+    for (int it = 0; it < iterations; it++) gaxpy_row_oriented(A, x, y);
+    double t_gaxpy = timer.elapsed_ms() / iterations;
+
+    symv_lower(A, x, y);
+    timer.start();
+    for (int it = 0; it < iterations; it++) symv_lower(A, x, y);
+    double t_symv = timer.elapsed_ms() / iterations;
+
+    const double full = 8.0 * n * n;
+    print_row("gaxpy_row_oriented:", t_gaxpy, full);
+    print_row("symv_lower:", t_symv, full / 2);
+    std::cout << "  " << std::left << std::setw(28) << "Speedup:" << std::right
+              << std::setw(10) << t_gaxpy / t_symv << "x\n\n";
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "================================================================\n";
+    std::cout << "SYMMETRIC MATRIX-VECTOR PRODUCT BENCHMARK\n";
+    std::cout << "Full gaxpy vs SYMV reading the lower triangle once\n";
+    std::cout << "================================================================\n";
+#ifdef _OPENMP
+    std::cout << "Threads: " << omp_get_max_threads() << "\n\n";
+#else
+    std::cout << "Threads: 1 (compiled without -fopenmp)\n\n";
+#endif
+
+    std::vector<int> sizes = {256, 1000, 2000, 4000};
+
+    // Usage: ./symv_bench [n]
+    if (argc > 1) sizes = {atoi(argv[1])};
+
+    for (int n : sizes) {
+        benchmark_size(n, std::max(5, static_cast<int>(4e8 / (double(n) * n))));
+    }
+
+    std::cout << "What to look for:\n";
+    std::cout << "  • Both kernels do 2n^2 flops; SYMV streams n^2/2 entries of A\n";
+    std::cout << "    instead of n^2, so once A leaves cache it is up to 2x faster\n";
+    std::cout << "  • While A fits in cache the two are close: SYMV does a dot and\n";
+    std::cout << "    an axpy per row instead of one dot\n";
+    std::cout << "  • Scaling with OMP_NUM_THREADS: bands of equal triangle area,\n";
+    std::cout << "    summed from per-thread copies of y\n";
+    std::cout << "Usage: " << argv[0] << " [n]\n";
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include "symv.h"
+#include "../src/dot.h"
+#include <algorithm>
+#include <cmath>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Below this order the per-thread copies of y cost more than they save
+static const int kParallelMin = 512;
+
+// Rows i0..i1-1 of the trailing submatrix, accumulated into y. The dot
+// product and the axpy are separate passes over the row: the second pass
+// reads it from L1, so A still comes from memory only once.
+static void symv_rows(const Matrix& A, int r0, int i0, int i1, const double* x, double* y) {
+    for (int i = i0; i < i1; i++) {
+        const double* a_row = &A(r0 + i, r0);
+        const double x_i = x[i];
+        const double y_i = dot(a_row, x, i);
+        for (int j = 0; j < i; j++) y[j] += a_row[j] * x_i;
+        y[i] += y_i + a_row[i] * x_i;
+    }
+}
+
+void symv_lower(const Matrix& A, int r0, const double* x, double* y) {
+    const int len = A.n - r0;
+    if (len <= 0) return;
+
+#ifdef _OPENMP
+    const int threads = len >= kParallelMin ? omp_get_max_threads() : 1;
+#else
+    const int threads = 1;
+#endif
+    if (threads == 1) {
+        symv_rows(A, r0, 0, len, x, y);
+        return;
+    }
+
+#ifdef _OPENMP
+    std::vector<double> partial(static_cast<size_t>(threads) * len, 0.0);
+    #pragma omp parallel num_threads(threads)
+    {
+        // Band t ends at row len*sqrt((t+1)/T): every band holds 1/T of the triangle
+        const int T = omp_get_num_threads();
+        const int t = omp_get_thread_num();
+        const int i0 = static_cast<int>(len * std::sqrt(static_cast<double>(t) / T));
+        const int i1 = t == T - 1 ? len
+                                  : static_cast<int>(len * std::sqrt(static_cast<double>(t + 1) / T));
+        symv_rows(A, r0, i0, i1, x, &partial[static_cast<size_t>(t) * len]);
+        #pragma omp barrier
+
+        #pragma omp for schedule(static)
+        for (int i = 0; i < len; i++) {
+            double s = 0.0;
+            for (int q = 0; q < T; q++) s += partial[static_cast<size_t>(q) * len + i];
+            y[i] += s;
+        }
+    }
+#endif
+}
+
+void symv_lower(const Matrix& A, const std::vector<double>& x, std::vector<double>& y) {
+    symv_lower(A, 0, x.data(), y.data());
+}
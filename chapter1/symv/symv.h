@@ -0,0 +1,31 @@
+#ifndef SYMV_H
+#define SYMV_H
+
+#include <vector>
+#include "../src/matrix_utils.h"
+
+// Symmetric matrix-vector product y = y + A*x (BLAS xSYMV, uplo = 'L')
+// Golub & Van Loan Section 1.2.7
+//
+// Only the lower triangle of A is read; the strict upper triangle may hold
+// anything. Row i of the lower triangle is contiguous in row-major storage
+// and serves both as row i and as column i of A:
+//
+//   for i:  y(i)   += A(i, 0:i) . x(0:i) + A(i,i) x(i)     (dot product)
+//           y(0:i) += x(i) * A(i, 0:i)^T                   (axpy)
+//
+// so each off-diagonal entry is loaded once and used twice, and A is
+// streamed exactly once: half the memory traffic of a general gaxpy.
+//
+// With OpenMP the rows are split into bands of equal triangle area. Every
+// thread accumulates into its own copy of y (the axpy writes rows above its
+// band), and the copies are summed at the end.
+
+// y = y + A(r0:n, r0:n) * x(0:n-r0) for the trailing principal submatrix
+// starting at (r0, r0); x and y have n - r0 entries
+void symv_lower(const Matrix& A, int r0, const double* x, double* y);
+
+// y = y + A*x, gaxpy-style interface
+void symv_lower(const Matrix& A, const std::vector<double>& x, std::vector<double>& y);
+
+#endif // SYMV_H
@@ -0,0 +1,129 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include "symv.h"
+#include "../row_v_col/gaxpy.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Random symmetric n×n matrix
+Matrix random_symmetric(int n) {
+    Matrix A(n, n);
+    A.fill_random();
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < i; j++) A(j, i) = A(i, j);
+    }
+    return A;
+}
+
+// Same matrix with the strict upper triangle overwritten: symv must not read it
+Matrix poison_upper(const Matrix& A) {
+    Matrix B = A;
+    for (int i = 0; i < B.n; i++) {
+        for (int j = i + 1; j < B.n; j++) B(i, j) = NAN;
+    }
+    return B;
+}
+
+bool test_against_gaxpy() {
+    std::cout << "Testing symv_lower against gaxpy_row_oriented... ";
+
+    // Sizes on both sides of the parallel threshold
+    for (int n : {1, 2, 7, 100, 600, 1000}) {
+        Matrix A = random_symmetric(n);
+        Matrix L = poison_upper(A);
+        std::vector<double> x(n), y0(n);
+        for (int i = 0; i < n; i++) {
+            x[i] = std::sin(0.3 * i);
+            y0[i] = std::cos(0.7 * i);
+        }
+
+        // Accumulates into y like gaxpy
+        std::vector<double> y_ref = y0, y = y0;
+        gaxpy_row_oriented(A, x, y_ref);
+        symv_lower(L, x, y);
+        if (!(max_abs_diff(y, y_ref) <= 1e-12 * n)) {
+            std::cout << "FAILED (n=" << n << ", diff=" << max_abs_diff(y, y_ref) << ")\n";
+            return false;
+        }
+    }
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Trailing principal submatrices, as used by tridiagonalization
+bool test_trailing_submatrix() {
+    std::cout << "Testing trailing submatrix offsets... ";
+
+    const int n = 700;
+    Matrix A = random_symmetric(n);
+    Matrix L = poison_upper(A);
+    for (int r0 : {0, 1, 150, 699}) {
+        const int len = n - r0;
+        Matrix S = A.block(r0, r0, len, len);
+        std::vector<double> x(len, 0.0), y_ref(len, 0.0), y(len, 0.0);
+        for (int i = 0; i < len; i++) x[i] = 1.0 / (i + 1);
+        gaxpy_row_oriented(S, x, y_ref);
+        symv_lower(L, r0, x.data(), y.data());
+        if (!(max_abs_diff(y, y_ref) <= 1e-12 * n)) {
+            std::cout << "FAILED (r0=" << r0 << ")\n";
+            return false;
+        }
+    }
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Uneven bands and more threads than cores give the same result
+bool test_thread_counts() {
+    std::cout << "Testing per-thread partial results... ";
+
+#ifdef _OPENMP
+    const int n = 1500;
+    Matrix A = random_symmetric(n);
+    std::vector<double> x(n);
+    for (int i = 0; i < n; i++) x[i] = std::sin(1.0 + i);
+    std::vector<double> y_ref(n, 0.0);
+    gaxpy_row_oriented(A, x, y_ref);
+
+    const int saved = omp_get_max_threads();
+    for (int threads : {1, 2, 3, 8}) {
+        omp_set_num_threads(threads);
+        std::vector<double> y(n, 0.0);
+        symv_lower(A, x, y);
+        if (!(max_abs_diff(y, y_ref) <= 1e-12 * n)) {
+            omp_set_num_threads(saved);
+            std::cout << "FAILED (" << threads << " threads)\n";
+            return false;
+        }
+    }
+    omp_set_num_threads(saved);
+    std::cout << "PASSED ✓\n";
+#else
+    std::cout << "SKIPPED (compiled without -fopenmp)\n";
+#endif
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Symmetric Matrix-Vector Product\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_against_gaxpy();
+    all_passed &= test_trailing_submatrix();
+    all_passed &= test_thread_counts();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
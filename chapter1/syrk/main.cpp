@@ -0,0 +1,79 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include "syrk.h"
+#include "../blocked_game/blocked_gemm.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+void print_row(const char* label, double ms, double flops) {
+    std::cout << "  " << std::left << std::setw(28) << label << std::right
+              << std::setw(10) << ms << " ms" << std::setw(10) << flops / (ms * 1e6)
+              << " GFLOPS\n";
+}
+
+// Gram matrix A^T*A of an m×n matrix: full GEMM vs one triangle
+void benchmark_size(int m, int n, int block_size) {
+    Matrix A(m, n);
+    A.fill_random();
+    Timer timer;
+
+    std::cout << "A^T*A, A is " << m << "×" << n << " (block_size=" << block_size << ")\n";
+    std::cout << std::fixed << std::setprecision(3);
+
+    // GEMM needs the explicit transpose; it is part of the cost
+    Matrix C_gemm(n, n);
+    timer.start();
+    Matrix At = A.transpose();
+    gemm_blocked(At, A, C_gemm, block_size);
+    double t_gemm = timer.elapsed_ms();
+
+    Matrix C_syrk(n, n);
+    timer.start();
+    syrk(A, C_syrk, 1.0, Triangle::Lower, true, block_size);
+    double t_syrk = timer.elapsed_ms();
+
+    // Useful work is the same for both: one triangle
+    const double flops = syrk_flops(n, m);
+    print_row("gemm_blocked (full C):", t_gemm, flops);
+    print_row("syrk (lower triangle):", t_syrk, flops);
+    std::cout << "  " << std::left << std::setw(28) << "Speedup:" << std::right
+              << std::setw(10) << t_gemm / t_syrk << "x\n\n";
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "================================================================\n";
+    std::cout << "SYMMETRIC RANK-K UPDATE BENCHMARK\n";
+    std::cout << "Gram matrix through a full GEMM vs SYRK on one triangle\n";
+    std::cout << "================================================================\n";
+#ifdef _OPENMP
+    std::cout << "Threads: " << omp_get_max_threads() << "\n\n";
+#else
+    std::cout << "Threads: 1 (compiled without -fopenmp)\n\n";
+#endif
+
+    std::vector<std::pair<int, int>> sizes = {{512, 512}, {4000, 500}, {1500, 1500}};
+    int block_size = 64;
+
+    // Usage: ./syrk_bench [m n] [block_size]
+    if (argc > 2) sizes = {{atoi(argv[1]), atoi(argv[2])}};
+    if (argc > 3) block_size = atoi(argv[3]);
+
+    for (auto [m, n] : sizes) {
+        benchmark_size(m, n, block_size);
+    }
+
+    std::cout << "What to look for:\n";
+    std::cout << "  • GFLOPS count the useful n(n+1)m flops for both, so the GEMM\n";
+    std::cout << "    column shows half its real rate and SYRK approaches 2x\n";
+    std::cout << "  • Off-diagonal tiles run the GEMM block kernel unchanged; the\n";
+    std::cout << "    diagonal tiles (block_size/n of the work) run a clipped loop\n";
+    std::cout << "  • The gap grows with n/block_size: diagonal tiles are one per\n";
+    std::cout << "    block row, off-diagonal tiles grow quadratically\n";
+    std::cout << "Usage: " << argv[0] << " [m n] [block_size]\n";
+
+    return 0;
+}
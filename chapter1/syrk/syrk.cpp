@@ -0,0 +1,76 @@
+#include "syrk.h"
+#include "../blocked_game/blocked_gemm.h"
+#include <algorithm>
+
+// ============================================================================
+// DIAGONAL TILE: C(ii:i_max, ii:i_max) += L(ii:i_max, kk:k_max) * R(kk:k_max, ii:i_max)
+// for the entries on and below (Lower) or on and above (Upper) the diagonal.
+// Same ikj order as the GEMM kernel, with the j range clipped at i.
+// ============================================================================
+static void diagonal_tile(const Matrix& L, const Matrix& R, Matrix& C, Triangle uplo,
+                          int ii, int kk, int i_max, int k_max) {
+    for (int i = ii; i < i_max; i++) {
+        const int j0 = uplo == Triangle::Lower ? ii : i;
+        const int j1 = uplo == Triangle::Lower ? i + 1 : i_max;
+        double* c_row = &C(i, 0);
+        for (int k = kk; k < k_max; k++) {
+            const double l = L(i, k);
+            const double* r_row = &R(k, 0);
+            for (int j = j0; j < j1; j++) c_row[j] += l * r_row[j];
+        }
+    }
+}
+
+// ============================================================================
+// BLOCKED SYRK
+// C += L * R with L = alpha * op(A) (n×k) and R = op(A)^T (k×n), both held
+// row-major so the GEMM kernel reads each of them by row.
+// ============================================================================
+void syrk(const Matrix& A, Matrix& C, double alpha, Triangle uplo, bool transpose,
+          int block_size) {
+    Matrix L = transpose ? A.transpose() : A;
+    Matrix R = L.transpose();
+    if (alpha != 1.0) {
+        for (auto& x : L.data) x *= alpha;
+    }
+    syrk_operands(L, R, C, uplo, block_size);
+}
+
+void syrk_operands(const Matrix& L, const Matrix& R, Matrix& C, Triangle uplo, int block_size) {
+    const int n = L.m;
+    const int k = L.n;
+    if (n == 0 || k == 0) return;
+
+    const int blocks = (n + block_size - 1) / block_size;
+
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (int bi = 0; bi < blocks; bi++) {
+        const int ii = bi * block_size;
+        const int i_max = std::min(ii + block_size, n);
+        const int bj0 = uplo == Triangle::Lower ? 0 : bi + 1;
+        const int bj1 = uplo == Triangle::Lower ? bi : blocks;
+
+        for (int kk = 0; kk < k; kk += block_size) {
+            const int k_max = std::min(kk + block_size, k);
+            for (int bj = bj0; bj < bj1; bj++) {
+                const int jj = bj * block_size;
+                const int j_max = std::min(jj + block_size, n);
+                inner_block_outer_loop(L, R, C, ii, kk, jj, i_max, j_max, k_max);
+            }
+            diagonal_tile(L, R, C, uplo, ii, kk, i_max, k_max);
+        }
+    }
+}
+
+void symmetrize(Matrix& C, Triangle from) {
+    for (int i = 0; i < C.n; i++) {
+        for (int j = 0; j < i; j++) {
+            if (from == Triangle::Lower) C(j, i) = C(i, j);
+            else C(i, j) = C(j, i);
+        }
+    }
+}
+
+double syrk_flops(int n, int k) {
+    return static_cast<double>(n) * (n + 1) * k;
+}
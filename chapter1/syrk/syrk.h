@@ -0,0 +1,37 @@
+#ifndef SYRK_H
+#define SYRK_H
+
+#include "../src/matrix_utils.h"
+
+// Symmetric rank-k update (BLAS xSYRK), Golub & Van Loan Section 1.3
+//
+//   C = C + alpha * A * A^T      (transpose = false, A is n×k)
+//   C = C + alpha * A^T * A      (transpose = true,  A is k×n)
+//
+// C is n×n and symmetric, so only one triangle is computed; the other is
+// never read or written. The triangle is cut into block_size tiles:
+// off-diagonal tiles go through the block kernel of gemm_blocked, and
+// diagonal tiles run the same ikj loop with the inner loop stopped at the
+// diagonal. That is n^2 k flops instead of the 2 n^2 k of a full GEMM.
+//
+// With OpenMP the block rows of C are shared out dynamically: a block row
+// of the lower triangle holds one tile more than the row above it, and no
+// two block rows write the same entries.
+
+enum class Triangle { Lower, Upper };
+
+void syrk(const Matrix& A, Matrix& C, double alpha, Triangle uplo, bool transpose,
+          int block_size);
+
+// The blocked kernel behind syrk, for callers that already hold both
+// operands row-major: C += L * R with L n×k and R = L^T (k×n). No copies
+// are made; scale L for alpha != 1.
+void syrk_operands(const Matrix& L, const Matrix& R, Matrix& C, Triangle uplo, int block_size);
+
+// Copy the computed triangle of C onto the other one
+void symmetrize(Matrix& C, Triangle from);
+
+// Flop count of syrk on an n×n result with inner dimension k (n(n+1)k)
+double syrk_flops(int n, int k);
+
+#endif // SYRK_H
@@ -0,0 +1,135 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "syrk.h"
+#include "../blocked_game/blocked_gemm.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// C0 + alpha * op(A) * op(A)^T through a full GEMM
+Matrix reference(const Matrix& A, const Matrix& C0, double alpha, bool transpose) {
+    Matrix L = transpose ? A.transpose() : A;
+    Matrix R = L.transpose();
+    Matrix P(L.m, L.m);
+    gemm_ikj(L, R, P);
+    Matrix C = C0;
+    for (size_t i = 0; i < C.data.size(); i++) C.data[i] += alpha * P.data[i];
+    return C;
+}
+
+// Checks the computed triangle against the reference and that the other
+// triangle still holds NaN (never read, never written)
+bool check_triangle(const Matrix& C, const Matrix& ref, Triangle uplo, double tol) {
+    for (int i = 0; i < C.n; i++) {
+        for (int j = 0; j < C.n; j++) {
+            bool computed = uplo == Triangle::Lower ? j <= i : j >= i;
+            if (computed && !(std::abs(C(i, j) - ref(i, j)) <= tol)) return false;
+            if (!computed && !std::isnan(C(i, j))) return false;
+        }
+    }
+    return true;
+}
+
+bool test_against_gemm() {
+    std::cout << "Testing syrk against a full GEMM... ";
+
+    for (auto [n, k] : {std::pair{1, 1}, {5, 3}, {64, 64}, {100, 37}, {37, 100}, {200, 150}}) {
+        for (bool transpose : {false, true}) {
+            Matrix A = transpose ? Matrix(k, n) : Matrix(n, k);
+            A.fill_random();
+            Matrix C0(n, n);
+            C0.fill_random();
+            for (int i = 0; i < n; i++) {
+                for (int j = 0; j < i; j++) C0(j, i) = C0(i, j);
+            }
+
+            for (Triangle uplo : {Triangle::Lower, Triangle::Upper}) {
+                for (double alpha : {1.0, -0.5}) {
+                    Matrix ref = reference(A, C0, alpha, transpose);
+                    for (int block_size : {8, 32, 64}) {
+                        Matrix C = C0;
+                        for (int i = 0; i < n; i++) {
+                            for (int j = 0; j < n; j++) {
+                                if (uplo == Triangle::Lower ? j > i : j < i) C(i, j) = NAN;
+                            }
+                        }
+                        syrk(A, C, alpha, uplo, transpose, block_size);
+                        if (!check_triangle(C, ref, uplo, 1e-12 * k)) {
+                            std::cout << "FAILED (" << n << "x" << k
+                                      << (transpose ? ", A^T*A" : ", A*A^T")
+                                      << (uplo == Triangle::Lower ? ", lower" : ", upper")
+                                      << ", alpha=" << alpha << ", block=" << block_size << ")\n";
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// symmetrize fills the other triangle; uneven block rows per thread and
+// more threads than cores give the same result
+bool test_symmetrize_and_threads() {
+    std::cout << "Testing symmetrize and thread counts... ";
+
+    const int n = 300, k = 120;
+    Matrix A(n, k);
+    A.fill_random();
+    Matrix ref = reference(A, Matrix(n, n), 1.0, false);
+
+    std::vector<int> thread_counts = {1};
+#ifdef _OPENMP
+    const int saved = omp_get_max_threads();
+    thread_counts = {1, 2, 3, 8};
+#endif
+    for (int threads : thread_counts) {
+#ifdef _OPENMP
+        omp_set_num_threads(threads);
+#endif
+        for (Triangle uplo : {Triangle::Lower, Triangle::Upper}) {
+            Matrix C(n, n);
+            syrk(A, C, 1.0, uplo, false, 64);
+            symmetrize(C, uplo);
+            for (size_t i = 0; i < C.data.size(); i++) {
+                if (std::abs(C.data[i] - ref.data[i]) > 1e-12 * k) {
+                    std::cout << "FAILED (" << threads << " threads, "
+                              << (uplo == Triangle::Lower ? "lower" : "upper") << ")\n";
+                    return false;
+                }
+            }
+        }
+    }
+#ifdef _OPENMP
+    omp_set_num_threads(saved);
+#endif
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Symmetric Rank-k Update (SYRK)\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_against_gemm();
+    all_passed &= test_symmetrize_and_threads();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
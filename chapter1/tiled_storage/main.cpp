@@ -0,0 +1,104 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include "tiled_matrix.h"
+#include "../blocked_game/blocked_gemm.h"
+#include "../row_v_col/gaxpy.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+void print_row(const char* label, double ms, double flops, double baseline_ms) {
+    std::cout << "  " << std::left << std::setw(28) << label << std::right
+              << std::setw(10) << ms << " ms" << std::setw(9) << flops / (ms * 1e6)
+              << " GFLOPS" << std::setw(8) << baseline_ms / ms << "x\n";
+}
+
+// Row-major gemm_blocked against gemm_tiled on both tile orders, same tile
+// size, plus what converting in and out costs
+void benchmark_size(int n, int tile) {
+    Matrix A(n, n), B(n, n);
+    A.fill_random();
+    B.fill_random();
+    Timer timer;
+    const double gemm_flops = 2.0 * n * n * n;
+
+    std::cout << "Matrix size: " << n << "×" << n << " (tile=" << tile << ")\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    Matrix C(n, n);
+    timer.start();
+    gemm_blocked(A, B, C, tile);
+    const double t_blocked = timer.elapsed_ms();
+    print_row("gemm_blocked (row-major):", t_blocked, gemm_flops, t_blocked);
+
+    for (TileOrder order : {TileOrder::RowMajor, TileOrder::Morton}) {
+        timer.start();
+        TiledMatrix At = to_tiled(A, tile, order), Bt = to_tiled(B, tile, order);
+        TiledMatrix Ct(n, n, tile, order);
+        const double t_in = timer.elapsed_ms();
+        timer.start();
+        gemm_tiled(At, Bt, Ct);
+        const double t_gemm = timer.elapsed_ms();
+        timer.start();
+        Matrix back = from_tiled(Ct);
+        const double t_out = timer.elapsed_ms();
+
+        print_row(order == TileOrder::Morton ? "gemm_tiled (Morton):" : "gemm_tiled (row of tiles):",
+                  t_gemm, gemm_flops, t_blocked);
+        std::cout << "    conversion in " << t_in << " ms, out " << t_out << " ms\n";
+    }
+
+    // gaxpy: one pass over A, repeated so it is measurable
+    std::vector<double> x(n, 1.0), y(n, 0.0);
+    const int reps = 20;
+    const double gaxpy_flops = 2.0 * n * n * reps;
+    timer.start();
+    for (int r = 0; r < reps; r++) gaxpy_row_oriented(A, x, y);
+    const double t_row = timer.elapsed_ms();
+    print_row("gaxpy_row_oriented:", t_row, gaxpy_flops, t_row);
+    for (TileOrder order : {TileOrder::RowMajor, TileOrder::Morton}) {
+        TiledMatrix At = to_tiled(A, tile, order);
+        timer.start();
+        for (int r = 0; r < reps; r++) gaxpy_tiled(At, x, y);
+        print_row(order == TileOrder::Morton ? "gaxpy_tiled (Morton):" : "gaxpy_tiled (row of tiles):",
+                  timer.elapsed_ms(), gaxpy_flops, t_row);
+    }
+    std::cout << "\n";
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "================================================================\n";
+    std::cout << "TILED STORAGE BENCHMARK\n";
+    std::cout << "Contiguous tiles (row or Morton order) vs row-major Matrix\n";
+    std::cout << "================================================================\n";
+#ifdef _OPENMP
+    std::cout << "Threads: " << omp_get_max_threads() << "\n\n";
+#else
+    std::cout << "Threads: 1 (compiled without -fopenmp)\n\n";
+#endif
+
+    std::vector<int> sizes = {500, 1000, 2000, 2048};
+    int tile = 64;
+
+    // Usage: ./tiled_bench [n] [tile]
+    if (argc > 1) sizes = {atoi(argv[1])};
+    if (argc > 2) tile = atoi(argv[2]);
+
+    for (int n : sizes) {
+        benchmark_size(n, tile);
+    }
+
+    std::cout << "What to look for:\n";
+    std::cout << "  • gemm_tiled beats gemm_blocked at the same tile size: each\n";
+    std::cout << "    tile is one contiguous run, and the kernel has fixed trip counts\n";
+    std::cout << "  • n = 2048 is the worst case for row-major: rows 16 KB apart\n";
+    std::cout << "    map to the same cache sets; tiles do not\n";
+    std::cout << "  • Conversion is one copy of each operand, a few percent of a\n";
+    std::cout << "    multiply, and is paid once if the data stays tiled\n";
+    std::cout << "Usage: " << argv[0] << " [n] [tile]\n";
+
+    return 0;
+}
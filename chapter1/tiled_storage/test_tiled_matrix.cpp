@@ -0,0 +1,226 @@
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include "tiled_matrix.h"
+#include "../blocked_game/blocked_gemm.h"
+#include "../row_v_col/gaxpy.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// to_tiled / from_tiled round trip exactly, element access agrees with the
+// source, and the padding of edge tiles is zero
+bool test_conversion() {
+    std::cout << "Testing conversion round trip... ";
+
+    const std::vector<std::vector<int>> shapes = {{1, 1}, {64, 64}, {100, 37}, {37, 200}, {129, 130}};
+    for (const auto& s : shapes) {
+        Matrix A(s[0], s[1]);
+        A.fill_random();
+        for (TileOrder order : {TileOrder::RowMajor, TileOrder::Morton}) {
+            TiledMatrix T = to_tiled(A, 32, order);
+            if (from_tiled(T).data != A.data) {
+                std::cout << "FAILED (round trip " << s[0] << "x" << s[1] << ")\n";
+                return false;
+            }
+            // The padded grid: entries outside A must be zero
+            for (int i = 0; i < T.tiles_m * T.tile; i++) {
+                for (int j = 0; j < T.tiles_n * T.tile; j++) {
+                    const bool inside = i < A.m && j < A.n;
+                    if (T(i, j) != (inside ? A(i, j) : 0.0)) {
+                        std::cout << "FAILED (T(" << i << ", " << j << "))\n";
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Storage order: row by row, or Z-shaped with quadrants contiguous; every
+// tile has exactly one slot
+bool test_tile_order() {
+    std::cout << "Testing tile orders... ";
+
+    TiledMatrix R(4 * 8, 4 * 8, 8, TileOrder::RowMajor);
+    TiledMatrix Z(4 * 8, 4 * 8, 8, TileOrder::Morton);
+    // Z curve on a 4×4 grid
+    const int expected[4][4] = {{0, 1, 4, 5}, {2, 3, 6, 7}, {8, 9, 12, 13}, {10, 11, 14, 15}};
+    for (int I = 0; I < 4; I++) {
+        for (int J = 0; J < 4; J++) {
+            if (R.tile_rank(I, J) != I * 4 + J || Z.tile_rank(I, J) != expected[I][J]) {
+                std::cout << "FAILED (rank of tile (" << I << ", " << J << "))\n";
+                return false;
+            }
+        }
+    }
+
+    // Non-power-of-two grid: ranks are a permutation and coordinates invert them
+    TiledMatrix W(5 * 16, 3 * 16 - 5, 16, TileOrder::Morton);
+    std::vector<int> seen(W.tiles_m * W.tiles_n, 0);
+    for (int I = 0; I < W.tiles_m; I++) {
+        for (int J = 0; J < W.tiles_n; J++) {
+            const int r = W.tile_rank(I, J);
+            seen[r]++;
+            if (W.tile_row_at(r) != I || W.tile_col_at(r) != J) {
+                std::cout << "FAILED (coordinates of rank " << r << ")\n";
+                return false;
+            }
+        }
+    }
+    for (int count : seen) {
+        if (count != 1) {
+            std::cout << "FAILED (ranks not a permutation)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// gemm_tiled matches gemm_ikj for edge tiles, every tile size with a
+// specialized kernel and one without, and mixed tile orders
+bool test_gemm() {
+    std::cout << "Testing gemm_tiled vs gemm_ikj... ";
+
+    const std::vector<std::vector<int>> shapes = {
+        {1, 1, 1}, {64, 64, 64}, {100, 37, 130}, {33, 200, 17}, {150, 150, 150}};
+    const int tiles[] = {16, 24, 32, 64, 128};
+    const TileOrder orders[] = {TileOrder::RowMajor, TileOrder::Morton};
+    for (const auto& s : shapes) {
+        Matrix A(s[0], s[1]), B(s[1], s[2]), C0(s[0], s[2]);
+        A.fill_random();
+        B.fill_random();
+        C0.fill_random();
+        Matrix ref = C0;
+        gemm_ikj(A, B, ref);
+        for (int tile : tiles) {
+            for (TileOrder oa : orders) {
+                for (TileOrder oc : orders) {
+                    TiledMatrix At = to_tiled(A, tile, oa), Bt = to_tiled(B, tile, oc);
+                    TiledMatrix Ct = to_tiled(C0, tile, oc);
+                    if (!gemm_tiled(At, Bt, Ct) ||
+                        max_abs_diff(from_tiled(Ct), ref) > 1e-12 * s[1]) {
+                        std::cout << "FAILED (" << s[0] << "x" << s[1] << "x" << s[2]
+                                  << ", tile " << tile << ")\n";
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    // Mismatched tile sizes and shapes are refused, C untouched
+    Matrix A(40, 40), B(40, 40);
+    A.fill_random();
+    B.fill_random();
+    TiledMatrix At = to_tiled(A, 16, TileOrder::RowMajor), Bt = to_tiled(B, 32, TileOrder::RowMajor);
+    TiledMatrix Ct(40, 40, 16), Dt(40, 41, 16);
+    if (gemm_tiled(At, Bt, Ct) || gemm_tiled(At, At, Dt) || from_tiled(Ct).data != Matrix(40, 40).data) {
+        std::cout << "FAILED (mismatch accepted)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// gaxpy_tiled matches the row-oriented gaxpy
+bool test_gaxpy() {
+    std::cout << "Testing gaxpy_tiled vs gaxpy_row_oriented... ";
+
+    const std::vector<std::vector<int>> shapes = {{1, 1}, {64, 64}, {100, 37}, {37, 200}, {300, 300}};
+    for (const auto& s : shapes) {
+        Matrix A(s[0], s[1]);
+        A.fill_random();
+        std::vector<double> x(s[1]), y0(s[0]);
+        for (int j = 0; j < s[1]; j++) x[j] = std::sin(j + 1.0);
+        for (int i = 0; i < s[0]; i++) y0[i] = std::cos(i + 1.0);
+        std::vector<double> ref = y0;
+        gaxpy_row_oriented(A, x, ref);
+        for (TileOrder order : {TileOrder::RowMajor, TileOrder::Morton}) {
+            TiledMatrix T = to_tiled(A, 32, order);
+            std::vector<double> y = y0;
+            if (!gaxpy_tiled(T, x, y)) {
+                std::cout << "FAILED (refused " << s[0] << "x" << s[1] << ")\n";
+                return false;
+            }
+            for (int i = 0; i < s[0]; i++) {
+                if (std::abs(y[i] - ref[i]) > 1e-12 * s[1]) {
+                    std::cout << "FAILED (" << s[0] << "x" << s[1] << ", y[" << i << "])\n";
+                    return false;
+                }
+            }
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Same result for every thread count
+bool test_thread_counts() {
+    std::cout << "Testing thread counts... ";
+
+    const int n = 300;
+    Matrix A(n, n), B(n, n);
+    A.fill_random();
+    B.fill_random();
+    Matrix ref(n, n);
+    gemm_ikj(A, B, ref);
+    TiledMatrix At = to_tiled(A, 64, TileOrder::Morton), Bt = to_tiled(B, 64, TileOrder::Morton);
+
+    std::vector<int> thread_counts = {1};
+#ifdef _OPENMP
+    const int saved = omp_get_max_threads();
+    thread_counts = {1, 2, 3, 8};
+#endif
+    for (int threads : thread_counts) {
+#ifdef _OPENMP
+        omp_set_num_threads(threads);
+#endif
+        TiledMatrix Ct(n, n, 64, TileOrder::Morton);
+        gemm_tiled(At, Bt, Ct);
+        if (max_abs_diff(from_tiled(Ct), ref) > 1e-12 * n) {
+            std::cout << "FAILED (" << threads << " threads)\n";
+#ifdef _OPENMP
+            omp_set_num_threads(saved);
+#endif
+            return false;
+        }
+    }
+#ifdef _OPENMP
+    omp_set_num_threads(saved);
+#endif
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Tiled Matrix Storage\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_conversion();
+    all_passed &= test_tile_order();
+    all_passed &= test_gemm();
+    all_passed &= test_gaxpy();
+    all_passed &= test_thread_counts();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
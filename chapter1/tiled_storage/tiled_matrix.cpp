@@ -0,0 +1,169 @@
+#include "tiled_matrix.h"
+#include <algorithm>
+#include <cstdint>
+
+// Interleave the bits of I and J: ... i1 j1 i0 j0
+static uint64_t morton_key(uint32_t I, uint32_t J) {
+    uint64_t key = 0;
+    for (int bit = 0; bit < 32; bit++) {
+        key |= static_cast<uint64_t>((I >> bit) & 1u) << (2 * bit + 1);
+        key |= static_cast<uint64_t>((J >> bit) & 1u) << (2 * bit);
+    }
+    return key;
+}
+
+// ============================================================================
+// LAYOUT
+//
+// Morton order on a grid that is not a power of two is the Z curve of the
+// enclosing power-of-two grid with the missing tiles skipped: tiles are
+// sorted by key and stored densely.
+// ============================================================================
+TiledMatrix::TiledMatrix(int rows, int cols, int tile_size, TileOrder tile_order)
+    : m(rows), n(cols), tile(tile_size),
+      tiles_m((rows + tile_size - 1) / tile_size),
+      tiles_n((cols + tile_size - 1) / tile_size),
+      order(tile_order),
+      data(static_cast<size_t>(tiles_m) * tiles_n * tile_size * tile_size),
+      rank_(static_cast<size_t>(tiles_m) * tiles_n),
+      coords_(static_cast<size_t>(tiles_m) * tiles_n) {
+    for (size_t t = 0; t < coords_.size(); t++) coords_[t] = static_cast<int>(t);
+    if (order == TileOrder::Morton) {
+        const int tn = tiles_n;
+        std::sort(coords_.begin(), coords_.end(), [tn](int a, int b) {
+            return morton_key(a / tn, a % tn) < morton_key(b / tn, b % tn);
+        });
+    }
+    for (size_t r = 0; r < coords_.size(); r++) rank_[coords_[r]] = static_cast<int>(r);
+}
+
+// ============================================================================
+// CONVERSIONS: one tile row segment at a time
+// ============================================================================
+TiledMatrix to_tiled(const Matrix& A, int tile, TileOrder order) {
+    TiledMatrix T(A.m, A.n, tile, order);
+    for (int I = 0; I < T.tiles_m; I++) {
+        const int rows = std::min(tile, A.m - I * tile);
+        for (int J = 0; J < T.tiles_n; J++) {
+            const int cols = std::min(tile, A.n - J * tile);
+            double* t = T.tile_data(I, J);
+            for (int i = 0; i < rows; i++) {
+                const double* a = &A.data[static_cast<size_t>(I * tile + i) * A.n + J * tile];
+                std::copy(a, a + cols, t + i * tile);
+            }
+        }
+    }
+    return T;
+}
+
+Matrix from_tiled(const TiledMatrix& T) {
+    Matrix A(T.m, T.n);
+    const int tile = T.tile;
+    for (int I = 0; I < T.tiles_m; I++) {
+        const int rows = std::min(tile, T.m - I * tile);
+        for (int J = 0; J < T.tiles_n; J++) {
+            const int cols = std::min(tile, T.n - J * tile);
+            const double* t = T.tile_data(I, J);
+            for (int i = 0; i < rows; i++) {
+                std::copy(t + i * tile, t + i * tile + cols,
+                          &A.data[static_cast<size_t>(I * tile + i) * A.n + J * tile]);
+            }
+        }
+    }
+    return A;
+}
+
+// ============================================================================
+// GEMM
+//
+// c += a * b on three contiguous tile×tile tiles, ikj order. The padding is
+// zero, so every tile is full size; the common sizes get a compile-time
+// trip count.
+// ============================================================================
+template <int T>
+static void tile_kernel_fixed(const double* __restrict a, const double* __restrict b,
+                              double* __restrict c) {
+    for (int i = 0; i < T; i++) {
+        double* ci = c + i * T;
+        for (int k = 0; k < T; k++) {
+            const double aik = a[i * T + k];
+            const double* bk = b + k * T;
+            for (int j = 0; j < T; j++) {
+                ci[j] += aik * bk[j];
+            }
+        }
+    }
+}
+
+static void tile_kernel(const double* __restrict a, const double* __restrict b,
+                        double* __restrict c, int tile) {
+    switch (tile) {
+        case 16: tile_kernel_fixed<16>(a, b, c); return;
+        case 32: tile_kernel_fixed<32>(a, b, c); return;
+        case 64: tile_kernel_fixed<64>(a, b, c); return;
+        case 128: tile_kernel_fixed<128>(a, b, c); return;
+    }
+    for (int i = 0; i < tile; i++) {
+        double* ci = c + i * tile;
+        for (int k = 0; k < tile; k++) {
+            const double aik = a[i * tile + k];
+            const double* bk = b + k * tile;
+            for (int j = 0; j < tile; j++) {
+                ci[j] += aik * bk[j];
+            }
+        }
+    }
+}
+
+// C tiles are visited in C's storage order, so with Morton order
+// consecutive tiles share tile rows of A and tile columns of B. With OpenMP
+// each thread owns a run of C tiles; no two threads write the same tile.
+bool gemm_tiled(const TiledMatrix& A, const TiledMatrix& B, TiledMatrix& C) {
+    if (A.tile != B.tile || A.tile != C.tile || A.n != B.m || C.m != A.m || C.n != B.n) {
+        return false;
+    }
+    const int tiles_c = C.tiles_m * C.tiles_n, tiles_k = A.tiles_n;
+
+    #pragma omp parallel for schedule(static)
+    for (int r = 0; r < tiles_c; r++) {
+        const int I = C.tile_row_at(r), J = C.tile_col_at(r);
+        double* c = C.tile_data(I, J);
+        for (int K = 0; K < tiles_k; K++) {
+            tile_kernel(A.tile_data(I, K), B.tile_data(K, J), c, C.tile);
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// GAXPY: x and y are copied into padded buffers so that every tile is a
+// full tile×tile dot-product block. Threads split the tile rows, and each
+// thread adds into its own rows of y.
+// ============================================================================
+bool gaxpy_tiled(const TiledMatrix& A, const std::vector<double>& x, std::vector<double>& y) {
+    if (static_cast<int>(x.size()) != A.n || static_cast<int>(y.size()) != A.m) return false;
+    const int tile = A.tile;
+    std::vector<double> xp(static_cast<size_t>(A.tiles_n) * tile, 0.0);
+    std::vector<double> yp(static_cast<size_t>(A.tiles_m) * tile, 0.0);
+    std::copy(x.begin(), x.end(), xp.begin());
+
+    #pragma omp parallel for schedule(static)
+    for (int I = 0; I < A.tiles_m; I++) {
+        double* yi = &yp[static_cast<size_t>(I) * tile];
+        for (int J = 0; J < A.tiles_n; J++) {
+            const double* a = A.tile_data(I, J);
+            const double* xj = &xp[static_cast<size_t>(J) * tile];
+            for (int i = 0; i < tile; i++) {
+                double s = 0.0;
+                #pragma omp simd reduction(+:s)
+                for (int j = 0; j < tile; j++) {
+                    s += a[i * tile + j] * xj[j];
+                }
+                yi[i] += s;
+            }
+        }
+    }
+
+    for (int i = 0; i < A.m; i++) y[i] += yp[i];
+    return true;
+}
@@ -0,0 +1,75 @@
+#ifndef TILED_MATRIX_H
+#define TILED_MATRIX_H
+
+#include <vector>
+#include "../src/matrix_utils.h"
+
+// Tile-major matrix storage
+//
+// The matrix is cut into tile×tile blocks. Each block is stored contiguously
+// (row-major inside the block), so a tiled algorithm reads one block as one
+// unbroken run of memory: a 64×64 tile of doubles is 32 KB on 8 pages,
+// where the same block of a row-major 2000×2000 Matrix spans 64 rows on 64
+// different pages. Edge tiles are padded with zeros to the full size, so
+// kernels never need a partial-tile case.
+//
+// Tiles are laid out one after another either row by row (RowMajor) or
+// along a Z / Morton curve (Morton): the four quadrants of every aligned
+// 2^k×2^k group of tiles are adjacent in memory, which keeps neighbouring
+// tiles close at every scale (Golub & Van Loan, Section 1.3.5 on blocks).
+
+enum class TileOrder { RowMajor, Morton };
+
+class TiledMatrix {
+public:
+    int m, n;                        // logical size
+    int tile;                        // tile edge
+    int tiles_m, tiles_n;            // tile grid
+    TileOrder order;
+    std::vector<double> data;        // tiles_m * tiles_n tiles of tile*tile entries
+
+    TiledMatrix(int rows, int cols, int tile_size, TileOrder tile_order = TileOrder::RowMajor);
+
+    // Position of tile (I, J) in storage order
+    int tile_rank(int I, int J) const {
+        return rank_[static_cast<size_t>(I) * tiles_n + J];
+    }
+
+    // Start of tile (I, J): tile*tile entries, row-major
+    double* tile_data(int I, int J) {
+        return &data[static_cast<size_t>(tile_rank(I, J)) * tile * tile];
+    }
+    const double* tile_data(int I, int J) const {
+        return &data[static_cast<size_t>(tile_rank(I, J)) * tile * tile];
+    }
+
+    // Tile coordinates of the r-th tile in storage order
+    int tile_row_at(int r) const { return coords_[r] / tiles_n; }
+    int tile_col_at(int r) const { return coords_[r] % tiles_n; }
+
+    // Element access, for tests and conversions; kernels work on whole tiles
+    double& operator()(int i, int j) {
+        return tile_data(i / tile, j / tile)[(i % tile) * tile + j % tile];
+    }
+    const double& operator()(int i, int j) const {
+        return tile_data(i / tile, j / tile)[(i % tile) * tile + j % tile];
+    }
+
+private:
+    std::vector<int> rank_;          // tile (I, J) -> position in storage order
+    std::vector<int> coords_;        // position -> I * tiles_n + J
+};
+
+// Conversions to and from the row-major Matrix
+TiledMatrix to_tiled(const Matrix& A, int tile, TileOrder order = TileOrder::RowMajor);
+Matrix from_tiled(const TiledMatrix& A);
+
+// C += A*B on tiled operands, one contiguous tile triple at a time. The three
+// may use different tile orders but must share the tile size. Returns false
+// (and leaves C alone) if the tile sizes or shapes do not agree.
+bool gemm_tiled(const TiledMatrix& A, const TiledMatrix& B, TiledMatrix& C);
+
+// y += A*x, one contiguous tile at a time, tile rows over threads
+bool gaxpy_tiled(const TiledMatrix& A, const std::vector<double>& x, std::vector<double>& y);
+
+#endif // TILED_MATRIX_H
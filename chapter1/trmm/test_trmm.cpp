@@ -0,0 +1,133 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "trmm.h"
+#include "../blocked_game/blocked_gemm.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Random n×n triangle: the uplo triangle holds data, the other one zeros
+// (for the reference GEMM) or NaN (for trmm, which must not read it)
+Matrix random_triangle(int n, Triangle uplo, double fill) {
+    Matrix T(n, n);
+    T.fill_random();
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if (uplo == Triangle::Lower ? j > i : j < i) T(i, j) = fill;
+        }
+    }
+    return T;
+}
+
+Matrix zero_other_triangle(const Matrix& T, Triangle uplo) {
+    Matrix Z = T;
+    for (int i = 0; i < Z.n; i++) {
+        for (int j = 0; j < Z.n; j++) {
+            if (uplo == Triangle::Lower ? j > i : j < i) Z(i, j) = 0.0;
+        }
+    }
+    return Z;
+}
+
+const char* name(Triangle uplo) {
+    return uplo == Triangle::Lower ? "lower" : "upper";
+}
+
+bool test_against_gemm() {
+    std::cout << "Testing trmm_left and trmm_right against gemm_ikj... ";
+
+    for (auto [k, n] : {std::pair{1, 1}, {5, 3}, {64, 64}, {100, 37}, {37, 100}, {130, 129}}) {
+        for (Triangle uplo : {Triangle::Lower, Triangle::Upper}) {
+            Matrix T = random_triangle(k, uplo, NAN);
+            Matrix Tz = zero_other_triangle(T, uplo);
+
+            for (int block_size : {8, 32, 64}) {
+                // B = T * B, B is k×n
+                Matrix B(k, n);
+                B.fill_random();
+                Matrix ref(k, n);
+                gemm_ikj(Tz, B, ref);
+                trmm_left(T, uplo, B, block_size);
+                if (!(max_abs_diff(B, ref) <= 1e-12 * k)) {
+                    std::cout << "FAILED (left, " << name(uplo) << ", " << k << "x" << n
+                              << ", block=" << block_size << ")\n";
+                    return false;
+                }
+
+                // B = B * T, B is n×k
+                Matrix C(n, k);
+                C.fill_random();
+                Matrix ref_r(n, k);
+                gemm_ikj(C, Tz, ref_r);
+                trmm_right(C, T, uplo, block_size);
+                if (!(max_abs_diff(C, ref_r) <= 1e-12 * k)) {
+                    std::cout << "FAILED (right, " << name(uplo) << ", " << n << "x" << k
+                              << ", block=" << block_size << ")\n";
+                    return false;
+                }
+            }
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Column panels (left) and row panels (right) shared out over any number
+// of threads give the same result
+bool test_thread_counts() {
+    std::cout << "Testing thread counts... ";
+
+#ifdef _OPENMP
+    const int k = 300, n = 200;
+    Matrix L = random_triangle(k, Triangle::Lower, NAN);
+    Matrix U = random_triangle(k, Triangle::Upper, NAN);
+    Matrix B0(k, n), C0(n, k);
+    B0.fill_random();
+    C0.fill_random();
+    Matrix ref_l(k, n), ref_r(n, k);
+    gemm_ikj(zero_other_triangle(L, Triangle::Lower), B0, ref_l);
+    gemm_ikj(C0, zero_other_triangle(U, Triangle::Upper), ref_r);
+
+    const int saved = omp_get_max_threads();
+    for (int threads : {1, 2, 3, 8}) {
+        omp_set_num_threads(threads);
+        Matrix B = B0, C = C0;
+        trmm_left(L, Triangle::Lower, B, 64);
+        trmm_right(C, U, Triangle::Upper, 64);
+        if (!(max_abs_diff(B, ref_l) <= 1e-12 * k) || !(max_abs_diff(C, ref_r) <= 1e-12 * k)) {
+            omp_set_num_threads(saved);
+            std::cout << "FAILED (" << threads << " threads)\n";
+            return false;
+        }
+    }
+    omp_set_num_threads(saved);
+    std::cout << "PASSED ✓\n";
+#else
+    std::cout << "SKIPPED (compiled without -fopenmp)\n";
+#endif
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Triangular Matrix Multiply (TRMM)\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_against_gemm();
+    all_passed &= test_thread_counts();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
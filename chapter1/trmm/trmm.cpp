@@ -0,0 +1,127 @@
+#include "trmm.h"
+#include "../blocked_game/blocked_gemm.h"
+#include <algorithm>
+#include <vector>
+
+// ============================================================================
+// DIAGONAL TILES
+// ============================================================================
+
+// B(ii:i_max, jj:j_max) = T(ii:i_max, ii:i_max) * B(ii:i_max, jj:j_max).
+// Row i of the result needs the old rows on its side of the diagonal, so
+// rows are finished bottom-up for lower T and top-down for upper T.
+static void left_diagonal_tile(const Matrix& T, Triangle uplo, Matrix& B,
+                               int ii, int i_max, int jj, int j_max) {
+    const bool lower = uplo == Triangle::Lower;
+    for (int s = 0; s < i_max - ii; s++) {
+        const int i = lower ? i_max - 1 - s : ii + s;
+        double* b_i = &B(i, 0);
+        const double t_ii = T(i, i);
+        for (int j = jj; j < j_max; j++) b_i[j] *= t_ii;
+        const int k0 = lower ? ii : i + 1;
+        const int k1 = lower ? i : i_max;
+        for (int k = k0; k < k1; k++) {
+            const double t_ik = T(i, k);
+            const double* b_k = &B(k, 0);
+            for (int j = jj; j < j_max; j++) b_i[j] += t_ik * b_k[j];
+        }
+    }
+}
+
+// B(ii:i_max, jj:j_max) = B(ii:i_max, jj:j_max) * T(jj:j_max, jj:j_max),
+// one row at a time through a tile-wide buffer
+static void right_diagonal_tile(Matrix& B, const Matrix& T, Triangle uplo,
+                                int ii, int i_max, int jj, int j_max, double* row) {
+    const bool lower = uplo == Triangle::Lower;
+    const int w = j_max - jj;
+    for (int i = ii; i < i_max; i++) {
+        double* b_i = &B(i, jj);
+        std::fill(row, row + w, 0.0);
+        for (int k = jj; k < j_max; k++) {
+            const double b_ik = b_i[k - jj];
+            const double* t_k = &T(k, 0);
+            // Row k of T is nonzero in columns jj..k (lower) or k..j_max (upper)
+            const int j0 = lower ? jj : k;
+            const int j1 = lower ? k + 1 : j_max;
+            for (int j = j0; j < j1; j++) row[j - jj] += b_ik * t_k[j];
+        }
+        std::copy(row, row + w, b_i);
+    }
+}
+
+// ============================================================================
+// BLOCKED DRIVERS
+// Diagonal tile first, then the nonzero off-diagonal tiles through the GEMM
+// block kernel; both read only block rows (columns) not yet overwritten.
+// ============================================================================
+void trmm_left(const Matrix& T, Triangle uplo, Matrix& B, int block_size) {
+    const int m = B.m;
+    const int n = B.n;
+    if (m == 0 || n == 0) return;
+    const bool lower = uplo == Triangle::Lower;
+    const int blocks = (m + block_size - 1) / block_size;
+    const int panels = (n + block_size - 1) / block_size;
+
+    #pragma omp parallel for schedule(static)
+    for (int p = 0; p < panels; p++) {
+        const int jj = p * block_size;
+        const int j_max = std::min(jj + block_size, n);
+
+        for (int s = 0; s < blocks; s++) {
+            const int bi = lower ? blocks - 1 - s : s;
+            const int ii = bi * block_size;
+            const int i_max = std::min(ii + block_size, m);
+            left_diagonal_tile(T, uplo, B, ii, i_max, jj, j_max);
+
+            // Zero tiles of T are skipped
+            const int bk0 = lower ? 0 : bi + 1;
+            const int bk1 = lower ? bi : blocks;
+            for (int bk = bk0; bk < bk1; bk++) {
+                const int kk = bk * block_size;
+                const int k_max = std::min(kk + block_size, m);
+                inner_block_outer_loop(T, B, B, ii, kk, jj, i_max, j_max, k_max);
+            }
+        }
+    }
+}
+
+void trmm_right(Matrix& B, const Matrix& T, Triangle uplo, int block_size) {
+    const int m = B.m;
+    const int n = B.n;
+    if (m == 0 || n == 0) return;
+    const bool lower = uplo == Triangle::Lower;
+    const int blocks = (n + block_size - 1) / block_size;
+    const int panels = (m + block_size - 1) / block_size;
+
+    #pragma omp parallel
+    {
+        std::vector<double> row(block_size);
+
+        #pragma omp for schedule(static)
+        for (int p = 0; p < panels; p++) {
+            const int ii = p * block_size;
+            const int i_max = std::min(ii + block_size, m);
+
+            // Block column J of B*T needs the old block columns K >= J
+            // (lower T) or K <= J (upper T)
+            for (int s = 0; s < blocks; s++) {
+                const int bj = lower ? s : blocks - 1 - s;
+                const int jj = bj * block_size;
+                const int j_max = std::min(jj + block_size, n);
+                right_diagonal_tile(B, T, uplo, ii, i_max, jj, j_max, row.data());
+
+                const int bk0 = lower ? bj + 1 : 0;
+                const int bk1 = lower ? blocks : bj;
+                for (int bk = bk0; bk < bk1; bk++) {
+                    const int kk = bk * block_size;
+                    const int k_max = std::min(kk + block_size, n);
+                    inner_block_outer_loop(B, T, B, ii, kk, jj, i_max, j_max, k_max);
+                }
+            }
+        }
+    }
+}
+
+double trmm_flops(int k, int n) {
+    return static_cast<double>(k) * k * n;
+}
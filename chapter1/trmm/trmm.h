@@ -0,0 +1,37 @@
+#ifndef TRMM_H
+#define TRMM_H
+
+#include "../src/matrix_utils.h"
+#include "../syrk/syrk.h"   // Triangle
+
+// Triangular matrix-matrix product in place (BLAS xTRMM)
+// Golub & Van Loan Section 1.3
+//
+//   trmm_left:   B = T * B     (T is m×m, B is m×n)
+//   trmm_right:  B = B * T     (T is n×n, B is m×n)
+//
+// Only the uplo triangle of T is read; the other may hold anything. T is
+// cut into block_size tiles and the tiles on the zero side of the diagonal
+// are skipped, so the product costs m^2 n (left) or m n^2 (right) flops,
+// half of a general GEMM.
+//
+// In place: block row I of T*B needs the old block rows K of B with T(I,K)
+// nonzero. For lower T those are K <= I, so block rows are finished
+// bottom-up and every one reads only rows that are not yet overwritten
+// (top-down for upper T; right-to-left and left-to-right over block
+// columns for B*T). Off-diagonal tiles go through the gemm_blocked block
+// kernel with B as both input and output (disjoint rows or columns);
+// diagonal tiles run a triangular loop.
+//
+// With OpenMP the independent direction is shared out: column panels of B
+// for trmm_left, row panels for trmm_right.
+
+void trmm_left(const Matrix& T, Triangle uplo, Matrix& B, int block_size);
+
+void trmm_right(Matrix& B, const Matrix& T, Triangle uplo, int block_size);
+
+// Flop count of a triangular product with an order-k triangle and n
+// columns (or rows) on the other side: k^2 n
+double trmm_flops(int k, int n);
+
+#endif // TRMM_H
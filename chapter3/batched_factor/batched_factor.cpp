@@ -0,0 +1,398 @@
+#include "batched_factor.h"
+#include <algorithm>
+#include <cmath>
+
+// Shorthand for the lane width inside the kernels
+static constexpr int W = kBatchLanes;
+
+// ============================================================================
+// LAYOUT
+// ============================================================================
+Batch::Batch(int rows, int cols, int count)
+    : rows(rows), cols(cols), count(count),
+      data(static_cast<size_t>((count + kBatchLanes - 1) / kBatchLanes) * rows * cols *
+           kBatchLanes, 0.0) {
+    // Identity in the padding lanes of the last group
+    for (int b = count; b < groups() * kBatchLanes; b++) {
+        for (int i = 0; i < std::min(rows, cols); i++) (*this)(b, i, i) = 1.0;
+    }
+}
+
+void Batch::set(int b, const Matrix& A) {
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) (*this)(b, i, j) = A(i, j);
+    }
+}
+
+Matrix Batch::get(int b) const {
+    Matrix A(rows, cols);
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) A(i, j) = (*this)(b, i, j);
+    }
+    return A;
+}
+
+Batch pack_batch(const std::vector<Matrix>& A) {
+    const int count = static_cast<int>(A.size());
+    Batch B(count ? A[0].m : 0, count ? A[0].n : 0, count);
+    #pragma omp parallel for schedule(static)
+    for (int b = 0; b < count; b++) B.set(b, A[b]);
+    return B;
+}
+
+std::vector<Matrix> unpack_batch(const Batch& B) {
+    std::vector<Matrix> A(B.count, Matrix(B.rows, B.cols));
+    #pragma omp parallel for schedule(static)
+    for (int b = 0; b < B.count; b++) A[b] = B.get(b);
+    return A;
+}
+
+// Entry (i, j) of every lane of one group: W consecutive doubles
+static inline double* at(double* g, int cols, int i, int j) {
+    return g + (static_cast<size_t>(i) * cols + j) * W;
+}
+static inline const double* at(const double* g, int cols, int i, int j) {
+    return g + (static_cast<size_t>(i) * cols + j) * W;
+}
+
+// Record the per-lane status of group g for the real (non-padding) lanes
+static void store_info(const int* lane_info, int g, int count, std::vector<int>& info) {
+    for (int l = 0; l < W && g * W + l < count; l++) info[g * W + l] = lane_info[l];
+}
+
+// Swap row r with row p[l] in lane l, over `cols` columns. The rows differ
+// per lane, so this is a strided scalar loop per lane: O(n) per step
+// against the O(n^2) vectorized elimination that follows.
+static void swap_rows_lanes(double* g, int cols, int r, const int* p) {
+    for (int l = 0; l < W; l++) {
+        if (p[l] == r) continue;
+        double* x = at(g, cols, r, 0) + l;
+        double* y = at(g, cols, p[l], 0) + l;
+        for (int j = 0; j < cols * W; j += W) std::swap(x[j], y[j]);
+    }
+}
+
+// ============================================================================
+// LU: Algorithm 3.4.1 with every scalar replaced by a lane vector
+// ============================================================================
+static void lu_group(double* g, int m, int n, int* piv_lanes, int* lane_info) {
+    const int kmax = std::min(m, n);
+    for (int k = 0; k < kmax; k++) {
+        // Pivot search: running max and argmax per lane, branch-free
+        // (the fixed-length lane loop unrolls into conditional moves)
+        int p[W];
+        double best[W];
+        const double* d = at(g, n, k, k);
+        for (int l = 0; l < W; l++) {
+            best[l] = std::abs(d[l]);
+            p[l] = k;
+        }
+        for (int i = k + 1; i < m; i++) {
+            const double* a = at(g, n, i, k);
+            for (int l = 0; l < W; l++) {
+                double v = std::abs(a[l]);
+                bool larger = v > best[l];
+                best[l] = larger ? v : best[l];
+                p[l] = larger ? i : p[l];
+            }
+        }
+        for (int l = 0; l < W; l++) piv_lanes[k * W + l] = p[l];
+        swap_rows_lanes(g, n, k, p);
+
+        // Zero pivot: that lane records info and skips the elimination
+        double inv[W];
+        const double* u = at(g, n, k, 0);
+        for (int l = 0; l < W; l++) {
+            bool zero = u[k * W + l] == 0.0;
+            if (zero && lane_info[l] == 0) lane_info[l] = k + 1;
+            inv[l] = zero ? 0.0 : 1.0 / u[k * W + l];
+        }
+
+        for (int i = k + 1; i < m; i++) {
+            double* a = at(g, n, i, 0);
+            double mult[W];
+            #pragma omp simd
+            for (int l = 0; l < W; l++) {
+                double x = a[k * W + l];
+                mult[l] = x * inv[l];
+                a[k * W + l] = inv[l] != 0.0 ? mult[l] : x;
+            }
+            for (int j = k + 1; j < n; j++) {
+                #pragma omp simd
+                for (int l = 0; l < W; l++) a[j * W + l] -= mult[l] * u[j * W + l];
+            }
+        }
+    }
+}
+
+void batched_lu(Batch& A, std::vector<int>& piv, std::vector<int>& info) {
+    const int m = A.rows, n = A.cols, kmax = std::min(m, n);
+    piv.assign(static_cast<size_t>(A.count) * kmax, 0);
+    info.assign(A.count, 0);
+
+    #pragma omp parallel
+    {
+        std::vector<int> piv_lanes(static_cast<size_t>(kmax) * W);
+        #pragma omp for schedule(static)
+        for (int g = 0; g < A.groups(); g++) {
+            int lane_info[W] = {};
+            lu_group(A.group(g), m, n, piv_lanes.data(), lane_info);
+            for (int l = 0; l < W && g * W + l < A.count; l++) {
+                for (int k = 0; k < kmax; k++) {
+                    piv[(g * W + l) * kmax + k] = piv_lanes[k * W + l];
+                }
+            }
+            store_info(lane_info, g, A.count, info);
+        }
+    }
+}
+
+// ============================================================================
+// CHOLESKY: right-looking outer product form, lower triangle only
+// ============================================================================
+static void cholesky_group(double* g, int n, int* lane_info) {
+    for (int j = 0; j < n; j++) {
+        double* d = at(g, n, j, j);
+        double inv[W];
+        for (int l = 0; l < W; l++) {
+            bool positive = d[l] > 0.0;
+            if (!positive && lane_info[l] == 0) lane_info[l] = j + 1;
+            double r = std::sqrt(positive ? d[l] : 1.0);
+            d[l] = positive ? r : d[l];
+            inv[l] = positive ? 1.0 / r : 0.0;
+        }
+        for (int i = j + 1; i < n; i++) {
+            double* a = at(g, n, i, j);
+            #pragma omp simd
+            for (int l = 0; l < W; l++) a[l] *= inv[l];
+        }
+        // A(j+1:n, j+1:n) -= L(:, j) * L(:, j)^T, lower triangle
+        for (int i = j + 1; i < n; i++) {
+            const double* lij = at(g, n, i, j);
+            double* a = at(g, n, i, 0);
+            for (int c = j + 1; c <= i; c++) {
+                const double* lcj = at(g, n, c, j);
+                #pragma omp simd
+                for (int l = 0; l < W; l++) a[c * W + l] -= lij[l] * lcj[l];
+            }
+        }
+    }
+}
+
+void batched_cholesky(Batch& A, std::vector<int>& info) {
+    info.assign(A.count, 0);
+    #pragma omp parallel for schedule(static)
+    for (int g = 0; g < A.groups(); g++) {
+        int lane_info[W] = {};
+        cholesky_group(A.group(g), A.cols, lane_info);
+        store_info(lane_info, g, A.count, info);
+    }
+}
+
+// ============================================================================
+// QR: one reflector per column (householder_column), applied to the
+// trailing columns as w^T = v^T * A, A -= tau * v * w^T by row sweeps
+// ============================================================================
+static void qr_group(double* g, int m, int n, double* tau, double* w) {
+    for (int k = 0; k < n; k++) {
+        double* alpha = at(g, n, k, k);
+        double sigma[W] = {};
+        for (int i = k + 1; i < m; i++) {
+            const double* x = at(g, n, i, k);
+            #pragma omp simd
+            for (int l = 0; l < W; l++) sigma[l] += x[l] * x[l];
+        }
+
+        // xLARFG per lane; a lane with nothing below the diagonal gets tau = 0
+        double scale[W], t[W];
+        #pragma omp simd
+        for (int l = 0; l < W; l++) {
+            bool skip = sigma[l] == 0.0;
+            double a = alpha[l];
+            double norm = std::sqrt(a * a + sigma[l]);
+            double beta = a >= 0.0 ? -norm : norm;
+            t[l] = skip ? 0.0 : (beta - a) / beta;
+            scale[l] = skip ? 1.0 : 1.0 / (a - beta);
+            alpha[l] = skip ? a : beta;
+            tau[k * W + l] = t[l];
+        }
+        for (int i = k + 1; i < m; i++) {
+            double* x = at(g, n, i, k);
+            #pragma omp simd
+            for (int l = 0; l < W; l++) x[l] *= scale[l];
+        }
+        if (k + 1 >= n) continue;
+
+        // w = A(k, k+1:n) + sum_i v_i * A(i, k+1:n)   (v_k = 1)
+        const int nt = n - k - 1;
+        std::copy(at(g, n, k, k + 1), at(g, n, k, n), w);
+        for (int i = k + 1; i < m; i++) {
+            const double* v = at(g, n, i, k);
+            const double* a = at(g, n, i, k + 1);
+            for (int j = 0; j < nt; j++) {
+                #pragma omp simd
+                for (int l = 0; l < W; l++) w[j * W + l] += v[l] * a[j * W + l];
+            }
+        }
+        for (int j = 0; j < nt; j++) {
+            #pragma omp simd
+            for (int l = 0; l < W; l++) w[j * W + l] *= t[l];
+        }
+        // A(k:m, k+1:n) -= v * w^T
+        double* a = at(g, n, k, k + 1);
+        for (int j = 0; j < nt * W; j++) a[j] -= w[j];
+        for (int i = k + 1; i < m; i++) {
+            const double* v = at(g, n, i, k);
+            double* r = at(g, n, i, k + 1);
+            for (int j = 0; j < nt; j++) {
+                #pragma omp simd
+                for (int l = 0; l < W; l++) r[j * W + l] -= v[l] * w[j * W + l];
+            }
+        }
+    }
+}
+
+void batched_qr(Batch& A, Batch& tau) {
+    tau = Batch(A.cols, 1, A.count);
+    #pragma omp parallel for schedule(static)
+    for (int g = 0; g < A.groups(); g++) {
+        std::vector<double> w(static_cast<size_t>(A.cols) * W);
+        qr_group(A.group(g), A.rows, A.cols, tau.group(g), w.data());
+    }
+}
+
+// ============================================================================
+// SOLVES
+// ============================================================================
+void batched_lu_solve(const Batch& LU, const std::vector<int>& piv, Batch& B) {
+    const int n = LU.cols, nrhs = B.cols;
+
+    #pragma omp parallel for schedule(static)
+    for (int g = 0; g < LU.groups(); g++) {
+        const double* f = LU.group(g);
+        double* b = B.group(g);
+
+        // Replay the swaps; padding lanes have the identity (no swaps)
+        for (int k = 0; k < n; k++) {
+            int p[W];
+            for (int l = 0; l < W; l++) {
+                p[l] = g * W + l < LU.count ? piv[(g * W + l) * n + k] : k;
+            }
+            swap_rows_lanes(b, nrhs, k, p);
+        }
+
+        // L*Y = P*B
+        for (int i = 1; i < n; i++) {
+            double* bi = at(b, nrhs, i, 0);
+            for (int k = 0; k < i; k++) {
+                const double* lik = at(f, n, i, k);
+                const double* bk = at(b, nrhs, k, 0);
+                for (int c = 0; c < nrhs; c++) {
+                    #pragma omp simd
+                    for (int l = 0; l < W; l++) bi[c * W + l] -= lik[l] * bk[c * W + l];
+                }
+            }
+        }
+        // U*X = Y
+        for (int i = n - 1; i >= 0; i--) {
+            double* bi = at(b, nrhs, i, 0);
+            for (int k = i + 1; k < n; k++) {
+                const double* uik = at(f, n, i, k);
+                const double* bk = at(b, nrhs, k, 0);
+                for (int c = 0; c < nrhs; c++) {
+                    #pragma omp simd
+                    for (int l = 0; l < W; l++) bi[c * W + l] -= uik[l] * bk[c * W + l];
+                }
+            }
+            const double* uii = at(f, n, i, i);
+            for (int c = 0; c < nrhs; c++) {
+                #pragma omp simd
+                for (int l = 0; l < W; l++) bi[c * W + l] /= uii[l];
+            }
+        }
+    }
+}
+
+void batched_cholesky_solve(const Batch& L, Batch& B) {
+    const int n = L.cols, nrhs = B.cols;
+
+    #pragma omp parallel for schedule(static)
+    for (int g = 0; g < L.groups(); g++) {
+        const double* f = L.group(g);
+        double* b = B.group(g);
+
+        // L*Y = B
+        for (int i = 0; i < n; i++) {
+            double* bi = at(b, nrhs, i, 0);
+            for (int k = 0; k < i; k++) {
+                const double* lik = at(f, n, i, k);
+                const double* bk = at(b, nrhs, k, 0);
+                for (int c = 0; c < nrhs; c++) {
+                    #pragma omp simd
+                    for (int l = 0; l < W; l++) bi[c * W + l] -= lik[l] * bk[c * W + l];
+                }
+            }
+            const double* lii = at(f, n, i, i);
+            for (int c = 0; c < nrhs; c++) {
+                #pragma omp simd
+                for (int l = 0; l < W; l++) bi[c * W + l] /= lii[l];
+            }
+        }
+        // L^T*X = Y: finish row i, then push it into the rows above
+        for (int i = n - 1; i >= 0; i--) {
+            double* bi = at(b, nrhs, i, 0);
+            const double* lii = at(f, n, i, i);
+            for (int c = 0; c < nrhs; c++) {
+                #pragma omp simd
+                for (int l = 0; l < W; l++) bi[c * W + l] /= lii[l];
+            }
+            for (int k = 0; k < i; k++) {
+                const double* lik = at(f, n, i, k);
+                double* bk = at(b, nrhs, k, 0);
+                for (int c = 0; c < nrhs; c++) {
+                    #pragma omp simd
+                    for (int l = 0; l < W; l++) bk[c * W + l] -= lik[l] * bi[c * W + l];
+                }
+            }
+        }
+    }
+}
+
+void batched_qr_apply_qt(const Batch& QR, const Batch& tau, Batch& B) {
+    const int m = QR.rows, n = QR.cols, nrhs = B.cols;
+
+    #pragma omp parallel for schedule(static)
+    for (int g = 0; g < QR.groups(); g++) {
+        const double* f = QR.group(g);
+        const double* t = tau.group(g);
+        double* b = B.group(g);
+        std::vector<double> w(static_cast<size_t>(nrhs) * W);
+
+        // Q^T = P_{n-1} ... P_0: apply P_0 first
+        for (int k = 0; k < n; k++) {
+            std::copy(at(b, nrhs, k, 0), at(b, nrhs, k, nrhs), w.begin());
+            for (int i = k + 1; i < m; i++) {
+                const double* v = at(f, n, i, k);
+                const double* bi = at(b, nrhs, i, 0);
+                for (int c = 0; c < nrhs; c++) {
+                    #pragma omp simd
+                    for (int l = 0; l < W; l++) w[c * W + l] += v[l] * bi[c * W + l];
+                }
+            }
+            for (int c = 0; c < nrhs; c++) {
+                #pragma omp simd
+                for (int l = 0; l < W; l++) w[c * W + l] *= t[k * W + l];
+            }
+            double* bk = at(b, nrhs, k, 0);
+            for (int j = 0; j < nrhs * W; j++) bk[j] -= w[j];
+            for (int i = k + 1; i < m; i++) {
+                const double* v = at(f, n, i, k);
+                double* bi = at(b, nrhs, i, 0);
+                for (int c = 0; c < nrhs; c++) {
+                    #pragma omp simd
+                    for (int l = 0; l < W; l++) bi[c * W + l] -= v[l] * w[c * W + l];
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,98 @@
+#ifndef BATCHED_FACTOR_H
+#define BATCHED_FACTOR_H
+
+#include <vector>
+#include "../../chapter1/src/matrix_utils.h"
+
+// Batched LU, Cholesky and QR of many small matrices of one size
+// (Golub & Van Loan Sections 3.4, 4.2 and 5.2; the interleaved layout of
+// MAGMA / Intel MKL "compact" batched routines)
+//
+// One small factorization is too short to fill a vector unit: a 8×8 LU has
+// inner loops of length 7, 6, ..., 1. Instead kBatchLanes matrices are
+// interleaved element by element,
+//
+//   group g, entry (i,j) of matrix g*kBatchLanes + l  ->  data[((g*rows + i)*cols + j)*kBatchLanes + l]
+//
+// and every scalar operation of the textbook algorithm becomes one operation
+// across the lanes: lane l works on its own matrix with unit-stride loads.
+// Data-dependent choices (pivot rows, zero reflectors) are made per lane with
+// selects, so all lanes run the same instruction stream. Groups are
+// independent and are spread over OpenMP threads.
+//
+// Storage of the factors is that of the unbatched routines (chapter3/lu,
+// chapter4/cholesky, chapter5/householder), one matrix per lane.
+
+// Lanes per group: 8 doubles fill one AVX-512 register (two AVX2 registers)
+constexpr int kBatchLanes = 8;
+
+// count matrices of size rows×cols, interleaved in groups of kBatchLanes.
+// The padding lanes of the last group hold the identity so they factor
+// cleanly; they are ignored on the way out.
+class Batch {
+public:
+    int rows = 0, cols = 0, count = 0;
+    std::vector<double> data;
+
+    Batch(int rows, int cols, int count);
+
+    int groups() const { return (count + kBatchLanes - 1) / kBatchLanes; }
+
+    // Entry (i, j) of matrix b
+    double& operator()(int b, int i, int j) {
+        return data[index(b, i, j)];
+    }
+    const double& operator()(int b, int i, int j) const {
+        return data[index(b, i, j)];
+    }
+
+    // First element of group g (rows*cols*kBatchLanes contiguous doubles)
+    double* group(int g) { return &data[static_cast<size_t>(g) * rows * cols * kBatchLanes]; }
+    const double* group(int g) const {
+        return &data[static_cast<size_t>(g) * rows * cols * kBatchLanes];
+    }
+
+    // Copy matrix b in / out
+    void set(int b, const Matrix& A);
+    Matrix get(int b) const;
+
+private:
+    size_t index(int b, int i, int j) const {
+        return ((static_cast<size_t>(b / kBatchLanes) * rows + i) * cols + j) * kBatchLanes +
+               b % kBatchLanes;
+    }
+};
+
+// Interleave / de-interleave a list of equally sized matrices
+Batch pack_batch(const std::vector<Matrix>& A);
+std::vector<Matrix> unpack_batch(const Batch& B);
+
+// ============================================================================
+// Factorizations, in place. info[b] = 0 on success, otherwise k+1 for the
+// first step k that failed in matrix b (LAPACK convention); the other
+// matrices are unaffected.
+// ============================================================================
+
+// P*A = L*U with partial pivoting (lu_unblocked, Algorithm 3.4.1).
+// piv[b*n + k] is the row swapped with row k of matrix b. info: zero pivot.
+void batched_lu(Batch& A, std::vector<int>& piv, std::vector<int>& info);
+
+// A = L*L^T, lower triangle (cholesky_unblocked, Algorithm 4.2.2).
+// info: non-positive pivot.
+void batched_cholesky(Batch& A, std::vector<int>& info);
+
+// Householder QR of m×n matrices, m >= n (householder_qr storage and
+// xLARFG sign convention). tau is a Batch of n×1 vectors.
+void batched_qr(Batch& A, Batch& tau);
+
+// ============================================================================
+// Solves with the factors, B is a Batch of n×nrhs right-hand sides
+// ============================================================================
+void batched_lu_solve(const Batch& LU, const std::vector<int>& piv, Batch& B);
+void batched_cholesky_solve(const Batch& L, Batch& B);
+
+// B = Q^T * B for m×nrhs B; the first n rows of the result, followed by a
+// back substitution with R, give the least squares solution
+void batched_qr_apply_qt(const Batch& QR, const Batch& tau, Batch& B);
+
+#endif // BATCHED_FACTOR_H
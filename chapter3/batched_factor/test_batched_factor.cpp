@@ -0,0 +1,211 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include "batched_factor.h"
+#include "../lu/lu.h"
+#include "../../chapter4/cholesky/cholesky.h"
+#include "../../chapter5/householder/householder.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+
+std::vector<Matrix> random_batch(int count, int m, int n) {
+    std::vector<Matrix> A(count, Matrix(m, n));
+    for (auto& M : A) M.fill_random();
+    return A;
+}
+
+bool test_layout() {
+    std::cout << "Testing interleaved layout round trip... ";
+
+    // 13 matrices: one full group and one with 3 padding lanes
+    std::vector<Matrix> A = random_batch(13, 5, 3);
+    Batch B = pack_batch(A);
+    std::vector<Matrix> back = unpack_batch(B);
+    bool ok = B.groups() == 2 && back.size() == A.size();
+    for (int b = 0; ok && b < 13; b++) ok = back[b].data == A[b].data;
+    // Lane-major: consecutive doubles are the same entry of consecutive matrices
+    ok = ok && &B(1, 2, 1) == &B(0, 2, 1) + 1 && B(13, 1, 1) == 1.0 && B(15, 0, 1) == 0.0;
+    if (!ok) {
+        std::cout << "FAILED\n";
+        return false;
+    }
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Same pivots as lu_unblocked and the same arithmetic per matrix
+bool test_lu() {
+    std::cout << "Testing batched LU against lu_unblocked... ";
+
+    for (int n : {1, 4, 9, 32}) {
+        const int count = 21;
+        std::vector<Matrix> A = random_batch(count, n, n);
+        // Matrix 5 is singular: its second column is zero
+        for (int i = 0; i < n && n > 1; i++) A[5](i, 1) = 0.0;
+
+        Batch F = pack_batch(A);
+        std::vector<int> piv, info;
+        batched_lu(F, piv, info);
+
+        for (int b = 0; b < count; b++) {
+            Matrix LU = A[b];
+            std::vector<int> piv_ref;
+            bool ok_ref = lu_unblocked(LU, piv_ref);
+            std::vector<int> piv_b(piv.begin() + b * n, piv.begin() + (b + 1) * n);
+            if (piv_b != piv_ref || max_abs_diff(F.get(b), LU) > 1e-13 ||
+                (info[b] == 0) != ok_ref) {
+                std::cout << "FAILED (n=" << n << ", matrix " << b << ", info=" << info[b]
+                          << ")\n";
+                return false;
+            }
+        }
+        if (n > 1 && info[5] != 2) {
+            std::cout << "FAILED (singular matrix info=" << info[5] << ")\n";
+            return false;
+        }
+
+        // Solve with 2 right-hand sides (skip the singular matrix)
+        std::vector<Matrix> X0 = random_batch(count, n, 2);
+        Batch X = pack_batch(X0);
+        batched_lu_solve(F, piv, X);
+        for (int b = 0; b < count; b++) {
+            if (b == 5 && n > 1) continue;
+            Matrix AX(n, 2);
+            gemm_ikj(A[b], X.get(b), AX);
+            if (max_abs_diff(AX, X0[b]) > 1e-9) {
+                std::cout << "FAILED (solve, n=" << n << ", matrix " << b << ")\n";
+                return false;
+            }
+        }
+    }
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_cholesky() {
+    std::cout << "Testing batched Cholesky and solve... ";
+
+    for (int n : {1, 4, 16, 32}) {
+        const int count = 11;
+        std::vector<Matrix> A(count, Matrix(n, n));
+        for (auto& S : A) {
+            Matrix R(n, n);
+            R.fill_random();
+            gemm_ikj(R, R.transpose(), S);
+            for (int i = 0; i < n; i++) S(i, i) += 1.0;
+        }
+        A[7](n - 1, n - 1) = -1.0;   // indefinite at the last step
+
+        Batch F = pack_batch(A);
+        std::vector<int> info;
+        batched_cholesky(F, info);
+
+        std::vector<Matrix> X0 = random_batch(count, n, 3);
+        Batch X = pack_batch(X0);
+        batched_cholesky_solve(F, X);
+
+        for (int b = 0; b < count; b++) {
+            Matrix L = A[b];
+            bool ok_ref = cholesky_unblocked(L);
+            if ((info[b] == 0) != ok_ref || (b == 7 && info[b] != n)) {
+                std::cout << "FAILED (n=" << n << ", matrix " << b << ", info=" << info[b]
+                          << ")\n";
+                return false;
+            }
+            if (!ok_ref) continue;
+            Matrix Fb = F.get(b);
+            double d = 0.0;
+            for (int i = 0; i < n; i++) {
+                for (int j = 0; j <= i; j++) d = std::max(d, std::abs(Fb(i, j) - L(i, j)));
+            }
+            Matrix AX(n, 3);
+            gemm_ikj(A[b], X.get(b), AX);
+            if (d > 1e-12 * n || max_abs_diff(AX, X0[b]) > 1e-9) {
+                std::cout << "FAILED (n=" << n << ", matrix " << b << ")\n";
+                return false;
+            }
+        }
+    }
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Same reflectors as householder_qr; least squares through Q^T * b
+bool test_qr() {
+    std::cout << "Testing batched QR and least squares... ";
+
+    for (auto [m, n] : {std::pair{1, 1}, {6, 4}, {16, 16}, {32, 20}}) {
+        const int count = 10;
+        std::vector<Matrix> A = random_batch(count, m, n);
+        // A zero column below the diagonal: tau = 0 in that lane only
+        for (int i = 1; i < m; i++) A[3](i, 0) = 0.0;
+
+        Batch F = pack_batch(A);
+        Batch tau(0, 0, 0);
+        batched_qr(F, tau);
+
+        std::vector<Matrix> B0 = random_batch(count, m, 1);
+        Batch B = pack_batch(B0);
+        batched_qr_apply_qt(F, tau, B);
+
+        for (int b = 0; b < count; b++) {
+            Matrix QR = A[b];
+            std::vector<double> tau_ref;
+            householder_qr(QR, tau_ref, 8);
+            double d = max_abs_diff(F.get(b), QR);
+            for (int k = 0; k < n; k++) d = std::max(d, std::abs(tau(b, k, 0) - tau_ref[k]));
+            if (d > 1e-12) {
+                std::cout << "FAILED (" << m << "x" << n << ", matrix " << b << ", diff=" << d
+                          << ")\n";
+                return false;
+            }
+
+            // R x = (Q^T b)(0:n); the residual A x - b is orthogonal to range(A)
+            Matrix Qtb = B.get(b);
+            Matrix x(n, 1);
+            for (int i = n - 1; i >= 0; i--) {
+                double s = Qtb(i, 0);
+                for (int k = i + 1; k < n; k++) s -= QR(i, k) * x(k, 0);
+                x(i, 0) = s / QR(i, i);
+            }
+            Matrix r(m, 1);
+            gemm_ikj(A[b], x, r);
+            for (int i = 0; i < m; i++) r(i, 0) -= B0[b](i, 0);
+            Matrix Atr(n, 1);
+            gemm_ikj(A[b].transpose(), r, Atr);
+            for (double v : Atr.data) {
+                if (std::abs(v) > 1e-10) {
+                    std::cout << "FAILED (normal equations, " << m << "x" << n << ")\n";
+                    return false;
+                }
+            }
+        }
+        if (tau(3, 0, 0) != 0.0) {
+            std::cout << "FAILED (zero column got a reflector)\n";
+            return false;
+        }
+    }
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Batched Small Factorizations\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_layout();
+    all_passed &= test_lu();
+    all_passed &= test_cholesky();
+    all_passed &= test_qr();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,120 @@
+#include "condition.h"
+#include "../lu/lu.h"
+#include "../../chapter4/cholesky/cholesky.h"
+#include <algorithm>
+#include <cmath>
+
+// Ascent steps allowed before the alternating-sign guard (xLACN2 ITMAX)
+static const int kMaxIterations = 5;
+
+static double vector_norm1(const Matrix& x) {
+    double s = 0.0;
+    for (double v : x.data) s += std::abs(v);
+    return s;
+}
+
+// ============================================================================
+// ESTIMATOR
+// ============================================================================
+double inverse_norm1_estimate(int n, const InverseApply& apply_inverse, ConditionStats* stats) {
+    if (n == 0) return 0.0;
+    Matrix x(n, 1);
+    Matrix z(n, 1);
+    std::vector<double> xi(n, 0.0);   // sign(y) of the last ascent step
+    auto solve = [&](Matrix& v, bool transpose) {
+        apply_inverse(v, transpose);
+        if (stats) stats->solves++;
+    };
+    // xi = z = sign(x); returns false if xi already had that sign pattern
+    auto take_sign = [&]() {
+        bool changed = false;
+        for (int i = 0; i < n; i++) {
+            double s = x.data[i] >= 0.0 ? 1.0 : -1.0;
+            changed |= (s != xi[i]);
+            xi[i] = z.data[i] = s;
+        }
+        return changed;
+    };
+    auto argmax_abs = [&]() {
+        int j = 0;
+        for (int i = 1; i < n; i++) {
+            if (std::abs(z.data[i]) > std::abs(z.data[j])) j = i;
+        }
+        return j;
+    };
+
+    std::fill(x.data.begin(), x.data.end(), 1.0 / n);
+    solve(x, false);
+    double est = vector_norm1(x);
+    if (n == 1) return est;
+
+    take_sign();
+    solve(z, true);
+    int j = argmax_abs();
+
+    for (int it = 0; it < kMaxIterations; it++) {
+        if (stats) stats->iterations++;
+        std::fill(x.data.begin(), x.data.end(), 0.0);
+        x.data[j] = 1.0;
+        solve(x, false);
+        double est_new = vector_norm1(x);
+        // No ascent, or the same sign pattern (the next z would repeat)
+        if (est_new <= est) break;
+        est = est_new;
+        if (!take_sign()) break;
+
+        solve(z, true);
+        int j_last = j;
+        j = argmax_abs();
+        // e_j_last already maximizes z^T x over the unit ball: local maximum
+        if (std::abs(z.data[j_last]) == std::abs(z.data[j])) break;
+    }
+
+    // Alternating-sign guard vector, scaled as in xLACN2
+    for (int i = 0; i < n; i++) {
+        x.data[i] = (i % 2 == 0 ? 1.0 : -1.0) * (1.0 + static_cast<double>(i) / (n - 1));
+    }
+    solve(x, false);
+    return std::max(est, 2.0 * vector_norm1(x) / (3.0 * n));
+}
+
+double matrix_norm1(const Matrix& A) {
+    std::vector<double> col(A.n, 0.0);
+    for (int i = 0; i < A.m; i++) {
+        const double* a_row = &A(i, 0);
+        for (int j = 0; j < A.n; j++) col[j] += std::abs(a_row[j]);
+    }
+    return A.n == 0 ? 0.0 : *std::max_element(col.begin(), col.end());
+}
+
+// ============================================================================
+// DRIVERS
+// ============================================================================
+
+// Exactly zero pivot: A is singular and rcond is 0 (no solve attempted)
+static bool zero_diagonal(const Matrix& F) {
+    for (int k = 0; k < std::min(F.m, F.n); k++) {
+        if (F(k, k) == 0.0) return true;
+    }
+    return false;
+}
+
+double lu_rcond(const Matrix& LU, const std::vector<int>& piv, double anorm,
+                ConditionStats* stats) {
+    if (LU.n == 0) return 1.0;
+    if (anorm == 0.0 || zero_diagonal(LU)) return 0.0;
+    double ainv = inverse_norm1_estimate(LU.n, [&](Matrix& x, bool transpose) {
+        if (transpose) lu_solve_transpose(LU, piv, x);
+        else lu_solve(LU, piv, x);
+    }, stats);
+    return ainv == 0.0 ? 0.0 : 1.0 / (anorm * ainv);
+}
+
+double cholesky_rcond(const Matrix& L, double anorm, ConditionStats* stats) {
+    if (L.n == 0) return 1.0;
+    if (anorm == 0.0 || zero_diagonal(L)) return 0.0;
+    double ainv = inverse_norm1_estimate(L.n, [&](Matrix& x, bool) {
+        cholesky_solve(L, x);
+    }, stats);
+    return ainv == 0.0 ? 0.0 : 1.0 / (anorm * ainv);
+}
@@ -0,0 +1,169 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include "condition.h"
+#include "../lu/lu.h"
+#include "../../chapter4/cholesky/cholesky.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+
+// Exact ||A^-1||_1 through the explicit inverse
+double exact_inverse_norm1(const Matrix& A) {
+    Matrix LU = A;
+    std::vector<int> piv;
+    lu_blocked(LU, piv, 32);
+    return matrix_norm1(lu_inverse(LU, piv));
+}
+
+// Random matrix with rows graded over `decades` orders of magnitude
+Matrix graded_matrix(int n, double decades) {
+    Matrix A(n, n);
+    A.fill_random();
+    for (int i = 0; i < n; i++) {
+        double scale = std::pow(10.0, -decades * i / std::max(1, n - 1));
+        for (int j = 0; j < n; j++) A(i, j) *= scale;
+    }
+    return A;
+}
+
+// The estimate is a lower bound on ||A^-1||_1 and within a factor 3 of it
+bool test_lu_estimate() {
+    std::cout << "Testing LU estimate against the explicit inverse... ";
+
+    int exact_hits = 0, trials = 0;
+    for (int n : {1, 2, 10, 50, 200}) {
+        for (double decades : {0.0, 4.0, 10.0}) {
+            Matrix A = graded_matrix(n, decades);
+            double anorm = matrix_norm1(A);
+            Matrix LU = A;
+            std::vector<int> piv;
+            lu_blocked(LU, piv, 32);
+
+            ConditionStats stats;
+            double rcond = lu_rcond(LU, piv, anorm, &stats);
+            double est = 1.0 / (anorm * rcond);
+            double exact = exact_inverse_norm1(A);
+            trials++;
+            if (std::abs(est - exact) <= 1e-10 * exact) exact_hits++;
+
+            if (est > exact * (1.0 + 1e-10) || est < exact / 3.0 || stats.solves > 13) {
+                std::cout << "FAILED (n=" << n << ", est=" << est << ", exact=" << exact
+                          << ", solves=" << stats.solves << ")\n";
+                return false;
+            }
+        }
+    }
+    // Hager's ascent usually lands on the maximizing column exactly
+    if (exact_hits < trials / 2) {
+        std::cout << "FAILED (exact in only " << exact_hits << " of " << trials << ")\n";
+        return false;
+    }
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Hilbert matrices are SPD and famously ill conditioned
+bool test_cholesky_estimate() {
+    std::cout << "Testing Cholesky estimate on Hilbert matrices... ";
+
+    for (int n : {4, 8, 10}) {
+        Matrix H(n, n);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) H(i, j) = 1.0 / (i + j + 1);
+        }
+        double anorm = matrix_norm1(H);
+        Matrix L = H;
+        if (!cholesky_blocked(L, 4)) {
+            std::cout << "FAILED (Hilbert " << n << " not SPD)\n";
+            return false;
+        }
+        ConditionStats stats;
+        double est = 1.0 / (anorm * cholesky_rcond(L, anorm, &stats));
+        // The inverse itself carries relative error ~ kappa * eps
+        double exact = exact_inverse_norm1(H);
+        double tol = 1e-15 * anorm * exact;
+        if (est > exact * (1.0 + tol) || est < exact / 3.0) {
+            std::cout << "FAILED (n=" << n << ", est=" << est << ", exact=" << exact << ")\n";
+            return false;
+        }
+    }
+
+    // Hilbert 8: kappa_1 = 3.387e10
+    Matrix H(8, 8);
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) H(i, j) = 1.0 / (i + j + 1);
+    }
+    double anorm = matrix_norm1(H);
+    cholesky_unblocked(H);
+    double kappa = 1.0 / cholesky_rcond(H, anorm);
+    if (std::abs(kappa / 3.387e10 - 1.0) > 1e-3) {
+        std::cout << "FAILED (kappa_1(H8) = " << kappa << ")\n";
+        return false;
+    }
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_singular() {
+    std::cout << "Testing singular and nearly singular matrices... ";
+
+    // Diagonal: ||A^-1||_1 = 1 / min |d_i|, found exactly
+    Matrix D(5, 5);
+    double d[5] = {3.0, -1e-8, 2.0, 0.5, 7.0};
+    for (int i = 0; i < 5; i++) D(i, i) = d[i];
+    std::vector<int> piv;
+    Matrix LU = D;
+    lu_unblocked(LU, piv);
+    double rcond = lu_rcond(LU, piv, matrix_norm1(D));
+    if (std::abs(rcond - 1e-8 / 7.0) > 1e-20) {
+        std::cout << "FAILED (diagonal rcond = " << rcond << ")\n";
+        return false;
+    }
+
+    // Exactly singular: rcond = 0 without dividing by the zero pivot
+    Matrix S(3, 3);
+    S(0, 0) = 1.0; S(0, 1) = 2.0;
+    S(1, 0) = 2.0; S(1, 1) = 4.0;
+    S(2, 2) = 1.0;
+    double snorm = matrix_norm1(S);
+    lu_unblocked(S, piv);
+    if (lu_rcond(S, piv, snorm) != 0.0) {
+        std::cout << "FAILED (singular rcond != 0)\n";
+        return false;
+    }
+
+    // Rank deficient up to rounding: rcond at the level of eps
+    Matrix A(60, 60);
+    A.fill_random();
+    for (int j = 0; j < 60; j++) A(59, j) = A(0, j) + A(1, j);
+    double norm = matrix_norm1(A);
+    LU = A;
+    lu_blocked(LU, piv, 16);
+    rcond = lu_rcond(LU, piv, norm);
+    if (rcond > 1e-13) {
+        std::cout << "FAILED (numerically singular rcond = " << rcond << ")\n";
+        return false;
+    }
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Condition Estimation\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_lu_estimate();
+    all_passed &= test_cholesky_estimate();
+    all_passed &= test_singular();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,217 @@
+#include "lu.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+#include "../../chapter1/src/dot.h"
+#include <algorithm>
+#include <cmath>
+
+// Block size handed to gemm_blocked for the trailing update
+static const int kGemmBlock = 64;
+
+// Swap rows r1 and r2 over all columns
+static void swap_rows(Matrix& A, int r1, int r2) {
+    if (r1 == r2) return;
+    std::swap_ranges(&A(r1, 0), &A(r1, 0) + A.n, &A(r2, 0));
+}
+
+// ============================================================================
+// PANEL: unblocked LU of columns c0..c1-1, rows c0..m-1
+//
+// for k = c0 .. c1-1:
+//     pivot on the largest |A(i,k)|, swap whole rows
+//     A(k+1:m, k) /= A(k,k)
+//     A(k+1:m, k+1:cend) -= A(k+1:m, k) * A(k, k+1:cend)
+// Returns false on an exactly zero pivot.
+// ============================================================================
+static bool lu_panel(Matrix& A, std::vector<int>& piv, int c0, int c1, int cend) {
+    const int m = A.m;
+    bool nonsingular = true;
+
+    for (int k = c0; k < c1; k++) {
+        int p = k;
+        double best = std::abs(A(k, k));
+        for (int i = k + 1; i < m; i++) {
+            if (std::abs(A(i, k)) > best) {
+                best = std::abs(A(i, k));
+                p = i;
+            }
+        }
+        piv[k] = p;
+        swap_rows(A, k, p);
+
+        if (A(k, k) == 0.0) {
+            nonsingular = false;
+            continue;
+        }
+        double inv = 1.0 / A(k, k);
+        const double* u_row = &A(k, 0);
+        for (int i = k + 1; i < m; i++) {
+            double* a_row = &A(i, 0);
+            double l = a_row[k] * inv;
+            a_row[k] = l;
+            for (int j = k + 1; j < cend; j++) a_row[j] -= l * u_row[j];
+        }
+    }
+    return nonsingular;
+}
+
+bool lu_unblocked(Matrix& A, std::vector<int>& piv) {
+    const int kmax = std::min(A.m, A.n);
+    piv.assign(kmax, 0);
+    return lu_panel(A, piv, 0, kmax, A.n);
+}
+
+// ============================================================================
+// BLOCKED LU
+// ============================================================================
+bool lu_blocked(Matrix& A, std::vector<int>& piv, int block_size) {
+    const int m = A.m;
+    const int n = A.n;
+    const int kmax = std::min(m, n);
+    piv.assign(kmax, 0);
+    bool nonsingular = true;
+
+    for (int j0 = 0; j0 < kmax; j0 += block_size) {
+        const int nb = std::min(block_size, kmax - j0);
+        const int jt = j0 + nb;
+        nonsingular &= lu_panel(A, piv, j0, jt, jt);
+        if (jt >= n) continue;
+
+        // U12 = L11^-1 * A12, row by row (unit lower triangular L11)
+        for (int i = j0 + 1; i < jt; i++) {
+            double* a_row = &A(i, 0);
+            for (int k = j0; k < i; k++) {
+                double l = a_row[k];
+                const double* u_row = &A(k, 0);
+                for (int j = jt; j < n; j++) a_row[j] -= l * u_row[j];
+            }
+        }
+
+        // A22 -= L21 * U12
+        if (jt >= m) continue;
+        Matrix L21_neg = A.block(jt, j0, m - jt, nb);
+        for (auto& x : L21_neg.data) x = -x;
+        Matrix U12 = A.block(j0, jt, nb, n - jt);
+        Matrix A22 = A.block(jt, jt, m - jt, n - jt);
+        gemm_blocked(L21_neg, U12, A22, kGemmBlock);
+        A.set_block(jt, jt, A22);
+    }
+    return nonsingular;
+}
+
+// ============================================================================
+// SOLVE: B = U^-1 * L^-1 * P * B, row-oriented so every update is a
+// contiguous saxpy over a row of B
+// ============================================================================
+void lu_solve(const Matrix& LU, const std::vector<int>& piv, Matrix& B) {
+    const int n = LU.n;
+    const int nrhs = B.n;
+
+    for (int k = 0; k < static_cast<int>(piv.size()); k++) swap_rows(B, k, piv[k]);
+
+    // One right-hand side: each row of the sweep is a dot product with a row
+    // of the factors (the saxpys below would be one element long)
+    if (nrhs == 1) {
+        double* b = B.data.data();
+        for (int i = 1; i < n; i++) b[i] -= dot(&LU(i, 0), b, i);
+        for (int i = n - 1; i >= 0; i--) {
+            const double* u_row = &LU(i, 0);
+            b[i] = (b[i] - dot(u_row + i + 1, b + i + 1, n - i - 1)) / u_row[i];
+        }
+        return;
+    }
+
+    // Forward: L*Y = P*B
+    for (int i = 1; i < n; i++) {
+        double* b_i = &B(i, 0);
+        for (int k = 0; k < i; k++) {
+            double l = LU(i, k);
+            if (l == 0.0) continue;
+            const double* b_k = &B(k, 0);
+            for (int j = 0; j < nrhs; j++) b_i[j] -= l * b_k[j];
+        }
+    }
+
+    // Backward: U*X = Y
+    for (int i = n - 1; i >= 0; i--) {
+        double* b_i = &B(i, 0);
+        for (int k = i + 1; k < n; k++) {
+            double u = LU(i, k);
+            const double* b_k = &B(k, 0);
+            for (int j = 0; j < nrhs; j++) b_i[j] -= u * b_k[j];
+        }
+        double inv = 1.0 / LU(i, i);
+        for (int j = 0; j < nrhs; j++) b_i[j] *= inv;
+    }
+}
+
+// ============================================================================
+// TRANSPOSED SOLVE: A^T = U^T * L^T * P, so B = P^T * L^-T * U^-T * B.
+// Row i of U^T is column i of U, so both sweeps are column-oriented over
+// the factors; each update is still a saxpy over a row of B.
+// ============================================================================
+void lu_solve_transpose(const Matrix& LU, const std::vector<int>& piv, Matrix& B) {
+    const int n = LU.n;
+    const int nrhs = B.n;
+
+    // One right-hand side: pushing b_i into the entries below (above) is a
+    // contiguous axpy with row i of U (L)
+    if (nrhs == 1) {
+        double* b = B.data.data();
+        for (int i = 0; i < n; i++) {
+            const double bi = b[i] /= LU(i, i);
+            const double* u_row = &LU(i, 0);
+            for (int k = i + 1; k < n; k++) b[k] -= bi * u_row[k];
+        }
+        for (int i = n - 1; i > 0; i--) {
+            const double bi = b[i];
+            const double* l_row = &LU(i, 0);
+            for (int k = 0; k < i; k++) b[k] -= bi * l_row[k];
+        }
+        for (int k = static_cast<int>(piv.size()) - 1; k >= 0; k--) swap_rows(B, k, piv[k]);
+        return;
+    }
+
+    // Forward: U^T*W = B. Once row i is final, push it into the rows below.
+    for (int i = 0; i < n; i++) {
+        double* b_i = &B(i, 0);
+        double inv = 1.0 / LU(i, i);
+        for (int j = 0; j < nrhs; j++) b_i[j] *= inv;
+        for (int k = i + 1; k < n; k++) {
+            double u = LU(i, k);
+            if (u == 0.0) continue;
+            double* b_k = &B(k, 0);
+            for (int j = 0; j < nrhs; j++) b_k[j] -= u * b_i[j];
+        }
+    }
+
+    // Backward: L^T*V = W (unit diagonal)
+    for (int i = n - 1; i > 0; i--) {
+        const double* b_i = &B(i, 0);
+        for (int k = 0; k < i; k++) {
+            double l = LU(i, k);
+            if (l == 0.0) continue;
+            double* b_k = &B(k, 0);
+            for (int j = 0; j < nrhs; j++) b_k[j] -= l * b_i[j];
+        }
+    }
+
+    for (int k = static_cast<int>(piv.size()) - 1; k >= 0; k--) swap_rows(B, k, piv[k]);
+}
+
+Matrix lu_inverse(const Matrix& LU, const std::vector<int>& piv) {
+    const int n = LU.n;
+    Matrix X(n, n);
+    for (int i = 0; i < n; i++) X(i, i) = 1.0;
+    lu_solve(LU, piv, X);
+    return X;
+}
+
+double lu_log_abs_det(const Matrix& LU) {
+    double s = 0.0;
+    for (int k = 0; k < std::min(LU.m, LU.n); k++) s += std::log(std::abs(LU(k, k)));
+    return s;
+}
+
+double lu_flops(int n) {
+    return 2.0 / 3.0 * static_cast<double>(n) * n * n;
+}
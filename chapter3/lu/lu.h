@@ -0,0 +1,44 @@
+#ifndef LU_H
+#define LU_H
+
+#include <vector>
+#include "../../chapter1/src/matrix_utils.h"
+
+// LU factorization with partial pivoting, P*A = L*U
+// Golub & Van Loan Sections 3.2 and 3.4
+//
+// Storage: on return A holds U on and above the diagonal and the
+// multipliers of L below it (unit diagonal not stored).
+// piv[k] is the row swapped with row k at step k (LAPACK xGETRF style).
+
+// ============================================================================
+// Unblocked reference (Algorithm 3.4.1, kji / outer product form)
+// Returns false if a zero pivot is met (A exactly singular).
+// ============================================================================
+bool lu_unblocked(Matrix& A, std::vector<int>& piv);
+
+// ============================================================================
+// Blocked right-looking LU (Algorithm 3.2.3 with pivoting, LAPACK xGETRF)
+// for each panel of block_size columns:
+//     factor the panel with the unblocked algorithm (rows swapped in full)
+//     U12 = L11^-1 * A12                      (triangular solve)
+//     A22 = A22 - L21 * U12                   (gemm_blocked)
+// ============================================================================
+bool lu_blocked(Matrix& A, std::vector<int>& piv, int block_size);
+
+// B = A^-1 * B using the factors from lu_unblocked / lu_blocked
+void lu_solve(const Matrix& LU, const std::vector<int>& piv, Matrix& B);
+
+// B = A^-T * B: U^T * W = B, L^T * V = W, then the swaps in reverse order
+void lu_solve_transpose(const Matrix& LU, const std::vector<int>& piv, Matrix& B);
+
+// A^-1 (one solve with the identity)
+Matrix lu_inverse(const Matrix& LU, const std::vector<int>& piv);
+
+// log|det(A)| = sum log|u_kk|, which cannot overflow
+double lu_log_abs_det(const Matrix& LU);
+
+// Flop count of the factorization (2/3 n^3)
+double lu_flops(int n);
+
+#endif // LU_H
@@ -0,0 +1,580 @@
+#include "matrix_expr.h"
+#include "../lu/lu.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+#include "../../chapter1/row_v_col/gaxpy.h"
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <map>
+#include <tuple>
+
+// ============================================================================
+// BUILDING: record a node, with its shape or -1 for a mismatch
+// ============================================================================
+Expr ExprGraph::add(ExprNode node) {
+    for (int a : node.args) {
+        if (nodes_[a].rows < 0) node.rows = node.cols = -1;
+    }
+    nodes_.push_back(std::move(node));
+    return Expr{this, static_cast<int>(nodes_.size()) - 1};
+}
+
+Expr ExprGraph::input(const Matrix& M, const std::string& name) {
+    ExprNode node{ExprOp::Input, M.m, M.n, {}, {}, &M, name.empty() ? "input" : name};
+    return add(node);
+}
+
+Expr operator*(Expr a, Expr b) {
+    ExprGraph* g = a.graph;
+    const bool ok = g->cols(a) == g->rows(b);
+    return g->add({ExprOp::Product, ok ? g->rows(a) : -1, ok ? g->cols(b) : -1,
+                   {a.id, b.id}, {}, nullptr, ""});
+}
+
+Expr operator*(double alpha, Expr a) {
+    return a.graph->add({ExprOp::LinComb, a.graph->rows(a), a.graph->cols(a),
+                         {a.id}, {alpha}, nullptr, ""});
+}
+
+Expr operator+(Expr a, Expr b) {
+    ExprGraph* g = a.graph;
+    const bool ok = g->rows(a) == g->rows(b) && g->cols(a) == g->cols(b);
+    return g->add({ExprOp::LinComb, ok ? g->rows(a) : -1, ok ? g->cols(a) : -1,
+                   {a.id, b.id}, {1.0, 1.0}, nullptr, ""});
+}
+
+// The planner folds the scaling into the sum
+Expr operator-(Expr a, Expr b) { return a + (-1.0) * b; }
+
+Expr transpose(Expr a) {
+    return a.graph->add({ExprOp::Transpose, a.graph->cols(a), a.graph->rows(a),
+                         {a.id}, {}, nullptr, ""});
+}
+
+Expr inverse(Expr a) {
+    ExprGraph* g = a.graph;
+    const bool ok = g->rows(a) == g->cols(a);
+    return g->add({ExprOp::Inverse, ok ? g->rows(a) : -1, ok ? g->cols(a) : -1,
+                   {a.id}, {}, nullptr, ""});
+}
+
+Expr solve(Expr a, Expr b) {
+    ExprGraph* g = a.graph;
+    const bool ok = g->rows(a) == g->cols(a) && g->rows(a) == g->rows(b);
+    return g->add({ExprOp::Solve, ok ? g->cols(a) : -1, ok ? g->cols(b) : -1,
+                   {a.id, b.id}, {}, nullptr, ""});
+}
+
+// ============================================================================
+// COST MODEL (flops), shared by the plan and the as-written evaluation
+// ============================================================================
+static double node_flops(const ExprNode& node, const std::vector<ExprNode>& nodes) {
+    const double m = node.rows, n = node.cols;
+    switch (node.op) {
+    case ExprOp::Product:
+        return 2.0 * m * n * nodes[node.args[0]].cols;
+    case ExprOp::LinComb:
+        return 2.0 * m * n * node.args.size();
+    case ExprOp::Inverse:
+        return 2.0 * n * n * n;
+    case ExprOp::Solve:
+        return 2.0 * m * m * n;
+    case ExprOp::SolveLeft:
+        return 2.0 * n * n * m;
+    default:
+        return 0.0;
+    }
+}
+
+// ============================================================================
+// PLANNING
+//
+// lower(u, t) returns the plan node for user node u, transposed when t is
+// set. Products and solves are collected into factor lists; inverse
+// factors are removed by solves; the rest of each chain is ordered by the
+// matrix-chain DP. Plan nodes are hash-consed on (op, args, coeffs, input).
+// ============================================================================
+namespace {
+
+struct Factor {
+    int id;
+    bool inverse;
+};
+
+class Planner {
+public:
+    explicit Planner(const std::vector<ExprNode>& nodes) : nodes_(nodes) {}
+
+    int lower(int u, bool t);
+
+    std::vector<ExprNode> plan;
+    int shared = 0;
+    int fused = 0;
+
+private:
+    int add(ExprNode node);
+    void collect_factors(int u, bool t, std::vector<Factor>& f, double& scale);
+    void collect_term(int u, bool t, double w, std::vector<int>& ids, std::vector<double>& c);
+    int build_chain(const std::vector<Factor>& f);
+    int order_chain(const std::vector<int>& ids);
+
+    const std::vector<ExprNode>& nodes_;
+    std::map<std::pair<int, bool>, int> memo_;
+    std::map<std::tuple<int, std::vector<int>, std::vector<double>, const Matrix*>, int> index_;
+};
+
+int Planner::add(ExprNode node) {
+    auto key = std::make_tuple(static_cast<int>(node.op), node.args, node.coeffs, node.value);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        shared++;
+        return it->second;
+    }
+    plan.push_back(std::move(node));
+    const int id = static_cast<int>(plan.size()) - 1;
+    index_[key] = id;
+    return id;
+}
+
+int Planner::lower(int u, bool t) {
+    auto it = memo_.find({u, t});
+    if (it != memo_.end()) return it->second;
+
+    const ExprNode& node = nodes_[u];
+    int id;
+    switch (node.op) {
+    case ExprOp::Input:
+        id = add({ExprOp::Input, node.rows, node.cols, {}, {}, node.value, node.name});
+        if (t) id = add({ExprOp::Transpose, node.cols, node.rows, {id}, {}, nullptr, ""});
+        break;
+    case ExprOp::Transpose:
+        id = lower(node.args[0], !t);
+        break;
+    case ExprOp::LinComb: {
+        std::vector<int> ids;
+        std::vector<double> c;
+        for (size_t k = 0; k < node.args.size(); k++) {
+            collect_term(node.args[k], t, node.coeffs[k], ids, c);
+        }
+        if (ids.size() == 1 && c[0] == 1.0) {
+            id = ids[0];
+        } else {
+            id = add({ExprOp::LinComb, plan[ids[0]].rows, plan[ids[0]].cols, ids, c, nullptr, ""});
+        }
+        break;
+    }
+    case ExprOp::Inverse: {
+        const int a = lower(node.args[0], t);
+        id = add({ExprOp::Inverse, plan[a].rows, plan[a].cols, {a}, {}, nullptr, ""});
+        break;
+    }
+    default: {   // Product, Solve
+        std::vector<Factor> f;
+        double scale = 1.0;
+        collect_factors(u, t, f, scale);
+        id = build_chain(f);
+        if (scale != 1.0) {
+            id = add({ExprOp::LinComb, plan[id].rows, plan[id].cols, {id}, {scale}, nullptr, ""});
+        }
+        break;
+    }
+    }
+    memo_[{u, t}] = id;
+    return id;
+}
+
+// Factors of a product in order; (XY)^T = Y^T X^T and (A^-1)^T = (A^T)^-1
+void Planner::collect_factors(int u, bool t, std::vector<Factor>& f, double& scale) {
+    const ExprNode& node = nodes_[u];
+    switch (node.op) {
+    case ExprOp::Product:
+        collect_factors(node.args[t ? 1 : 0], t, f, scale);
+        collect_factors(node.args[t ? 0 : 1], t, f, scale);
+        break;
+    case ExprOp::Solve:
+        if (!t) f.push_back({lower(node.args[0], false), true});
+        collect_factors(node.args[1], t, f, scale);
+        if (t) f.push_back({lower(node.args[0], true), true});
+        break;
+    case ExprOp::Inverse:
+        f.push_back({lower(node.args[0], t), true});
+        break;
+    case ExprOp::Transpose:
+        collect_factors(node.args[0], !t, f, scale);
+        break;
+    case ExprOp::LinComb:
+        if (node.args.size() == 1) {
+            fused++;
+            scale *= node.coeffs[0];
+            collect_factors(node.args[0], t, f, scale);
+            break;
+        }
+        f.push_back({lower(u, t), false});
+        break;
+    default:
+        f.push_back({lower(u, t), false});
+        break;
+    }
+}
+
+// A term of a linear combination; nested combinations are spliced in
+void Planner::collect_term(int u, bool t, double w, std::vector<int>& ids,
+                           std::vector<double>& c) {
+    const int id = lower(u, t);
+    std::vector<int> sub_ids = {id};
+    std::vector<double> sub_c = {1.0};
+    if (plan[id].op == ExprOp::LinComb) {
+        fused++;
+        sub_ids = plan[id].args;
+        sub_c = plan[id].coeffs;
+    }
+    for (size_t k = 0; k < sub_ids.size(); k++) {
+        auto it = std::find(ids.begin(), ids.end(), sub_ids[k]);
+        if (it != ids.end()) {
+            c[it - ids.begin()] += w * sub_c[k];
+        } else {
+            ids.push_back(sub_ids[k]);
+            c.push_back(w * sub_c[k]);
+        }
+    }
+}
+
+// Remove the last inverse factor with an LU solve against the narrower
+// side, then repeat; what is left is an ordinary chain
+int Planner::build_chain(const std::vector<Factor>& f) {
+    int p = static_cast<int>(f.size()) - 1;
+    while (p >= 0 && !f[p].inverse) p--;
+    if (p < 0) {
+        std::vector<int> ids;
+        for (const auto& x : f) ids.push_back(x.id);
+        return order_chain(ids);
+    }
+
+    const int a = f[p].id;
+    const int n = plan[a].rows;
+    std::vector<Factor> left(f.begin(), f.begin() + p);
+    std::vector<Factor> right(f.begin() + p + 1, f.end());
+    if (left.empty() && right.empty()) {
+        return add({ExprOp::Inverse, n, n, {a}, {}, nullptr, ""});
+    }
+
+    const double inf = std::numeric_limits<double>::infinity();
+    const double left_rows = left.empty() ? inf : plan[left.front().id].rows;
+    const double right_cols = right.empty() ? inf : plan[right.back().id].cols;
+    std::vector<Factor> rest;
+    if (left_rows < right_cols) {
+        // Y A^-1 = (A^-T Y^T)^T, with Y the product of the left factors
+        const int y = build_chain(left);
+        rest.push_back({add({ExprOp::SolveLeft, plan[y].rows, n, {a, y}, {}, nullptr, ""}), false});
+        rest.insert(rest.end(), right.begin(), right.end());
+    } else {
+        std::vector<int> ids;
+        for (const auto& x : right) ids.push_back(x.id);
+        const int b = order_chain(ids);
+        rest = left;
+        rest.push_back({add({ExprOp::Solve, n, plan[b].cols, {a, b}, {}, nullptr, ""}), false});
+    }
+    return build_chain(rest);
+}
+
+// Matrix-chain order: cost(i, j) = min_s cost(i, s) + cost(s+1, j) + 2 p_i p_{s+1} p_{j+1}
+int Planner::order_chain(const std::vector<int>& ids) {
+    const int k = static_cast<int>(ids.size());
+    std::vector<double> p(k + 1);
+    for (int i = 0; i < k; i++) p[i] = plan[ids[i]].rows;
+    p[k] = plan[ids[k - 1]].cols;
+
+    std::vector<std::vector<double>> cost(k, std::vector<double>(k, 0.0));
+    std::vector<std::vector<int>> split(k, std::vector<int>(k, 0));
+    for (int len = 2; len <= k; len++) {
+        for (int i = 0; i + len - 1 < k; i++) {
+            const int j = i + len - 1;
+            cost[i][j] = std::numeric_limits<double>::infinity();
+            for (int s = i; s < j; s++) {
+                const double c = cost[i][s] + cost[s + 1][j] + 2.0 * p[i] * p[s + 1] * p[j + 1];
+                if (c < cost[i][j]) {
+                    cost[i][j] = c;
+                    split[i][j] = s;
+                }
+            }
+        }
+    }
+
+    std::function<int(int, int)> build = [&](int i, int j) {
+        if (i == j) return ids[i];
+        const int s = split[i][j];
+        const int l = build(i, s);
+        const int r = build(s + 1, j);
+        return add({ExprOp::Product, plan[l].rows, plan[r].cols, {l, r}, {}, nullptr, ""});
+    };
+    return build(0, k - 1);
+}
+
+// Plan nodes reachable from the root, with their number of consumers
+std::vector<int> count_uses(const std::vector<ExprNode>& plan, int root) {
+    std::vector<int> uses(plan.size(), 0);
+    std::vector<bool> live(plan.size(), false);
+    live[root] = true;
+    for (int id = root; id >= 0; id--) {
+        if (!live[id]) continue;
+        for (int a : plan[id].args) {
+            live[a] = true;
+            uses[a]++;
+        }
+    }
+    for (int id = 0; id <= root; id++) {
+        if (!live[id]) uses[id] = -1;
+    }
+    return uses;
+}
+
+// ============================================================================
+// KERNELS shared by the plan and the as-written evaluation
+// ============================================================================
+Matrix multiply(const Matrix& A, const Matrix& B, int block_size) {
+    Matrix C(A.m, B.n);
+    if (B.n == 1) {
+        gaxpy_row_oriented(A, B.data, C.data);
+    } else {
+        gemm_blocked(A, B, C, block_size);
+    }
+    return C;
+}
+
+// One pass over the output in chunks that stay in L1 while every term is
+// added in
+Matrix linear_combination(const std::vector<const Matrix*>& terms,
+                          const std::vector<double>& c) {
+    const int kChunk = 1024;
+    Matrix C(terms[0]->m, terms[0]->n);
+    const size_t size = C.data.size();
+    for (size_t i0 = 0; i0 < size; i0 += kChunk) {
+        const size_t i1 = std::min(size, i0 + kChunk);
+        double* out = C.data.data();
+        const double* x0 = terms[0]->data.data();
+        for (size_t i = i0; i < i1; i++) out[i] = c[0] * x0[i];
+        for (size_t k = 1; k < terms.size(); k++) {
+            const double* x = terms[k]->data.data();
+            const double ck = c[k];
+            for (size_t i = i0; i < i1; i++) out[i] += ck * x[i];
+        }
+    }
+    return C;
+}
+
+struct LUFactor {
+    Matrix LU = Matrix(0, 0);
+    std::vector<int> piv;
+    bool ok = false;
+};
+
+LUFactor factor(const Matrix& A, int block_size) {
+    LUFactor F;
+    F.LU = A;
+    F.ok = lu_blocked(F.LU, F.piv, block_size);
+    return F;
+}
+
+} // namespace
+
+// ============================================================================
+// EXECUTION: plan nodes are created after their arguments, so one sweep in
+// id order is a valid schedule. Values are released after their last use
+// and each distinct matrix is LU-factored at most once.
+// ============================================================================
+bool ExprGraph::evaluate(Expr e, Matrix& result, ExprStats* stats) {
+    if (nodes_[e.id].rows < 0) return false;
+    Planner planner(nodes_);
+    const int root = planner.lower(e.id, false);
+    const std::vector<ExprNode>& plan = planner.plan;
+    std::vector<int> uses = count_uses(plan, root);
+
+    std::vector<Matrix> values(plan.size(), Matrix(0, 0));
+    auto val = [&](int x) -> const Matrix& {
+        return plan[x].op == ExprOp::Input ? *plan[x].value : values[x];
+    };
+    std::map<int, LUFactor> factors;
+    auto lu_of = [&](int a) -> const LUFactor& {
+        auto it = factors.find(a);
+        if (it == factors.end()) it = factors.emplace(a, factor(val(a), block_size_)).first;
+        return it->second;
+    };
+
+    ExprStats s;
+    for (int id = 0; id <= root; id++) {
+        const ExprNode& node = plan[id];
+        if (uses[id] < 0) continue;
+        const std::vector<int>& a = node.args;
+        switch (node.op) {
+        case ExprOp::Input:
+            break;
+        case ExprOp::Product:
+            values[id] = multiply(val(a[0]), val(a[1]), block_size_);
+            break;
+        case ExprOp::LinComb: {
+            std::vector<const Matrix*> terms;
+            for (int x : a) terms.push_back(&val(x));
+            values[id] = linear_combination(terms, node.coeffs);
+            break;
+        }
+        case ExprOp::Transpose:
+            values[id] = val(a[0]).transpose();
+            break;
+        case ExprOp::Inverse:
+        case ExprOp::Solve:
+        case ExprOp::SolveLeft: {
+            if (factors.find(a[0]) == factors.end()) s.flops_planned += lu_flops(plan[a[0]].rows);
+            const LUFactor& F = lu_of(a[0]);
+            if (!F.ok) return false;
+            if (node.op == ExprOp::Inverse) {
+                values[id] = lu_inverse(F.LU, F.piv);
+            } else if (node.op == ExprOp::Solve) {
+                values[id] = val(a[1]);
+                lu_solve(F.LU, F.piv, values[id]);
+            } else {
+                Matrix Yt = val(a[1]).transpose();
+                lu_solve_transpose(F.LU, F.piv, Yt);
+                values[id] = Yt.transpose();
+            }
+            break;
+        }
+        }
+        s.flops_planned += node_flops(node, plan);
+        if (node.op != ExprOp::Input) s.plan_nodes++;
+        for (int x : a) {
+            if (--uses[x] == 0) values[x] = Matrix(0, 0);
+        }
+    }
+    result = plan[root].op == ExprOp::Input ? *plan[root].value : std::move(values[root]);
+
+    if (stats) {
+        s.shared = planner.shared;
+        s.fused = planner.fused;
+        // Eager cost: every user node reachable from e once, A^-1 formed
+        std::vector<bool> seen(nodes_.size(), false);
+        std::function<void(int)> visit = [&](int u) {
+            if (seen[u]) return;
+            seen[u] = true;
+            for (int x : nodes_[u].args) visit(x);
+            const ExprNode& node = nodes_[u];
+            s.flops_as_written += node_flops(node, nodes_);
+            if (node.op == ExprOp::Inverse || node.op == ExprOp::Solve) {
+                s.flops_as_written += lu_flops(nodes_[node.args[0]].rows);
+            }
+        };
+        visit(e.id);
+        *stats = s;
+    }
+    return true;
+}
+
+// ============================================================================
+// AS WRITTEN: each user node evaluated once, in the order and association
+// it was written, inverses formed explicitly
+// ============================================================================
+bool ExprGraph::evaluate_as_written(Expr e, Matrix& result) {
+    if (nodes_[e.id].rows < 0) return false;
+    std::vector<Matrix> values(e.id + 1, Matrix(0, 0));
+    std::vector<bool> done(e.id + 1, false);
+    auto val = [&](int x) -> const Matrix& {
+        return nodes_[x].op == ExprOp::Input ? *nodes_[x].value : values[x];
+    };
+    bool ok = true;
+
+    std::function<void(int)> eval = [&](int u) {
+        if (done[u] || !ok) return;
+        const ExprNode& node = nodes_[u];
+        for (int x : node.args) eval(x);
+        if (!ok) return;
+        const std::vector<int>& a = node.args;
+        switch (node.op) {
+        case ExprOp::Input:
+            break;
+        case ExprOp::Product:
+            values[u] = multiply(val(a[0]), val(a[1]), block_size_);
+            break;
+        case ExprOp::LinComb: {
+            std::vector<const Matrix*> terms;
+            for (int x : a) terms.push_back(&val(x));
+            values[u] = linear_combination(terms, node.coeffs);
+            break;
+        }
+        case ExprOp::Transpose:
+            values[u] = val(a[0]).transpose();
+            break;
+        default: {   // Inverse, Solve
+            LUFactor F = factor(val(a[0]), block_size_);
+            if (!F.ok) {
+                ok = false;
+                return;
+            }
+            if (node.op == ExprOp::Inverse) {
+                values[u] = lu_inverse(F.LU, F.piv);
+            } else {
+                values[u] = val(a[1]);
+                lu_solve(F.LU, F.piv, values[u]);
+            }
+            break;
+        }
+        }
+        done[u] = true;
+    };
+    eval(e.id);
+    if (!ok) return false;
+    result = val(e.id);
+    return true;
+}
+
+// ============================================================================
+// EXPLAIN
+// ============================================================================
+std::string ExprGraph::explain(Expr e) {
+    if (nodes_[e.id].rows < 0) return "shape mismatch\n";
+    Planner planner(nodes_);
+    const int root = planner.lower(e.id, false);
+    const std::vector<ExprNode>& plan = planner.plan;
+    std::vector<int> uses = count_uses(plan, root);
+
+    std::string out;
+    char line[160];
+    for (int id = 0; id <= root; id++) {
+        if (uses[id] < 0) continue;
+        const ExprNode& node = plan[id];
+        const std::vector<int>& a = node.args;
+        std::string rhs;
+        switch (node.op) {
+        case ExprOp::Input:
+            rhs = node.name;
+            break;
+        case ExprOp::Product:
+            rhs = "t" + std::to_string(a[0]) + " * t" + std::to_string(a[1]) +
+                  (node.cols == 1 ? "   [gaxpy]" : "   [gemm]");
+            break;
+        case ExprOp::LinComb:
+            for (size_t k = 0; k < a.size(); k++) {
+                char term[48];
+                std::snprintf(term, sizeof(term), "%s%g*t%d", k ? " + " : "", node.coeffs[k], a[k]);
+                rhs += term;
+            }
+            rhs += "   [one pass]";
+            break;
+        case ExprOp::Transpose:
+            rhs = "t" + std::to_string(a[0]) + "^T";
+            break;
+        case ExprOp::Inverse:
+            rhs = "inv(t" + std::to_string(a[0]) + ")   [LU]";
+            break;
+        case ExprOp::Solve:
+            rhs = "t" + std::to_string(a[0]) + " \\ t" + std::to_string(a[1]) + "   [LU solve]";
+            break;
+        case ExprOp::SolveLeft:
+            rhs = "t" + std::to_string(a[1]) + " / t" + std::to_string(a[0]) + "   [LU solve]";
+            break;
+        }
+        std::snprintf(line, sizeof(line), "t%-3d %5d x %-5d = %s\n", id, node.rows, node.cols,
+                      rhs.c_str());
+        out += line;
+    }
+    return out;
+}
@@ -0,0 +1,101 @@
+#ifndef MATRIX_EXPR_H
+#define MATRIX_EXPR_H
+
+#include <string>
+#include <vector>
+#include "../../chapter1/src/matrix_utils.h"
+
+// Lazy matrix expressions with a planning step before execution
+//
+// Operators on Expr only record nodes in an ExprGraph. evaluate() lowers
+// the expression to a plan and runs it on the existing kernels:
+//   - transposes are pushed to the leaves, (XY)^T = Y^T X^T
+//   - products (including A^-1 factors and solve(A, B)) are flattened into
+//     chains; each chain without inverses is ordered by the matrix-chain
+//     dynamic program on shapes (Cormen et al., Section 15.2), so A*B*x
+//     costs two matrix-vector products and not a matrix product
+//   - an inverse factor becomes an LU solve (chapter3/lu) with whichever
+//     side of the chain is narrower; A^-1 is only formed when it stands
+//     alone, and each distinct A is factored once
+//   - sums, differences and scalings are flattened into one linear
+//     combination, evaluated in a single elementwise pass
+//   - structurally equal plan nodes are merged (hash-consing), so a
+//     repeated subexpression is computed once
+// Products with one column go to gaxpy_row_oriented, the others to
+// gemm_blocked.
+
+enum class ExprOp { Input, Product, LinComb, Transpose, Inverse, Solve, SolveLeft };
+
+// One node; rows = cols = -1 marks an expression with mismatched shapes
+struct ExprNode {
+    ExprOp op;
+    int rows, cols;
+    std::vector<int> args;
+    std::vector<double> coeffs;       // LinComb weights, one per arg
+    const Matrix* value = nullptr;    // Input only
+    std::string name;                 // Input only, for explain()
+};
+
+class ExprGraph;
+
+// Handle to a node of an ExprGraph, cheap to copy
+struct Expr {
+    ExprGraph* graph;
+    int id;
+};
+
+Expr operator*(Expr a, Expr b);            // matrix product
+Expr operator*(double alpha, Expr a);
+Expr operator+(Expr a, Expr b);
+Expr operator-(Expr a, Expr b);
+Expr transpose(Expr a);
+Expr inverse(Expr a);
+Expr solve(Expr a, Expr b);                // A^-1 B
+
+// Flop counts of the expression as written (each operator evaluated eagerly,
+// left to right, A^-1 formed explicitly) and of the plan
+struct ExprStats {
+    double flops_as_written = 0.0;
+    double flops_planned = 0.0;
+    int plan_nodes = 0;       // operations in the plan, inputs excluded
+    int shared = 0;           // plan nodes reused by hash-consing
+    int fused = 0;            // sums and scalings folded into another node
+};
+
+class ExprGraph {
+public:
+    explicit ExprGraph(int block_size = 64) : block_size_(block_size) {}
+
+    // Leaf referring to M, which must outlive every evaluate() that uses it
+    Expr input(const Matrix& M, const std::string& name = "");
+
+    int rows(Expr e) const { return nodes_[e.id].rows; }
+    int cols(Expr e) const { return nodes_[e.id].cols; }
+
+    // Plan and run. Returns false if the shapes do not match or a solve
+    // meets an exactly singular matrix.
+    bool evaluate(Expr e, Matrix& result, ExprStats* stats = nullptr);
+
+    // Eager evaluation of the expression exactly as written: the reference
+    // the plan is tested and benchmarked against
+    bool evaluate_as_written(Expr e, Matrix& result);
+
+    // The plan as text, one operation per line in execution order
+    std::string explain(Expr e);
+
+private:
+    friend Expr operator*(Expr, Expr);
+    friend Expr operator*(double, Expr);
+    friend Expr operator+(Expr, Expr);
+    friend Expr operator-(Expr, Expr);
+    friend Expr transpose(Expr);
+    friend Expr inverse(Expr);
+    friend Expr solve(Expr, Expr);
+
+    Expr add(ExprNode node);
+
+    int block_size_;
+    std::vector<ExprNode> nodes_;
+};
+
+#endif // MATRIX_EXPR_H
@@ -0,0 +1,110 @@
+#include "cholesky.h"
+#include "../../chapter1/syrk/syrk.h"
+#include "../../chapter1/src/dot.h"
+#include <algorithm>
+#include <cmath>
+
+// Block size handed to syrk for the trailing update
+static const int kSyrkBlock = 64;
+
+// ============================================================================
+// DIAGONAL BLOCK: factor A(c0:c1, c0:c1) in place, assuming the columns left
+// of c0 have already been subtracted (right-looking order)
+// ============================================================================
+static bool cholesky_diagonal_block(Matrix& A, int c0, int c1) {
+    for (int i = c0; i < c1; i++) {
+        double* a_i = &A(i, c0);
+        for (int j = c0; j < i; j++) {
+            const double* a_j = &A(j, c0);
+            a_i[j - c0] = (a_i[j - c0] - dot(a_i, a_j, j - c0)) / A(j, j);
+        }
+        double d = a_i[i - c0] - dot(a_i, a_i, i - c0);
+        if (!(d > 0.0)) return false;
+        a_i[i - c0] = std::sqrt(d);
+    }
+    return true;
+}
+
+bool cholesky_unblocked(Matrix& A) {
+    return cholesky_diagonal_block(A, 0, A.n);
+}
+
+// ============================================================================
+// BLOCKED CHOLESKY
+// ============================================================================
+bool cholesky_blocked(Matrix& A, int block_size) {
+    const int n = A.n;
+
+    for (int j0 = 0; j0 < n; j0 += block_size) {
+        const int nb = std::min(block_size, n - j0);
+        const int jt = j0 + nb;
+        if (!cholesky_diagonal_block(A, j0, jt)) return false;
+        if (jt >= n) continue;
+
+        // L21 = A21 * L11^-T: row i solves L11 * x = A(i, j0:jt)^T
+        for (int i = jt; i < n; i++) {
+            double* a_i = &A(i, j0);
+            for (int j = j0; j < jt; j++) {
+                a_i[j - j0] = (a_i[j - j0] - dot(a_i, &A(j, j0), j - j0)) / A(j, j);
+            }
+        }
+
+        // A22 -= L21 * L21^T on the lower triangle only
+        Matrix A22 = A.block(jt, jt, n - jt, n - jt);
+        syrk(A.block(jt, j0, n - jt, nb), A22, -1.0, Triangle::Lower, false, kSyrkBlock);
+        for (int i = 0; i < A22.m; i++) {
+            std::copy(&A22(i, 0), &A22(i, 0) + i + 1, &A(jt + i, jt));
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// SOLVE: both sweeps update whole rows of B
+// ============================================================================
+void cholesky_solve(const Matrix& L, Matrix& B) {
+    const int n = L.n;
+    const int nrhs = B.n;
+
+    // One right-hand side: a dot product per row forward, an axpy with the
+    // same row backward
+    if (nrhs == 1) {
+        double* b = B.data.data();
+        for (int i = 0; i < n; i++) b[i] = (b[i] - dot(&L(i, 0), b, i)) / L(i, i);
+        for (int i = n - 1; i >= 0; i--) {
+            const double bi = b[i] /= L(i, i);
+            const double* l_row = &L(i, 0);
+            for (int k = 0; k < i; k++) b[k] -= bi * l_row[k];
+        }
+        return;
+    }
+
+    // Forward: L*Y = B
+    for (int i = 0; i < n; i++) {
+        double* b_i = &B(i, 0);
+        for (int k = 0; k < i; k++) {
+            double l = L(i, k);
+            const double* b_k = &B(k, 0);
+            for (int j = 0; j < nrhs; j++) b_i[j] -= l * b_k[j];
+        }
+        double inv = 1.0 / L(i, i);
+        for (int j = 0; j < nrhs; j++) b_i[j] *= inv;
+    }
+
+    // Backward: L^T*X = Y. Row i of X is final once the rows below have
+    // been pushed into it; then push it into the rows above (column i of L^T).
+    for (int i = n - 1; i >= 0; i--) {
+        double* b_i = &B(i, 0);
+        double inv = 1.0 / L(i, i);
+        for (int j = 0; j < nrhs; j++) b_i[j] *= inv;
+        for (int k = 0; k < i; k++) {
+            double l = L(i, k);
+            double* b_k = &B(k, 0);
+            for (int j = 0; j < nrhs; j++) b_k[j] -= l * b_i[j];
+        }
+    }
+}
+
+double cholesky_flops(int n) {
+    return static_cast<double>(n) * n * n / 3.0;
+}
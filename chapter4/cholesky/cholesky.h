@@ -0,0 +1,39 @@
+#ifndef CHOLESKY_H
+#define CHOLESKY_H
+
+#include "../../chapter1/src/matrix_utils.h"
+
+// Cholesky factorization A = L * L^T of a symmetric positive definite A
+// Golub & Van Loan Section 4.2
+//
+// Only the lower triangle of A is read. On return it holds L; the strict
+// upper triangle is left untouched (LAPACK xPOTRF with uplo = 'L').
+// The factorizations return false if a pivot is not positive, i.e. A is
+// not numerically positive definite; the factor is then incomplete.
+
+// ============================================================================
+// Unblocked reference (Algorithm 4.2.2, gaxpy / dot product form)
+//   L(i,j) = (A(i,j) - L(i,0:j) . L(j,0:j)) / L(j,j),   j < i
+//   L(i,i) = sqrt(A(i,i) - L(i,0:i) . L(i,0:i))
+// Row i is built from rows 0..i, so every dot product is over two
+// contiguous row prefixes.
+// ============================================================================
+bool cholesky_unblocked(Matrix& A);
+
+// ============================================================================
+// Blocked right-looking Cholesky (Section 4.2.9, LAPACK xPOTRF)
+// for each diagonal block of block_size columns:
+//     L11 = chol(A11)                       (unblocked)
+//     L21 = A21 * L11^-T                    (row-wise triangular solve)
+//     A22 = A22 - L21 * L21^T               (syrk, lower triangle only)
+// ============================================================================
+bool cholesky_blocked(Matrix& A, int block_size);
+
+// B = A^-1 * B with the factor from cholesky_unblocked / cholesky_blocked:
+// L * Y = B, then L^T * X = Y, row-oriented like lu_solve
+void cholesky_solve(const Matrix& L, Matrix& B);
+
+// Flop count of the factorization (n^3 / 3)
+double cholesky_flops(int n);
+
+#endif // CHOLESKY_H
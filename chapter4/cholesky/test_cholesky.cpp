@@ -0,0 +1,122 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include "cholesky.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+
+// ||A - L*L^T||_max over the lower triangle of the factor
+double reconstruction_error(const Matrix& A, const Matrix& F) {
+    const int n = A.n;
+    Matrix L(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j <= i; j++) L(i, j) = F(i, j);
+    }
+    Matrix LLt(n, n);
+    gemm_ikj(L, L.transpose(), LLt);
+    double max_diff = 0.0;
+    for (size_t i = 0; i < A.data.size(); i++) {
+        max_diff = std::max(max_diff, std::abs(A.data[i] - LLt.data[i]));
+    }
+    return max_diff;
+}
+
+bool test_factorization() {
+    std::cout << "Testing unblocked and blocked Cholesky... ";
+
+    for (int n : {1, 5, 64, 129, 200}) {
+        Matrix A = random_spd(n);
+        const double tol = 1e-13 * n * n;
+
+        Matrix L_ref = A;
+        if (!cholesky_unblocked(L_ref) || reconstruction_error(A, L_ref) > tol) {
+            std::cout << "FAILED (unblocked, n=" << n << ")\n";
+            return false;
+        }
+
+        for (int block_size : {8, 32}) {
+            Matrix L = A;
+            // Garbage in the strict upper triangle must be ignored and kept
+            for (int i = 0; i < n; i++) {
+                for (int j = i + 1; j < n; j++) L(i, j) = -7.0;
+            }
+            if (!cholesky_blocked(L, block_size) || reconstruction_error(A, L) > tol) {
+                std::cout << "FAILED (blocked, n=" << n << ", block_size=" << block_size << ")\n";
+                return false;
+            }
+            for (int i = 0; i < n; i++) {
+                for (int j = i + 1; j < n; j++) {
+                    if (L(i, j) != -7.0) {
+                        std::cout << "FAILED (upper triangle written)\n";
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_solve_and_indefinite() {
+    std::cout << "Testing solve and indefinite detection... ";
+
+    const int n = 100;
+    Matrix A = random_spd(n);
+    Matrix L = A;
+    cholesky_blocked(L, 16);
+
+    for (int nrhs : {1, 4}) {
+        Matrix B(n, nrhs);
+        B.fill_random();
+        Matrix X = B;
+        cholesky_solve(L, X);
+        Matrix AX(n, nrhs);
+        gemm_ikj(A, X, AX);
+        for (size_t i = 0; i < B.data.size(); i++) {
+            if (std::abs(AX.data[i] - B.data[i]) > 1e-11) {
+                std::cout << "FAILED (A * X != B, nrhs=" << nrhs << ")\n";
+                return false;
+            }
+        }
+    }
+
+    // Symmetric but indefinite: eigenvalues 3 and -1
+    Matrix S(2, 2);
+    S(0, 0) = 1.0; S(0, 1) = 2.0;
+    S(1, 0) = 2.0; S(1, 1) = 1.0;
+    if (cholesky_unblocked(S)) {
+        std::cout << "FAILED (indefinite matrix not detected)\n";
+        return false;
+    }
+
+    // Indefinite only in a late block
+    Matrix T = random_spd(50);
+    T(45, 45) = -1.0;
+    if (cholesky_blocked(T, 16)) {
+        std::cout << "FAILED (indefinite trailing block not detected)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Cholesky Factorization\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_factorization();
+    all_passed &= test_solve_and_indefinite();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
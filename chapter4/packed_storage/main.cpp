@@ -0,0 +1,124 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include "packed_storage.h"
+#include "../cholesky/cholesky.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+#include "../../chapter1/symv/symv.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+void print_row(const char* label, double ms, double gflop) {
+    std::cout << "  " << std::left << std::setw(28) << label << std::right
+              << std::setw(10) << ms << " ms" << std::setw(10) << gflop / (ms * 1e-3)
+              << " GFLOPS\n";
+}
+
+// Dense vs packed vs RFP: memory, Cholesky, SYMV, one-vector solve
+void benchmark_size(int n, int block_size) {
+    Matrix B(n, n);
+    B.fill_random();
+    Matrix A(n, n);
+    gemm_blocked(B, B.transpose(), A, 64);
+    for (int i = 0; i < n; i++) A(i, i) += n;
+    Timer timer;
+
+    std::cout << "Matrix size: " << n << "×" << n << " (block_size=" << block_size << ")\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "  Storage: dense " << 8.0 * n * n / 1e6 << " MB, packed and RFP "
+              << 4.0 * n * (n + 1.0) / 1e6 << " MB\n";
+
+    PackedMatrix P = pack_lower(A);
+    RFPMatrix F = pack_rfp(A);
+
+    // SYMV: each kernel reads its n(n+1)/2 stored entries once
+    std::vector<double> x(n, 1.0), y(n, 0.0);
+    const int reps = std::max(3, static_cast<int>(2e8 / (double(n) * n)));
+    const double symv_gflop = 2.0 * n * n * reps / 1e9;
+    timer.start();
+    for (int r = 0; r < reps; r++) symv_lower(A, x, y);
+    double t_symv = timer.elapsed_ms();
+    timer.start();
+    for (int r = 0; r < reps; r++) packed_symv(P, x, y);
+    double t_psymv = timer.elapsed_ms();
+    timer.start();
+    for (int r = 0; r < reps; r++) rfp_symv(F, x, y);
+    double t_rsymv = timer.elapsed_ms();
+
+    Matrix L = A;
+    timer.start();
+    cholesky_blocked(L, block_size);
+    double t_dense = timer.elapsed_ms();
+    timer.start();
+    packed_cholesky(P);
+    double t_packed = timer.elapsed_ms();
+    timer.start();
+    rfp_cholesky(F, block_size);
+    double t_rfp = timer.elapsed_ms();
+
+    Matrix b(n, 1);
+    b.fill_random();
+    Matrix x_d = b, x_p = b, x_f = b;
+    timer.start();
+    cholesky_solve(L, x_d);
+    double t_sd = timer.elapsed_ms();
+    timer.start();
+    packed_cholesky_solve(P, x_p);
+    double t_sp = timer.elapsed_ms();
+    timer.start();
+    rfp_cholesky_solve(F, x_f);
+    double t_sf = timer.elapsed_ms();
+
+    const double chol_gflop = cholesky_flops(n) / 1e9;
+    const double solve_gflop = 2.0 * n * n / 1e9;
+    std::cout << "  SYMV (" << reps << " products):\n";
+    print_row("  dense (symv_lower):", t_symv, symv_gflop);
+    print_row("  packed:", t_psymv, symv_gflop);
+    print_row("  RFP:", t_rsymv, symv_gflop);
+    std::cout << "  Cholesky:\n";
+    print_row("  dense (cholesky_blocked):", t_dense, chol_gflop);
+    print_row("  packed (Level 2):", t_packed, chol_gflop);
+    print_row("  RFP (blocked):", t_rfp, chol_gflop);
+    std::cout << "  Solve, one right-hand side:\n";
+    print_row("  dense:", t_sd, solve_gflop);
+    print_row("  packed:", t_sp, solve_gflop);
+    print_row("  RFP:", t_sf, solve_gflop);
+    std::cout << "  " << std::left << std::setw(28) << "RFP vs packed Cholesky:"
+              << std::right << std::setw(10) << t_packed / t_rfp << "x\n\n";
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "================================================================\n";
+    std::cout << "PACKED AND RFP STORAGE BENCHMARK\n";
+    std::cout << "Dense vs packed vs rectangular full packed (half the memory)\n";
+    std::cout << "================================================================\n";
+#ifdef _OPENMP
+    std::cout << "Threads: " << omp_get_max_threads() << "\n\n";
+#else
+    std::cout << "Threads: 1 (compiled without -fopenmp)\n\n";
+#endif
+
+    std::vector<int> sizes = {500, 1000, 2000};
+    int block_size = 64;
+
+    // Usage: ./packed_bench [n] [block_size]
+    if (argc > 1) sizes = {atoi(argv[1])};
+    if (argc > 2) block_size = atoi(argv[2]);
+
+    for (int n : sizes) {
+        benchmark_size(n, block_size);
+    }
+
+    std::cout << "What to look for:\n";
+    std::cout << "  • Packed and RFP hold n(n+1)/2 doubles; SYMV streams the same\n";
+    std::cout << "    bytes in all three formats and runs at about the same speed\n";
+    std::cout << "  • Packed Cholesky is Level 2 and falls behind once the rows\n";
+    std::cout << "    leave cache; RFP keeps the tiles of the dense blocked code\n";
+    std::cout << "  • The solves are Level 2 in every format\n";
+    std::cout << "Usage: " << argv[0] << " [n] [block_size]\n";
+
+    return 0;
+}
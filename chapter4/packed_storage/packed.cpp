@@ -0,0 +1,93 @@
+#include "packed_storage.h"
+#include "../../chapter1/src/dot.h"
+#include <algorithm>
+#include <cmath>
+
+// ============================================================================
+// CONVERSIONS
+// ============================================================================
+PackedMatrix pack_lower(const Matrix& A) {
+    PackedMatrix P(A.n);
+    for (int i = 0; i < A.n; i++) std::copy(&A(i, 0), &A(i, 0) + i + 1, P.row(i));
+    return P;
+}
+
+Matrix unpack_lower(const PackedMatrix& P) {
+    Matrix A(P.n, P.n);
+    for (int i = 0; i < P.n; i++) std::copy(P.row(i), P.row(i) + i + 1, &A(i, 0));
+    return A;
+}
+
+// ============================================================================
+// SYMV: row i is row i and column i of A (see chapter1/symv)
+// ============================================================================
+void packed_symv(const PackedMatrix& P, const std::vector<double>& x, std::vector<double>& y) {
+    for (int i = 0; i < P.n; i++) {
+        const double* a_row = P.row(i);
+        const double x_i = x[i];
+        const double y_i = dot(a_row, x.data(), i);
+        for (int j = 0; j < i; j++) y[j] += a_row[j] * x_i;
+        y[i] += y_i + a_row[i] * x_i;
+    }
+}
+
+// ============================================================================
+// CHOLESKY: row i of L needs rows 0..i, all contiguous prefixes
+// ============================================================================
+bool packed_cholesky(PackedMatrix& P) {
+    for (int i = 0; i < P.n; i++) {
+        double* l_i = P.row(i);
+        for (int j = 0; j < i; j++) {
+            const double* l_j = P.row(j);
+            l_i[j] = (l_i[j] - dot(l_i, l_j, j)) / l_j[j];
+        }
+        double d = l_i[i] - dot(l_i, l_i, i);
+        if (!(d > 0.0)) return false;
+        l_i[i] = std::sqrt(d);
+    }
+    return true;
+}
+
+// Same sweeps as cholesky_solve: forward with rows of L, backward pushing
+// each finished row of X into the rows above
+void packed_cholesky_solve(const PackedMatrix& L, Matrix& B) {
+    const int n = L.n;
+    const int nrhs = B.n;
+
+    // One right-hand side: a dot product per row forward, an axpy with the
+    // same row backward
+    if (nrhs == 1) {
+        double* b = B.data.data();
+        for (int i = 0; i < n; i++) b[i] = (b[i] - dot(L.row(i), b, i)) / L(i, i);
+        for (int i = n - 1; i >= 0; i--) {
+            const double bi = b[i] /= L(i, i);
+            const double* l_row = L.row(i);
+            for (int k = 0; k < i; k++) b[k] -= bi * l_row[k];
+        }
+        return;
+    }
+
+    for (int i = 0; i < n; i++) {
+        const double* l_i = L.row(i);
+        double* b_i = &B(i, 0);
+        for (int k = 0; k < i; k++) {
+            const double l = l_i[k];
+            const double* b_k = &B(k, 0);
+            for (int j = 0; j < nrhs; j++) b_i[j] -= l * b_k[j];
+        }
+        const double inv = 1.0 / l_i[i];
+        for (int j = 0; j < nrhs; j++) b_i[j] *= inv;
+    }
+
+    for (int i = n - 1; i >= 0; i--) {
+        const double* l_i = L.row(i);
+        double* b_i = &B(i, 0);
+        const double inv = 1.0 / l_i[i];
+        for (int j = 0; j < nrhs; j++) b_i[j] *= inv;
+        for (int k = 0; k < i; k++) {
+            const double l = l_i[k];
+            double* b_k = &B(k, 0);
+            for (int j = 0; j < nrhs; j++) b_k[j] -= l * b_i[j];
+        }
+    }
+}
@@ -0,0 +1,100 @@
+#ifndef PACKED_STORAGE_H
+#define PACKED_STORAGE_H
+
+#include <cstddef>
+#include <vector>
+#include "../../chapter1/src/matrix_utils.h"
+
+// Symmetric and triangular matrices in n(n+1)/2 doubles instead of n^2
+// Golub & Van Loan Section 1.2.7 (symmetric storage) and Section 4.2;
+// RFP: Gustavson, Wasniewski, Dongarra & Langou, "Rectangular Full Packed
+// Format for Cholesky's Algorithm", ACM TOMS 37 (2010), LAPACK xPFTRF.
+//
+// Both formats hold one triangle of a symmetric matrix or of its Cholesky
+// factor. Conversions read only that triangle of a dense Matrix and write
+// it back with zeros in the other one; symmetrize() in chapter1/syrk fills
+// in the rest.
+
+// ============================================================================
+// Packed: the lower triangle by rows. Row i holds A(i, 0:i) and starts at
+// i(i+1)/2 (the memory order of LAPACK's column-major packed 'U').
+// Every row is contiguous, so dot products and axpys vectorize, but rows
+// have different lengths and nothing tiles: Cholesky on it is Level 2.
+// ============================================================================
+struct PackedMatrix {
+    int n = 0;
+    std::vector<double> data;
+
+    explicit PackedMatrix(int n_ = 0)
+        : n(n_), data(static_cast<size_t>(n_) * (n_ + 1) / 2, 0.0) {}
+
+    double* row(int i) { return data.data() + static_cast<size_t>(i) * (i + 1) / 2; }
+    const double* row(int i) const { return data.data() + static_cast<size_t>(i) * (i + 1) / 2; }
+
+    // Entry (i, j) of the lower triangle, j <= i
+    double& operator()(int i, int j) { return row(i)[j]; }
+    double operator()(int i, int j) const { return row(i)[j]; }
+};
+
+PackedMatrix pack_lower(const Matrix& A);
+Matrix unpack_lower(const PackedMatrix& P);
+
+// y = y + A*x, one pass over the rows (the chapter1/symv row kernel)
+void packed_symv(const PackedMatrix& P, const std::vector<double>& x, std::vector<double>& y);
+
+// A = L * L^T in place (dot-product form, Algorithm 4.2.2). Returns false
+// if A is not positive definite.
+bool packed_cholesky(PackedMatrix& P);
+
+// B = A^-1 * B with the factor from packed_cholesky
+void packed_cholesky_solve(const PackedMatrix& L, Matrix& B);
+
+// ============================================================================
+// Rectangular full packed (RFP), upper triangle, row-major.
+// With n1 = floor(n/2), n2 = n - n1 and A = [A11 A12; A12^T A22], the upper
+// triangle is one dense (2*n1 + 1) × n2 matrix R:
+//
+//   rows 0 .. n1-1:    A12                          (n1×n2, dense)
+//   rows n1 .. 2*n1:   square T with  T(r, c) = A22(r, c)     for r <= c
+//                                     T(r, c) = A11(c, r-1)   for r >  c
+//
+// i.e. A11's upper triangle is stored transposed (as a lower triangle),
+// one row below A22's. Entry (i, j), i <= j, lives at
+//   R(i, j - n1)       if j >= n1
+//   R(n1 + 1 + j, i)   otherwise.
+//
+// Every block is a rectangle or triangle with a fixed row stride, so the
+// Cholesky factorization runs on blocked tiles like the dense one:
+//   L11 = chol(A11)        (A11 stored lower: dot-product form + SYRK tiles)
+//   U12 = L11^-1 * A12     (TRSM tiles)
+//   A22 = A22 - U12^T*U12  (SYRK tiles, upper triangle only)
+//   U22 = chol(A22)        (A = U^T U form, upper rows: TRSM + SYRK tiles)
+// The factor overwrites R in the same layout: U = [L11^T U12; 0 U22].
+// ============================================================================
+struct RFPMatrix {
+    int n = 0, n1 = 0, n2 = 0;
+    Matrix R{0, 0};
+
+    explicit RFPMatrix(int n_ = 0)
+        : n(n_), n1(n_ / 2), n2(n_ - n_ / 2), R(2 * (n_ / 2) + 1, n_ - n_ / 2) {}
+
+    // Entry (i, j) of the upper triangle, i <= j
+    double& operator()(int i, int j) { return j >= n1 ? R(i, j - n1) : R(n1 + 1 + j, i); }
+    double operator()(int i, int j) const { return j >= n1 ? R(i, j - n1) : R(n1 + 1 + j, i); }
+};
+
+RFPMatrix pack_rfp(const Matrix& A);
+Matrix unpack_rfp(const RFPMatrix& F);
+
+// y = y + A*x, every stored entry read once
+void rfp_symv(const RFPMatrix& F, const std::vector<double>& x, std::vector<double>& y);
+
+// A = U^T * U in place, blocked with block_size tiles. With OpenMP the
+// TRSM and SYRK tiles run in parallel. Returns false if A is not positive
+// definite.
+bool rfp_cholesky(RFPMatrix& F, int block_size);
+
+// B = A^-1 * B with the factor from rfp_cholesky: U^T * Y = B, U * X = Y
+void rfp_cholesky_solve(const RFPMatrix& U, Matrix& B);
+
+#endif // PACKED_STORAGE_H
@@ -0,0 +1,373 @@
+#include "packed_storage.h"
+#include "../../chapter1/src/dot.h"
+#include <algorithm>
+#include <cmath>
+
+// ============================================================================
+// CONVERSIONS
+// ============================================================================
+RFPMatrix pack_rfp(const Matrix& A) {
+    RFPMatrix F(A.n);
+    for (int i = 0; i < F.n; i++) {
+        for (int j = i; j < F.n; j++) F(i, j) = A(i, j);
+    }
+    return F;
+}
+
+Matrix unpack_rfp(const RFPMatrix& F) {
+    Matrix A(F.n, F.n);
+    for (int i = 0; i < F.n; i++) {
+        for (int j = i; j < F.n; j++) A(i, j) = F(i, j);
+    }
+    return A;
+}
+
+// ============================================================================
+// TILE KERNELS on raw row-major blocks with leading dimensions. The three
+// products a right-looking Cholesky needs in each orientation:
+//   nn:  C += alpha * A * B      (ikj, rows of B)
+//   tn:  C += alpha * A^T * B    (kij, rows of A and B)
+//   nt:  C += alpha * A * B^T    (dot products of rows)
+// tn and nt can stop at the diagonal of a square C tile.
+// ============================================================================
+static void tile_nn(double* c, int ldc, const double* a, int lda, const double* b, int ldb,
+                    int mi, int nj, int kk, double alpha) {
+    for (int i = 0; i < mi; i++) {
+        double* c_i = c + static_cast<size_t>(i) * ldc;
+        for (int k = 0; k < kk; k++) {
+            const double a_ik = alpha * a[static_cast<size_t>(i) * lda + k];
+            const double* b_k = b + static_cast<size_t>(k) * ldb;
+            for (int j = 0; j < nj; j++) c_i[j] += a_ik * b_k[j];
+        }
+    }
+}
+
+static void tile_tn(double* c, int ldc, const double* a, int lda, const double* b, int ldb,
+                    int mi, int nj, int kk, double alpha, bool upper_only) {
+    for (int k = 0; k < kk; k++) {
+        const double* a_k = a + static_cast<size_t>(k) * lda;
+        const double* b_k = b + static_cast<size_t>(k) * ldb;
+        for (int i = 0; i < mi; i++) {
+            double* c_i = c + static_cast<size_t>(i) * ldc;
+            const double a_ki = alpha * a_k[i];
+            for (int j = upper_only ? i : 0; j < nj; j++) c_i[j] += a_ki * b_k[j];
+        }
+    }
+}
+
+static void tile_nt(double* c, int ldc, const double* a, int lda, const double* b, int ldb,
+                    int mi, int nj, int kk, double alpha, bool lower_only) {
+    for (int i = 0; i < mi; i++) {
+        double* c_i = c + static_cast<size_t>(i) * ldc;
+        const double* a_i = a + static_cast<size_t>(i) * lda;
+        const int j_end = lower_only ? i + 1 : nj;
+        for (int j = 0; j < j_end; j++) {
+            c_i[j] += alpha * dot(a_i, b + static_cast<size_t>(j) * ldb, kk);
+        }
+    }
+}
+
+// ============================================================================
+// BLOCKED BUILDING BLOCKS on the RFP sub-blocks
+// ============================================================================
+
+// Upper triangle of the m×m block C -= A^T * A, A is k×m. Block rows of C
+// are independent.
+static void syrk_upper(double* c, int ldc, const double* a, int lda, int m, int k, int bs) {
+    const int blocks = (m + bs - 1) / bs;
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (int bi = 0; bi < blocks; bi++) {
+        const int ii = bi * bs;
+        const int mi = std::min(bs, m - ii);
+        for (int kk = 0; kk < k; kk += bs) {
+            const int kb = std::min(bs, k - kk);
+            const double* a_k = a + static_cast<size_t>(kk) * lda;
+            for (int jj = ii; jj < m; jj += bs) {
+                tile_tn(c + static_cast<size_t>(ii) * ldc + jj, ldc, a_k + ii, lda, a_k + jj, lda,
+                        mi, std::min(bs, m - jj), kb, -1.0, jj == ii);
+            }
+        }
+    }
+}
+
+// Lower triangle of the m×m block C -= A * A^T, A is m×k
+static void syrk_lower(double* c, int ldc, const double* a, int lda, int m, int k, int bs) {
+    const int blocks = (m + bs - 1) / bs;
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (int bi = 0; bi < blocks; bi++) {
+        const int ii = bi * bs;
+        const int mi = std::min(bs, m - ii);
+        for (int jj = 0; jj <= ii; jj += bs) {
+            tile_nt(c + static_cast<size_t>(ii) * ldc + jj, ldc, a + static_cast<size_t>(ii) * lda,
+                    lda, a + static_cast<size_t>(jj) * lda, lda, mi, std::min(bs, m - jj), k, -1.0,
+                    jj == ii);
+        }
+    }
+}
+
+// X = L^-1 * X for lower triangular L (m×m) and X m×w. Column panels of X
+// are independent; within a panel, block row I first subtracts the finished
+// block rows above it (left-looking), then solves with its diagonal tile.
+static void trsm_lower_left(const double* l, int ldl, double* x, int ldx, int m, int w, int bs) {
+    const int panels = (w + bs - 1) / bs;
+    #pragma omp parallel for schedule(static)
+    for (int p = 0; p < panels; p++) {
+        const int jj = p * bs;
+        const int nj = std::min(bs, w - jj);
+        for (int ii = 0; ii < m; ii += bs) {
+            const int mi = std::min(bs, m - ii);
+            double* x_i = x + static_cast<size_t>(ii) * ldx + jj;
+            for (int kk = 0; kk < ii; kk += bs) {
+                tile_nn(x_i, ldx, l + static_cast<size_t>(ii) * ldl + kk, ldl,
+                        x + static_cast<size_t>(kk) * ldx + jj, ldx, mi, nj, std::min(bs, ii - kk),
+                        -1.0);
+            }
+            for (int i = ii; i < ii + mi; i++) {
+                const double* l_i = l + static_cast<size_t>(i) * ldl;
+                double* x_row = x + static_cast<size_t>(i) * ldx + jj;
+                for (int k = ii; k < i; k++) {
+                    const double l_ik = l_i[k];
+                    const double* x_k = x + static_cast<size_t>(k) * ldx + jj;
+                    for (int j = 0; j < nj; j++) x_row[j] -= l_ik * x_k[j];
+                }
+                const double inv = 1.0 / l_i[i];
+                for (int j = 0; j < nj; j++) x_row[j] *= inv;
+            }
+        }
+    }
+}
+
+// A = L * L^T on an n×n lower triangle with row stride ld: the dense
+// right-looking algorithm of chapter4/cholesky with the trailing update
+// done by syrk_lower
+static bool cholesky_lower(double* a, int ld, int n, int bs) {
+    auto row = [&](int i) { return a + static_cast<size_t>(i) * ld; };
+    for (int j0 = 0; j0 < n; j0 += bs) {
+        const int jt = std::min(j0 + bs, n);
+        for (int i = j0; i < jt; i++) {
+            double* a_i = row(i) + j0;
+            for (int j = j0; j < i; j++) {
+                a_i[j - j0] = (a_i[j - j0] - dot(a_i, row(j) + j0, j - j0)) / row(j)[j];
+            }
+            double d = a_i[i - j0] - dot(a_i, a_i, i - j0);
+            if (!(d > 0.0)) return false;
+            a_i[i - j0] = std::sqrt(d);
+        }
+        if (jt >= n) break;
+
+        // L21 = A21 * L11^-T, one forward substitution per row
+        #pragma omp parallel for schedule(static)
+        for (int i = jt; i < n; i++) {
+            double* a_i = row(i) + j0;
+            for (int j = j0; j < jt; j++) {
+                a_i[j - j0] = (a_i[j - j0] - dot(a_i, row(j) + j0, j - j0)) / row(j)[j];
+            }
+        }
+        syrk_lower(row(jt) + jt, ld, row(jt) + j0, ld, n - jt, jt - j0, bs);
+    }
+    return true;
+}
+
+// A = U^T * U on an n×n upper triangle with row stride ld (right-looking,
+// all updates along rows of U)
+static bool cholesky_upper(double* a, int ld, int n, int bs) {
+    auto row = [&](int i) { return a + static_cast<size_t>(i) * ld; };
+    for (int j0 = 0; j0 < n; j0 += bs) {
+        const int jt = std::min(j0 + bs, n);
+
+        // Diagonal tile, outer-product form
+        for (int i = j0; i < jt; i++) {
+            double* u_i = row(i);
+            const double d = u_i[i];
+            if (!(d > 0.0)) return false;
+            u_i[i] = std::sqrt(d);
+            const double inv = 1.0 / u_i[i];
+            for (int j = i + 1; j < jt; j++) u_i[j] *= inv;
+            for (int r = i + 1; r < jt; r++) {
+                const double u_ir = u_i[r];
+                double* u_r = row(r);
+                for (int j = r; j < jt; j++) u_r[j] -= u_ir * u_i[j];
+            }
+        }
+        if (jt >= n) break;
+
+        // U12 = U11^-T * A12: row i subtracts the finished rows above it
+        const int w = n - jt;
+        for (int i = j0; i < jt; i++) {
+            double* x_i = row(i) + jt;
+            for (int k = j0; k < i; k++) {
+                const double u_ki = row(k)[i];
+                const double* x_k = row(k) + jt;
+                for (int j = 0; j < w; j++) x_i[j] -= u_ki * x_k[j];
+            }
+            const double inv = 1.0 / row(i)[i];
+            for (int j = 0; j < w; j++) x_i[j] *= inv;
+        }
+        syrk_upper(row(jt) + jt, ld, row(j0) + jt, ld, w, jt - j0, bs);
+    }
+    return true;
+}
+
+// ============================================================================
+// RFP CHOLESKY
+// ============================================================================
+bool rfp_cholesky(RFPMatrix& F, int block_size) {
+    const int n1 = F.n1, n2 = F.n2, ld = F.R.n;
+    if (F.n == 0) return true;
+    double* r = F.R.data.data();
+    double* a11 = r + static_cast<size_t>(n1 + 1) * ld;   // lower, A11(i,j) at row i
+    double* a12 = r;                                      // n1×n2
+    double* a22 = r + static_cast<size_t>(n1) * ld;       // upper
+
+    if (!cholesky_lower(a11, ld, n1, block_size)) return false;
+    trsm_lower_left(a11, ld, a12, ld, n1, n2, block_size);
+    syrk_upper(a22, ld, a12, ld, n2, n1, block_size);
+    return cholesky_upper(a22, ld, n2, block_size);
+}
+
+// ============================================================================
+// SYMV: one pass over each stored block
+//   A11 (lower rows):  dot + axpy per row, as in chapter1/symv
+//   A12 (dense rows):  y1(p) += A12(p,:) . x2,  y2 += x1(p) * A12(p,:)
+//   A22 (upper rows):  the mirror image of the A11 kernel
+// ============================================================================
+void rfp_symv(const RFPMatrix& F, const std::vector<double>& x, std::vector<double>& y) {
+    const int n1 = F.n1, n2 = F.n2;
+    const double* x1 = x.data();
+    const double* x2 = x.data() + n1;
+    double* y1 = y.data();
+    double* y2 = y.data() + n1;
+
+    for (int i = 0; i < n1; i++) {
+        const double* a_row = &F.R(n1 + 1 + i, 0);
+        const double x_i = x1[i];
+        const double y_i = dot(a_row, x1, i);
+        for (int j = 0; j < i; j++) y1[j] += a_row[j] * x_i;
+        y1[i] += y_i + a_row[i] * x_i;
+    }
+    for (int p = 0; p < n1; p++) {
+        const double* a_row = &F.R(p, 0);
+        const double x_p = x1[p];
+        y1[p] += dot(a_row, x2, n2);
+        for (int j = 0; j < n2; j++) y2[j] += a_row[j] * x_p;
+    }
+    for (int i = 0; i < n2; i++) {
+        const double* a_row = &F.R(n1 + i, 0);
+        const double x_i = x2[i];
+        const int len = n2 - i - 1;
+        const double y_i = dot(a_row + i + 1, x2 + i + 1, len);
+        for (int j = i + 1; j < n2; j++) y2[j] += a_row[j] * x_i;
+        y2[i] += y_i + a_row[i] * x_i;
+    }
+}
+
+// ============================================================================
+// SOLVE with U = [L11^T U12; 0 U22], every sweep along stored rows:
+//   U^T * Y = B:  Y1 = L11^-1 B1,  B2 -= U12^T Y1,  Y2 = U22^-T B2
+//   U * X = Y:    X2 = U22^-1 Y2,  B1 -= U12 X2,    X1 = L11^-T B1
+// ============================================================================
+void rfp_cholesky_solve(const RFPMatrix& U, Matrix& B) {
+    const int n1 = U.n1, n2 = U.n2;
+    const int nrhs = B.n;
+    auto l11 = [&](int i) { return &U.R(n1 + 1 + i, 0); };
+    auto u12 = [&](int p) { return &U.R(p, 0); };
+    auto u22 = [&](int i) { return &U.R(n1 + i, 0); };
+    auto b = [&](int i) { return &B(i, 0); };
+
+    // One right-hand side: each sweep is a dot product or an axpy per row
+    if (nrhs == 1) {
+        double* b1 = B.data.data();
+        double* b2 = b1 + n1;
+        for (int i = 0; i < n1; i++) b1[i] = (b1[i] - dot(l11(i), b1, i)) / l11(i)[i];
+        for (int p = 0; p < n1; p++) {
+            const double* u_p = u12(p);
+            const double bp = b1[p];
+            for (int c = 0; c < n2; c++) b2[c] -= bp * u_p[c];
+        }
+        for (int i = 0; i < n2; i++) {
+            const double* u_i = u22(i);
+            const double bi = b2[i] /= u_i[i];
+            for (int k = i + 1; k < n2; k++) b2[k] -= bi * u_i[k];
+        }
+        for (int i = n2 - 1; i >= 0; i--) {
+            const double* u_i = u22(i);
+            b2[i] = (b2[i] - dot(u_i + i + 1, b2 + i + 1, n2 - i - 1)) / u_i[i];
+        }
+        for (int p = 0; p < n1; p++) b1[p] -= dot(u12(p), b2, n2);
+        for (int i = n1 - 1; i >= 0; i--) {
+            const double* l_i = l11(i);
+            const double bi = b1[i] /= l_i[i];
+            for (int k = 0; k < i; k++) b1[k] -= bi * l_i[k];
+        }
+        return;
+    }
+
+    // Y1 = L11^-1 B1
+    for (int i = 0; i < n1; i++) {
+        const double* l_i = l11(i);
+        double* b_i = b(i);
+        for (int k = 0; k < i; k++) {
+            const double l = l_i[k];
+            const double* b_k = b(k);
+            for (int j = 0; j < nrhs; j++) b_i[j] -= l * b_k[j];
+        }
+        const double inv = 1.0 / l_i[i];
+        for (int j = 0; j < nrhs; j++) b_i[j] *= inv;
+    }
+    // B2 -= U12^T Y1
+    for (int p = 0; p < n1; p++) {
+        const double* u_p = u12(p);
+        const double* b_p = b(p);
+        for (int c = 0; c < n2; c++) {
+            const double u = u_p[c];
+            double* b_c = b(n1 + c);
+            for (int j = 0; j < nrhs; j++) b_c[j] -= u * b_p[j];
+        }
+    }
+    // Y2 = U22^-T B2: finished row i is pushed into the rows below
+    for (int i = 0; i < n2; i++) {
+        const double* u_i = u22(i);
+        double* b_i = b(n1 + i);
+        const double inv = 1.0 / u_i[i];
+        for (int j = 0; j < nrhs; j++) b_i[j] *= inv;
+        for (int k = i + 1; k < n2; k++) {
+            const double u = u_i[k];
+            double* b_k = b(n1 + k);
+            for (int j = 0; j < nrhs; j++) b_k[j] -= u * b_i[j];
+        }
+    }
+    // X2 = U22^-1 Y2
+    for (int i = n2 - 1; i >= 0; i--) {
+        const double* u_i = u22(i);
+        double* b_i = b(n1 + i);
+        for (int k = i + 1; k < n2; k++) {
+            const double u = u_i[k];
+            const double* b_k = b(n1 + k);
+            for (int j = 0; j < nrhs; j++) b_i[j] -= u * b_k[j];
+        }
+        const double inv = 1.0 / u_i[i];
+        for (int j = 0; j < nrhs; j++) b_i[j] *= inv;
+    }
+    // B1 -= U12 X2
+    for (int p = 0; p < n1; p++) {
+        const double* u_p = u12(p);
+        double* b_p = b(p);
+        for (int c = 0; c < n2; c++) {
+            const double u = u_p[c];
+            const double* b_c = b(n1 + c);
+            for (int j = 0; j < nrhs; j++) b_p[j] -= u * b_c[j];
+        }
+    }
+    // X1 = L11^-T B1: finished row i is pushed into the rows above
+    for (int i = n1 - 1; i >= 0; i--) {
+        const double* l_i = l11(i);
+        double* b_i = b(i);
+        const double inv = 1.0 / l_i[i];
+        for (int j = 0; j < nrhs; j++) b_i[j] *= inv;
+        for (int k = 0; k < i; k++) {
+            const double l = l_i[k];
+            double* b_k = b(k);
+            for (int j = 0; j < nrhs; j++) b_k[j] -= l * b_i[j];
+        }
+    }
+}
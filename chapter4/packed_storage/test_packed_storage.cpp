@@ -0,0 +1,164 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "packed_storage.h"
+#include "../cholesky/cholesky.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+#include "../../chapter1/row_v_col/gaxpy.h"
+
+// Sizes covering n even and odd, n1 = 0, and several tiles per block
+static const int kSizes[] = {1, 2, 3, 4, 7, 8, 65, 100, 203};
+
+bool test_layouts() {
+    std::cout << "Testing packed and RFP layouts and conversions... ";
+
+    for (int n : kSizes) {
+        Matrix A(n, n);
+        A.fill_random();
+
+        // Every entry of the triangle has its own slot
+        RFPMatrix F(n);
+        PackedMatrix P(n);
+        if (F.R.data.size() != static_cast<size_t>(n) * (n + 1) / 2 ||
+            P.data.size() != F.R.data.size()) {
+            std::cout << "FAILED (n=" << n << ", storage is not n(n+1)/2)\n";
+            return false;
+        }
+        for (int i = 0; i < n; i++) {
+            for (int j = i; j < n; j++) F(i, j) = i * n + j + 1.0;
+        }
+        for (double v : F.R.data) {
+            if (v == 0.0) {
+                std::cout << "FAILED (n=" << n << ", RFP slot not covered)\n";
+                return false;
+            }
+        }
+
+        // Round trips keep the triangle and zero the rest
+        Matrix Lo(n, n), Up(n, n);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) (j <= i ? Lo : Up)(i, j) = A(i, j);
+            Up(i, i) = A(i, i);
+        }
+        if (max_abs_diff(unpack_lower(pack_lower(A)), Lo) != 0.0 ||
+            max_abs_diff(unpack_rfp(pack_rfp(A)), Up) != 0.0) {
+            std::cout << "FAILED (n=" << n << ", round trip)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_symv() {
+    std::cout << "Testing packed_symv and rfp_symv against gaxpy... ";
+
+    for (int n : kSizes) {
+        Matrix A = random_spd(n);
+        PackedMatrix P = pack_lower(A);
+        RFPMatrix F = pack_rfp(A);
+        std::vector<double> x(n), y0(n);
+        for (int i = 0; i < n; i++) {
+            x[i] = std::sin(0.3 * i + 1.0);
+            y0[i] = std::cos(0.7 * i);
+        }
+        std::vector<double> y_ref = y0, y_p = y0, y_f = y0;
+        gaxpy_row_oriented(A, x, y_ref);
+        packed_symv(P, x, y_p);
+        rfp_symv(F, x, y_f);
+        for (int i = 0; i < n; i++) {
+            double tol = 1e-12 * n * (1.0 + std::abs(y_ref[i]));
+            if (!(std::abs(y_p[i] - y_ref[i]) <= tol) || !(std::abs(y_f[i] - y_ref[i]) <= tol)) {
+                std::cout << "FAILED (n=" << n << ", row " << i << ")\n";
+                return false;
+            }
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_cholesky_and_solve() {
+    std::cout << "Testing packed and RFP Cholesky and solves... ";
+
+    for (int n : kSizes) {
+        Matrix A = random_spd(n);
+        Matrix L = A;
+        cholesky_unblocked(L);
+        for (int i = 0; i < n; i++) {
+            for (int j = i + 1; j < n; j++) L(i, j) = 0.0;
+        }
+        const double tol = 1e-11 * n;
+
+        PackedMatrix P = pack_lower(A);
+        if (!packed_cholesky(P) || max_abs_diff(unpack_lower(P), L) > tol) {
+            std::cout << "FAILED (n=" << n << ", packed factor)\n";
+            return false;
+        }
+
+        // The RFP factor is U = L^T, for any tile size
+        for (int block_size : {4, 16, 64}) {
+            RFPMatrix F = pack_rfp(A);
+            if (!rfp_cholesky(F, block_size) || max_abs_diff(unpack_rfp(F), L.transpose()) > tol) {
+                std::cout << "FAILED (n=" << n << ", RFP factor, block=" << block_size << ")\n";
+                return false;
+            }
+
+            if (block_size != 16) continue;
+            for (int nrhs : {1, 3}) {
+                Matrix B(n, nrhs);
+                B.fill_random();
+                Matrix X_p = B, X_f = B;
+                packed_cholesky_solve(P, X_p);
+                rfp_cholesky_solve(F, X_f);
+                Matrix AX_p(n, nrhs), AX_f(n, nrhs);
+                gemm_ikj(A, X_p, AX_p);
+                gemm_ikj(A, X_f, AX_f);
+                if (max_abs_diff(AX_p, B) > tol || max_abs_diff(AX_f, B) > tol) {
+                    std::cout << "FAILED (n=" << n << ", solve, nrhs=" << nrhs << ")\n";
+                    return false;
+                }
+            }
+        }
+    }
+
+    // Indefinite input is reported by both, whichever block holds the
+    // failing pivot (A11 or A22 of the RFP split)
+    for (int bad : {1, 8}) {
+        Matrix A = random_spd(10);
+        A(bad, bad) = -1.0;
+        PackedMatrix P = pack_lower(A);
+        RFPMatrix F = pack_rfp(A);
+        if (packed_cholesky(P) || rfp_cholesky(F, 4)) {
+            std::cout << "FAILED (indefinite matrix not detected)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Packed and RFP Storage\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_layouts();
+    all_passed &= test_symv();
+    all_passed &= test_cholesky_and_solve();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
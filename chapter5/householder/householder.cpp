@@ -0,0 +1,195 @@
+#include "householder.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+#include <cmath>
+
+// Block size handed to gemm_blocked for the reflector products
+static const int kGemmBlock = 64;
+
+// ============================================================================
+// Reflector generation (Algorithm 5.1.1)
+//
+// beta = -sign(alpha) * ||x|| avoids cancellation in alpha - beta,
+// and scaling by 1/(alpha - beta) normalises v so that v(0) = 1.
+// ============================================================================
+double householder_column(Matrix& A, int row, int col) {
+    if (row >= A.m) return 0.0;
+
+    double alpha = A(row, col);
+    double sigma = 0.0;
+    for (int i = row + 1; i < A.m; i++) {
+        sigma += A(i, col) * A(i, col);
+    }
+    if (sigma == 0.0) return 0.0;
+
+    double norm = std::sqrt(alpha * alpha + sigma);
+    double beta = (alpha >= 0.0) ? -norm : norm;
+    double tau = (beta - alpha) / beta;
+    double scale = 1.0 / (alpha - beta);
+
+    for (int i = row + 1; i < A.m; i++) {
+        A(i, col) *= scale;
+    }
+    A(row, col) = beta;
+    return tau;
+}
+
+// ============================================================================
+// Compact WY factor (Section 5.1.7)
+//
+// Appending reflector c to Q_c = I - V_c*T_c*V_c^T gives
+//   T_{c+1} = [ T_c   -tau_c * T_c * V_c^T * v_c ]
+//             [ 0      tau_c                     ]
+// ============================================================================
+Matrix householder_block_t(const Matrix& V, const std::vector<double>& tau) {
+    const int m = V.m;
+    const int k = V.n;
+    Matrix T(k, k);
+    std::vector<double> z(k);
+
+    for (int c = 0; c < k; c++) {
+        // z = V(:, 0:c)^T * v_c, row by row through V
+        std::fill(z.begin(), z.begin() + c, 0.0);
+        for (int i = 0; i < m; i++) {
+            double v_ic = V(i, c);
+            if (v_ic == 0.0) continue;
+            for (int p = 0; p < c; p++) z[p] += V(i, p) * v_ic;
+        }
+        for (int p = 0; p < c; p++) {
+            double s = 0.0;
+            for (int q = p; q < c; q++) s += T(p, q) * z[q];
+            T(p, c) = -tau[c] * s;
+        }
+        T(c, c) = tau[c];
+    }
+    return T;
+}
+
+// ============================================================================
+// Block reflector application (compact WY, Section 5.1.7)
+//
+// W = V^T * C        (GEMM, k×n)
+// W = op(T) * W      (small triangular product, in place)
+// C = C - V * W      (GEMM)
+// ============================================================================
+void apply_block_reflector_left(const Matrix& V, const Matrix& T, Matrix& C,
+                                bool transpose) {
+    const int k = V.n;
+    const int n = C.n;
+    if (k == 0 || n == 0) return;
+
+    Matrix Vt = V.transpose();
+    Matrix W(k, n);
+    gemm_blocked(Vt, C, W, kGemmBlock);
+
+    // Row-oriented triangular product keeps the inner loop over W's rows
+    std::vector<double> row(n);
+    if (transpose) {
+        // W = T^T * W: row p uses rows q <= p, so sweep bottom-up
+        for (int p = k - 1; p >= 0; p--) {
+            std::fill(row.begin(), row.end(), 0.0);
+            for (int q = 0; q <= p; q++) {
+                double t_qp = T(q, p);
+                for (int j = 0; j < n; j++) row[j] += t_qp * W(q, j);
+            }
+            std::copy(row.begin(), row.end(), &W(p, 0));
+        }
+    } else {
+        // W = T * W: row p uses rows q >= p, so sweep top-down
+        for (int p = 0; p < k; p++) {
+            std::fill(row.begin(), row.end(), 0.0);
+            for (int q = p; q < k; q++) {
+                double t_pq = T(p, q);
+                for (int j = 0; j < n; j++) row[j] += t_pq * W(q, j);
+            }
+            std::copy(row.begin(), row.end(), &W(p, 0));
+        }
+    }
+
+    for (auto& w : W.data) w = -w;
+    gemm_blocked(V, W, C, kGemmBlock);
+}
+
+// ============================================================================
+// Unit lower trapezoidal V for reflectors j0 .. j0+nb-1 of a QR factor,
+// with rows starting at j0
+// ============================================================================
+static Matrix qr_reflector_block(const Matrix& QR, int j0, int nb) {
+    const int rows = QR.m - j0;
+    Matrix V(rows, nb);
+    for (int c = 0; c < nb; c++) {
+        V(c, c) = 1.0;
+        for (int i = c + 1; i < rows; i++) V(i, c) = QR(j0 + i, j0 + c);
+    }
+    return V;
+}
+
+// ============================================================================
+// BLOCKED QR
+//
+// for each panel of block_size columns:
+//     for j in panel: generate P_j, apply it to the rest of the panel
+//     A(j0:m, trailing) = (I - V*T*V^T)^T * A(j0:m, trailing)
+// ============================================================================
+void householder_qr(Matrix& A, std::vector<double>& tau, int block_size) {
+    const int m = A.m;
+    const int n = A.n;
+    const int kmax = std::min(m, n);
+    tau.assign(kmax, 0.0);
+    std::vector<double> w(n);
+
+    for (int j0 = 0; j0 < kmax; j0 += block_size) {
+        const int nb = std::min(block_size, kmax - j0);
+        const int panel_end = j0 + nb;
+
+        for (int j = j0; j < panel_end; j++) {
+            double t = householder_column(A, j, j);
+            tau[j] = t;
+            if (t == 0.0) continue;
+
+            // A(j:m, j+1:panel_end) -= t * v * (v^T * A(j:m, j+1:panel_end))
+            std::fill(w.begin() + j + 1, w.begin() + panel_end, 0.0);
+            for (int i = j; i < m; i++) {
+                double v_i = (i == j) ? 1.0 : A(i, j);
+                for (int c = j + 1; c < panel_end; c++) w[c] += v_i * A(i, c);
+            }
+            for (int i = j; i < m; i++) {
+                double tv = t * ((i == j) ? 1.0 : A(i, j));
+                for (int c = j + 1; c < panel_end; c++) A(i, c) -= tv * w[c];
+            }
+        }
+
+        if (panel_end >= n) continue;
+
+        Matrix V = qr_reflector_block(A, j0, nb);
+        std::vector<double> tau_b(tau.begin() + j0, tau.begin() + panel_end);
+        Matrix T = householder_block_t(V, tau_b);
+
+        Matrix C = A.block(j0, panel_end, m - j0, n - panel_end);
+        apply_block_reflector_left(V, T, C, true);
+        A.set_block(j0, panel_end, C);
+    }
+}
+
+// ============================================================================
+// Q = B_0 * B_1 * ..., so Q*C applies the last block first and
+// Q^T*C applies the first block first.
+// ============================================================================
+void householder_qr_apply_q(const Matrix& QR, const std::vector<double>& tau,
+                            Matrix& C, bool transpose, int block_size) {
+    const int kmax = static_cast<int>(tau.size());
+    const int num_blocks = (kmax + block_size - 1) / block_size;
+
+    for (int step = 0; step < num_blocks; step++) {
+        const int b = transpose ? step : num_blocks - 1 - step;
+        const int j0 = b * block_size;
+        const int nb = std::min(block_size, kmax - j0);
+
+        Matrix V = qr_reflector_block(QR, j0, nb);
+        std::vector<double> tau_b(tau.begin() + j0, tau.begin() + j0 + nb);
+        Matrix T = householder_block_t(V, tau_b);
+
+        Matrix C_low = C.block(j0, 0, C.m - j0, C.n);
+        apply_block_reflector_left(V, T, C_low, transpose);
+        C.set_block(j0, 0, C_low);
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef HOUSEHOLDER_H
+#define HOUSEHOLDER_H
+
+#include "../../chapter1/src/matrix_utils.h"
+
+// Householder reflectors, Golub & Van Loan Section 5.1
+//
+// A reflector is stored as P = I - tau * v * v^T with v(0) = 1 implicit.
+
+// ============================================================================
+// Generate a reflector from the column segment x = A(row:m, col)
+// (Algorithm 5.1.1, LAPACK xLARFG sign convention)
+//
+// On return A(row, col) = beta and A(row+1:m, col) holds v(1:), so that
+//   P * x = beta * e1
+// Returns tau (0 when x(1:) is already zero and no reflection is needed).
+// ============================================================================
+double householder_column(Matrix& A, int row, int col);
+
+// ============================================================================
+// Build the k×k upper triangular T of the compact WY form (LAPACK xLARFT)
+//   P_0 * P_1 * ... * P_{k-1} = I - V*T*V^T
+// V is m×k with the Householder vectors in its columns, tau has k entries.
+// ============================================================================
+Matrix householder_block_t(const Matrix& V, const std::vector<double>& tau);
+
+// ============================================================================
+// Apply a block reflector Q = I - V*T*V^T from the left (Section 5.1.7)
+//   transpose = true:  C = Q^T * C = C - V * T^T * (V^T * C)
+//   transpose = false: C = Q   * C = C - V * T   * (V^T * C)
+//
+// V is m×k (unit lower trapezoidal), T is k×k upper triangular,
+// C is m×n. Both large products go through gemm_blocked.
+// ============================================================================
+void apply_block_reflector_left(const Matrix& V, const Matrix& T, Matrix& C,
+                                bool transpose);
+
+// ============================================================================
+// Blocked Householder QR (Algorithms 5.2.1 and 5.2.2)
+//
+// On return the upper triangle of A holds R and the Householder vectors
+// are stored below the diagonal; tau has min(m, n) entries.
+// Each panel of block_size columns is factored with Level 2 updates and
+// then applied to the trailing columns as one block reflector (GEMM).
+// ============================================================================
+void householder_qr(Matrix& A, std::vector<double>& tau, int block_size);
+
+// C = Q * C (transpose = false) or C = Q^T * C (transpose = true), where Q
+// is held in factored form by householder_qr. C must have A.m rows.
+void householder_qr_apply_q(const Matrix& QR, const std::vector<double>& tau,
+                            Matrix& C, bool transpose, int block_size);
+
+#endif // HOUSEHOLDER_H
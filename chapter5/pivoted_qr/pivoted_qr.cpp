@@ -0,0 +1,385 @@
+#include "pivoted_qr.h"
+#include "../householder/householder.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+
+// Block size handed to gemm_blocked
+static const int kGemmBlock = 64;
+
+// Swap columns c1 and c2 over all rows
+static void swap_columns(Matrix& A, int c1, int c2) {
+    if (c1 == c2) return;
+    for (int i = 0; i < A.m; i++) std::swap(A(i, c1), A(i, c2));
+}
+
+// ||A(r0:m, c)||_2
+static double column_norm(const Matrix& A, int r0, int c) {
+    double s = 0.0;
+    for (int i = r0; i < A.m; i++) s += A(i, c) * A(i, c);
+    return std::sqrt(s);
+}
+
+// Norms of all columns, accumulated row by row
+static std::vector<double> column_norms(const Matrix& A) {
+    std::vector<double> s(A.n, 0.0);
+    for (int i = 0; i < A.m; i++) {
+        const double* a_row = &A(i, 0);
+        for (int j = 0; j < A.n; j++) s[j] += a_row[j] * a_row[j];
+    }
+    for (double& x : s) x = std::sqrt(x);
+    return s;
+}
+
+// Index of the largest vn[j] for j >= j0
+static int pivot_column(const std::vector<double>& vn, int j0) {
+    return static_cast<int>(std::max_element(vn.begin() + j0, vn.end()) - vn.begin());
+}
+
+// ============================================================================
+// Norm downdate (xLAQP2 / xLAQPS)
+//
+// After step k, ||A(k+1:m, j)|| = vn1 * sqrt(1 - (A(k,j)/vn1)^2). When that
+// factor, measured against the norm vn2 at the last recomputation, drops
+// below sqrt(eps), too few digits are left and the caller must recompute.
+// Returns false in that case (vn1 left untouched).
+// ============================================================================
+static bool downdate_norm(double a_kj, double& vn1, double vn2) {
+    static const double tol3z = std::sqrt(std::numeric_limits<double>::epsilon());
+    if (vn1 == 0.0) return true;
+    double temp = std::abs(a_kj) / vn1;
+    temp = std::max(0.0, (1.0 + temp) * (1.0 - temp));
+    double ratio = vn1 / vn2;
+    if (temp * ratio * ratio <= tol3z) return false;
+    vn1 *= std::sqrt(temp);
+    return true;
+}
+
+// ============================================================================
+// LEVEL 2 STEPS j0 .. kmax-1 (xLAQP2)
+//
+// for each step k:
+//     pivot the column of largest vn1 into position k
+//     generate P_k and apply it to A(k:m, k+1:n)       (rank-1 update)
+//     downdate the norms of columns k+1..n-1
+// ============================================================================
+static void qp2_steps(Matrix& A, int j0, int kmax, std::vector<int>& jpvt,
+                      std::vector<double>& tau, std::vector<double>& vn1,
+                      std::vector<double>& vn2) {
+    const int m = A.m;
+    const int n = A.n;
+    std::vector<double> w(n), v(m);
+
+    for (int k = j0; k < kmax; k++) {
+        int p = pivot_column(vn1, k);
+        if (p != k) {
+            swap_columns(A, k, p);
+            std::swap(jpvt[k], jpvt[p]);
+            vn1[p] = vn1[k];
+            vn2[p] = vn2[k];
+        }
+
+        double t = householder_column(A, k, k);
+        tau[k] = t;
+        if (t != 0.0) {
+            // A(k:m, k+1:n) -= t * v * (v^T * A(k:m, k+1:n)), with v copied
+            // out of its strided column once
+            v[k] = 1.0;
+            for (int i = k + 1; i < m; i++) v[i] = A(i, k);
+            std::fill(w.begin() + k + 1, w.end(), 0.0);
+            for (int i = k; i < m; i++) {
+                const double* a_row = &A(i, 0);
+                for (int j = k + 1; j < n; j++) w[j] += v[i] * a_row[j];
+            }
+            for (int i = k; i < m; i++) {
+                double tv = t * v[i];
+                double* a_row = &A(i, 0);
+                for (int j = k + 1; j < n; j++) a_row[j] -= tv * w[j];
+            }
+        }
+
+        for (int j = k + 1; j < n; j++) {
+            if (!downdate_norm(A(k, j), vn1[j], vn2[j])) {
+                vn1[j] = column_norm(A, k + 1, j);
+                vn2[j] = vn1[j];
+            }
+        }
+    }
+}
+
+void qr_pivoted_unblocked(Matrix& A, std::vector<int>& jpvt, std::vector<double>& tau) {
+    const int kmax = std::min(A.m, A.n);
+    jpvt.resize(A.n);
+    std::iota(jpvt.begin(), jpvt.end(), 0);
+    tau.assign(kmax, 0.0);
+    std::vector<double> vn1 = column_norms(A);
+    std::vector<double> vn2 = vn1;
+    qp2_steps(A, 0, kmax, jpvt, tau, vn1, vn2);
+}
+
+// ============================================================================
+// ONE PANEL OF QP3 (xLAQPS), starting at row/column j0, at most nb steps
+//
+// F is (n-j0)×nb; row r of F belongs to column j0+r. After step k,
+//   A(j0+k+1:m, j0+k+1:n) (true) = A (stored) - V(:, 0:k+1) * F(k+1:, 0:k+1)^T
+// for k = 0, 1, ...:
+//     pivot on vn1, swapping whole columns of A and rows of F
+//     A(rk:m, col) -= V(rk:m, 0:k) * F(k, 0:k)^T       bring the column up to date
+//     generate P_k
+//     F(:, k) = tau * A(rk:m, :)^T v - tau * F(:, 0:k) * (V(rk:m, 0:k)^T v)
+//     A(rk, col+1:n) -= V(rk, 0:k+1) * F(k+1:, 0:k+1)^T   bring row rk of R up to date
+//     downdate norms; stop after this step if any must be recomputed
+// then A(rk:m, rk:n) -= V(rk:m, :) * F(kb:, :)^T with one GEMM.
+// Returns the number of steps kb taken.
+// ============================================================================
+static int qp3_panel(Matrix& A, int j0, int nb, std::vector<int>& jpvt,
+                     std::vector<double>& tau, std::vector<double>& vn1,
+                     std::vector<double>& vn2) {
+    const int m = A.m;
+    const int n = A.n;
+    const int last_rk = std::min(m, n) - 1;
+    Matrix F(n - j0, nb);
+    std::vector<double> f(n), aux(nb), v(m);
+    std::vector<int> recompute;
+
+    int k = 0;
+    while (k < nb && recompute.empty()) {
+        const int rk = j0 + k;   // row and column of this step
+
+        int p = pivot_column(vn1, rk);
+        if (p != rk) {
+            swap_columns(A, rk, p);
+            for (int c = 0; c < k; c++) std::swap(F(p - j0, c), F(k, c));
+            std::swap(jpvt[rk], jpvt[p]);
+            vn1[p] = vn1[rk];
+            vn2[p] = vn2[rk];
+        }
+
+        // A(rk:m, rk) -= A(rk:m, j0:rk) * F(k, 0:k)^T
+        if (k > 0) {
+            const double* f_row = &F(k, 0);
+            for (int i = rk; i < m; i++) {
+                const double* v_row = &A(i, j0);
+                double s = 0.0;
+                for (int c = 0; c < k; c++) s += v_row[c] * f_row[c];
+                A(i, rk) -= s;
+            }
+        }
+
+        const double t = householder_column(A, rk, rk);
+        tau[rk] = t;
+        const double akk = A(rk, rk);
+        A(rk, rk) = 1.0;
+        for (int i = rk; i < m; i++) v[i] = A(i, rk);
+
+        // f = A(rk:m, rk+1:n)^T v, row by row through A
+        std::fill(f.begin() + rk + 1, f.end(), 0.0);
+        for (int i = rk; i < m; i++) {
+            const double* a_row = &A(i, 0);
+            for (int j = rk + 1; j < n; j++) f[j] += v[i] * a_row[j];
+        }
+        for (int j = j0; j <= rk; j++) F(j - j0, k) = 0.0;
+        for (int j = rk + 1; j < n; j++) F(j - j0, k) = t * f[j];
+
+        // F(:, k) -= tau * F(:, 0:k) * (A(rk:m, j0:rk)^T v)
+        if (k > 0) {
+            std::fill(aux.begin(), aux.begin() + k, 0.0);
+            for (int i = rk; i < m; i++) {
+                const double* v_row = &A(i, j0);
+                for (int c = 0; c < k; c++) aux[c] += v_row[c] * v[i];
+            }
+            for (int r = 0; r < n - j0; r++) {
+                double* f_row = &F(r, 0);
+                double s = 0.0;
+                for (int c = 0; c < k; c++) s += f_row[c] * aux[c];
+                f_row[k] -= t * s;
+            }
+        }
+
+        // A(rk, rk+1:n) -= A(rk, j0:rk+1) * F(k+1:, 0:k+1)^T
+        {
+            const double* v_row = &A(rk, j0);
+            for (int j = rk + 1; j < n; j++) {
+                const double* f_row = &F(j - j0, 0);
+                double s = 0.0;
+                for (int c = 0; c <= k; c++) s += v_row[c] * f_row[c];
+                A(rk, j) -= s;
+            }
+        }
+
+        if (rk < last_rk) {
+            for (int j = rk + 1; j < n; j++) {
+                if (!downdate_norm(A(rk, j), vn1[j], vn2[j])) recompute.push_back(j);
+            }
+        }
+        A(rk, rk) = akk;
+        k++;
+    }
+
+    // A(rk:m, rk:n) -= A(rk:m, j0:rk) * F(kb:, 0:kb)^T
+    const int kb = k;
+    const int rk = j0 + kb;
+    if (rk < m && rk < n) {
+        Matrix V_neg = A.block(rk, j0, m - rk, kb);
+        for (auto& x : V_neg.data) x = -x;
+        Matrix Ft = F.block(kb, 0, n - rk, kb).transpose();
+        Matrix C = A.block(rk, rk, m - rk, n - rk);
+        gemm_blocked(V_neg, Ft, C, kGemmBlock);
+        A.set_block(rk, rk, C);
+    }
+
+    for (int j : recompute) {
+        vn1[j] = column_norm(A, rk, j);
+        vn2[j] = vn1[j];
+    }
+    return kb;
+}
+
+void qr_pivoted(Matrix& A, std::vector<int>& jpvt, std::vector<double>& tau, int block_size) {
+    const int kmax = std::min(A.m, A.n);
+    jpvt.resize(A.n);
+    std::iota(jpvt.begin(), jpvt.end(), 0);
+    tau.assign(kmax, 0.0);
+    std::vector<double> vn1 = column_norms(A);
+    std::vector<double> vn2 = vn1;
+
+    for (int j = 0; j < kmax;) {
+        j += qp3_panel(A, j, std::min(block_size, kmax - j), jpvt, tau, vn1, vn2);
+    }
+}
+
+// ============================================================================
+// RANDOMIZED BLOCK PIVOTING (HQRRP)
+//
+// Y = G * A (G Gaussian, (b + oversample)×m)
+// for each block of b columns:
+//     Level 2 pivoted QR on Y(:, j0:n), stopped after b steps, picks the block
+//     permute those columns of A, Y and jpvt to the front
+//     householder_qr on the panel, block reflector on the trailing columns
+//     Y(:, j0+b:n) -= Y(:, j0:j0+b) * R11^-1 * R12
+// ============================================================================
+void qr_pivoted_randomized(Matrix& A, std::vector<int>& jpvt, std::vector<double>& tau,
+                           int block_size, int oversample, unsigned seed) {
+    const int m = A.m;
+    const int n = A.n;
+    const int kmax = std::min(m, n);
+    const int p = block_size + oversample;
+    jpvt.resize(n);
+    std::iota(jpvt.begin(), jpvt.end(), 0);
+    tau.assign(kmax, 0.0);
+
+    Matrix G(p, m);
+    std::mt19937 gen(seed);
+    std::normal_distribution<> normal(0.0, 1.0);
+    for (auto& g : G.data) g = normal(gen);
+    Matrix Y(p, n);
+    gemm_blocked(G, A, Y, kGemmBlock);
+
+    for (int j0 = 0; j0 < kmax; j0 += block_size) {
+        const int b = std::min(block_size, kmax - j0);
+        const int rest = n - j0 - b;
+
+        // Choose the block on the sketch
+        Matrix Ys = Y.block(0, j0, p, n - j0);
+        std::vector<int> sel(n - j0);
+        std::iota(sel.begin(), sel.end(), 0);
+        std::vector<double> tau_s(std::min(p, n - j0));
+        std::vector<double> vn1 = column_norms(Ys);
+        std::vector<double> vn2 = vn1;
+        qp2_steps(Ys, 0, std::min(b, static_cast<int>(tau_s.size())), sel, tau_s, vn1, vn2);
+
+        // Apply the permutation to the columns j0:n of A and Y, and to jpvt
+        std::vector<double> row(n - j0);
+        for (Matrix* M : {&A, &Y}) {
+            for (int i = 0; i < M->m; i++) {
+                double* m_row = &(*M)(i, j0);
+                for (int c = 0; c < n - j0; c++) row[c] = m_row[sel[c]];
+                std::copy(row.begin(), row.end(), m_row);
+            }
+        }
+        std::vector<int> jp(jpvt.begin() + j0, jpvt.end());
+        for (int c = 0; c < n - j0; c++) jpvt[j0 + c] = jp[sel[c]];
+
+        // Unpivoted QR of the panel, block reflector on the trailing columns
+        Matrix panel = A.block(j0, j0, m - j0, b);
+        std::vector<double> tau_b;
+        householder_qr(panel, tau_b, b);
+        A.set_block(j0, j0, panel);
+        std::copy(tau_b.begin(), tau_b.end(), tau.begin() + j0);
+        if (rest == 0) continue;
+
+        Matrix C = A.block(j0, j0 + b, m - j0, rest);
+        householder_qr_apply_q(panel, tau_b, C, true, b);
+        A.set_block(j0, j0 + b, C);
+
+        // W = R11^-1 * R12 by row-oriented back substitution
+        Matrix W = A.block(j0, j0 + b, b, rest);
+        for (int i = b - 1; i >= 0; i--) {
+            double* w_i = &W(i, 0);
+            for (int k = i + 1; k < b; k++) {
+                const double r = panel(i, k);
+                const double* w_k = &W(k, 0);
+                for (int j = 0; j < rest; j++) w_i[j] -= r * w_k[j];
+            }
+            const double r_ii = panel(i, i);
+            for (int j = 0; j < rest; j++) w_i[j] = (r_ii != 0.0) ? w_i[j] / r_ii : 0.0;
+        }
+
+        // Y2 -= Y1 * W
+        Matrix Y1_neg = Y.block(0, j0, p, b);
+        for (auto& y : Y1_neg.data) y = -y;
+        Matrix Y2 = Y.block(0, j0 + b, p, rest);
+        gemm_blocked(Y1_neg, W, Y2, kGemmBlock);
+        Y.set_block(0, j0 + b, Y2);
+    }
+}
+
+int qr_numerical_rank(const Matrix& QR, double rtol) {
+    const int kmax = std::min(QR.m, QR.n);
+    if (kmax == 0 || QR(0, 0) == 0.0) return 0;
+    const double threshold = rtol * std::abs(QR(0, 0));
+    int r = 0;
+    while (r < kmax && std::abs(QR(r, r)) > threshold) r++;
+    return r;
+}
+
+int least_squares_pivoted(const Matrix& A, const Matrix& B, Matrix& X, double rtol,
+                          int block_size) {
+    const int n = A.n;
+    const int nrhs = B.n;
+    Matrix QR = A;
+    std::vector<int> jpvt;
+    std::vector<double> tau;
+    qr_pivoted(QR, jpvt, tau, block_size);
+    const int r = qr_numerical_rank(QR, rtol);
+
+    Matrix QtB = B;
+    householder_qr_apply_q(QR, tau, QtB, true, block_size);
+
+    // R11 * Z = (Q^T B)(0:r, :), row-oriented back substitution
+    Matrix Z = QtB.block(0, 0, r, nrhs);
+    for (int i = r - 1; i >= 0; i--) {
+        double* z_i = &Z(i, 0);
+        for (int k = i + 1; k < r; k++) {
+            const double rik = QR(i, k);
+            const double* z_k = &Z(k, 0);
+            for (int j = 0; j < nrhs; j++) z_i[j] -= rik * z_k[j];
+        }
+        const double inv = 1.0 / QR(i, i);
+        for (int j = 0; j < nrhs; j++) z_i[j] *= inv;
+    }
+
+    X = Matrix(n, nrhs);
+    for (int i = 0; i < r; i++) {
+        std::copy(&Z(i, 0), &Z(i, 0) + nrhs, &X(jpvt[i], 0));
+    }
+    return r;
+}
+
+double qr_flops(int m, int n) {
+    const double big = std::max(m, n), small = std::min(m, n);
+    return 2.0 * small * small * (big - small / 3.0);
+}
@@ -0,0 +1,73 @@
+#ifndef PIVOTED_QR_H
+#define PIVOTED_QR_H
+
+#include <vector>
+#include "../../chapter1/src/matrix_utils.h"
+
+// QR with column pivoting, A * P = Q * R
+// Golub & Van Loan Sections 5.4.2 and 5.5.5
+//
+// Storage matches householder_qr (chapter5/householder): R in the upper
+// triangle, Householder vectors below the diagonal, tau with min(m, n)
+// entries, so householder_qr_apply_q applies Q. jpvt[j] is the column of
+// the original A that ended up in position j, i.e. P(:, j) = e_jpvt[j].
+//
+// Every variant chooses the column of largest remaining norm, so
+// |R(0,0)| >= |R(1,1)| >= ... and a small trailing diagonal reveals the
+// numerical rank.
+
+// ============================================================================
+// Level 2 reference (Businger-Golub, LAPACK xGEQPF / xLAQP2)
+// One reflector at a time, applied to the whole trailing matrix. Column
+// norms are downdated, ||x(k+1:)||^2 = ||x(k:)||^2 - x(k)^2, and recomputed
+// when cancellation has eaten half the digits (xLAQP2 tol3z = sqrt(eps)).
+// ============================================================================
+void qr_pivoted_unblocked(Matrix& A, std::vector<int>& jpvt, std::vector<double>& tau);
+
+// ============================================================================
+// BLAS-3 pivoted QR (Quintana-Orti, Sun & Bischof 1998; LAPACK xGEQP3 / xLAQPS)
+//
+// Pivoting needs the updated norms after every step, so the trailing matrix
+// cannot simply be left for a block reflector. Instead each panel keeps
+//   F = tau * A^T * v  (incrementally updated),   A_trailing = A - V * F^T
+// and only updates the column about to be pivoted and the current row of R
+// on the fly (Level 2). The trailing matrix gets one GEMM per panel, which
+// is half of its update flops. A panel ends early when a downdated norm
+// becomes unreliable; those norms are recomputed after the GEMM.
+// ============================================================================
+void qr_pivoted(Matrix& A, std::vector<int>& jpvt, std::vector<double>& tau, int block_size);
+
+// ============================================================================
+// Randomized block pivoting (Martinsson, Quintana-Orti, Heavner & van de
+// Geijn 2017, HQRRP)
+//
+// A Gaussian sketch Y = G * A with block_size + oversample rows stands in for
+// A when choosing pivots: Level 2 pivoted QR on the small Y picks the next
+// block_size columns at once. The block is then factored without pivoting
+// and applied to the trailing matrix as a block reflector, so all trailing
+// flops are GEMM. The sketch is downdated instead of recomputed:
+//   Y2 = Y2 - Y1 * R11^-1 * R12   (= G*Q2 * A22, again Gaussian).
+// Pivots follow the column norms only approximately, but the rank is
+// revealed as reliably in practice. G is drawn from seed, so the same seed
+// gives the same pivots.
+// ============================================================================
+void qr_pivoted_randomized(Matrix& A, std::vector<int>& jpvt, std::vector<double>& tau,
+                           int block_size, int oversample = 8, unsigned seed = 2017);
+
+// Numerical rank: number of |R(k,k)| > rtol * |R(0,0)|
+int qr_numerical_rank(const Matrix& QR, double rtol);
+
+// ============================================================================
+// Rank-deficient least squares, min ||A*X - B|| (Section 5.5.5)
+// Basic solution from qr_pivoted: with r the numerical rank,
+//   R11 * Z1 = (Q^T * B)(0:r, :),   X = P * [Z1; 0]
+// Returns r.
+// ============================================================================
+int least_squares_pivoted(const Matrix& A, const Matrix& B, Matrix& X, double rtol,
+                          int block_size);
+
+// Flop count of Householder QR of an m×n matrix (2n^2(m - n/3)), shared by
+// all variants for GFLOPS reporting
+double qr_flops(int m, int n);
+
+#endif // PIVOTED_QR_H
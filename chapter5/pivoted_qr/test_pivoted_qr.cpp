@@ -0,0 +1,244 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include "pivoted_qr.h"
+#include "../householder/householder.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+
+typedef void (*PivotedQR)(Matrix&, std::vector<int>&, std::vector<double>&);
+
+void qp3_8(Matrix& A, std::vector<int>& jpvt, std::vector<double>& tau) {
+    qr_pivoted(A, jpvt, tau, 8);
+}
+void qp3_32(Matrix& A, std::vector<int>& jpvt, std::vector<double>& tau) {
+    qr_pivoted(A, jpvt, tau, 32);
+}
+void randomized_16(Matrix& A, std::vector<int>& jpvt, std::vector<double>& tau) {
+    qr_pivoted_randomized(A, jpvt, tau, 16);
+}
+
+double max_abs(const Matrix& A) {
+    double m = 0.0;
+    for (double x : A.data) m = std::max(m, std::abs(x));
+    return m;
+}
+
+// Rank-r m×n matrix B*C
+Matrix random_low_rank(int m, int n, int r) {
+    Matrix B(m, r), C(r, n), A(m, n);
+    B.fill_random();
+    C.fill_random();
+    gemm_ikj(B, C, A);
+    return A;
+}
+
+// ||A*P - Q*R||_max, with Q applied through householder_qr_apply_q
+double reconstruction_error(const Matrix& A, const Matrix& QR, const std::vector<int>& jpvt,
+                            const std::vector<double>& tau) {
+    const int m = A.m, n = A.n;
+    Matrix R(m, n);
+    for (int i = 0; i < std::min(m, n); i++) {
+        for (int j = i; j < n; j++) R(i, j) = QR(i, j);
+    }
+    householder_qr_apply_q(QR, tau, R, false, 16);
+    double max_diff = 0.0;
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) {
+            max_diff = std::max(max_diff, std::abs(A(i, jpvt[j]) - R(i, j)));
+        }
+    }
+    return max_diff;
+}
+
+// Column pivoting invariant: r_kk^2 >= sum_{i=k}^{j} r_ij^2 for every j > k,
+// to a relative tolerance (the floor only absorbs exact zeros)
+bool pivoting_invariant(const Matrix& QR, double tol) {
+    const int kmax = std::min(QR.m, QR.n);
+    for (int k = 0; k < kmax; k++) {
+        double rkk = QR(k, k) * QR(k, k);
+        for (int j = k + 1; j < QR.n; j++) {
+            double s = 0.0;
+            for (int i = k; i <= std::min(j, QR.m - 1); i++) s += QR(i, j) * QR(i, j);
+            if (s > rkk * (1.0 + tol) + 1e-30) return false;
+        }
+    }
+    return true;
+}
+
+bool test_factorization() {
+    std::cout << "Testing A*P = Q*R and the pivoting invariant... ";
+
+    struct Variant { const char* name; PivotedQR f; bool exact_pivoting; };
+    Variant variants[] = {{"unblocked", qr_pivoted_unblocked, true},
+                          {"QP3 nb=8", qp3_8, true},
+                          {"QP3 nb=32", qp3_32, true},
+                          {"randomized", randomized_16, false}};
+
+    for (auto [m, n] : {std::pair{1, 1}, {7, 5}, {100, 100}, {150, 60}, {60, 150}}) {
+        Matrix A(m, n);
+        A.fill_random();
+        for (const Variant& v : variants) {
+            Matrix QR = A;
+            std::vector<int> jpvt;
+            std::vector<double> tau;
+            v.f(QR, jpvt, tau);
+            if (reconstruction_error(A, QR, jpvt, tau) > 1e-12 * std::max(m, n)) {
+                std::cout << "FAILED (" << v.name << ", " << m << "x" << n << ", A*P != Q*R)\n";
+                return false;
+            }
+            if (v.exact_pivoting && !pivoting_invariant(QR, 1e-10)) {
+                std::cout << "FAILED (" << v.name << ", " << m << "x" << n
+                          << ", pivot not the largest column)\n";
+                return false;
+            }
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_norm_recomputation() {
+    std::cout << "Testing norm downdating on graded columns... ";
+
+    // Columns nearly in the span of earlier ones: downdated norms lose all
+    // their digits and must be recomputed for the pivots to stay right
+    const int m = 120, n = 80;
+    Matrix A = random_low_rank(m, n, 20);
+    Matrix E(m, n);
+    E.fill_random();
+    for (int j = 0; j < n; j++) {
+        double scale = std::pow(10.0, -6.0 - (j % 5));
+        for (int i = 0; i < m; i++) A(i, j) += scale * E(i, j);
+    }
+
+    for (PivotedQR f : {qr_pivoted_unblocked, qp3_8, qp3_32}) {
+        Matrix QR = A;
+        std::vector<int> jpvt;
+        std::vector<double> tau;
+        f(QR, jpvt, tau);
+        if (!pivoting_invariant(QR, 1e-6)) {
+            std::cout << "FAILED (pivot not the largest column after cancellation)\n";
+            return false;
+        }
+        if (reconstruction_error(A, QR, jpvt, tau) > 1e-12 * m) {
+            std::cout << "FAILED (A*P != Q*R)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_rank_revealing() {
+    std::cout << "Testing numerical rank of low-rank matrices... ";
+
+    for (int r : {1, 10, 45}) {
+        Matrix A = random_low_rank(200, 90, r);
+        for (PivotedQR f : {qr_pivoted_unblocked, qp3_32, randomized_16}) {
+            Matrix QR = A;
+            std::vector<int> jpvt;
+            std::vector<double> tau;
+            f(QR, jpvt, tau);
+            int rank = qr_numerical_rank(QR, 1e-10);
+            if (rank != r) {
+                std::cout << "FAILED (rank " << r << " detected as " << rank << ")\n";
+                return false;
+            }
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// The sketch is drawn from the seed: the same seed repeats the pivots and
+// factors exactly; another seed still reveals the rank
+bool test_randomized_seed() {
+    std::cout << "Testing randomized pivoting is reproducible... ";
+
+    Matrix A = random_low_rank(120, 70, 30);
+    std::vector<int> jpvt1, jpvt2, jpvt3;
+    std::vector<double> tau1, tau2, tau3;
+    Matrix QR1 = A, QR2 = A, QR3 = A;
+    qr_pivoted_randomized(QR1, jpvt1, tau1, 16, 8, 7);
+    qr_pivoted_randomized(QR2, jpvt2, tau2, 16, 8, 7);
+    qr_pivoted_randomized(QR3, jpvt3, tau3, 16, 8, 8);
+    if (jpvt1 != jpvt2 || QR1.data != QR2.data || tau1 != tau2) {
+        std::cout << "FAILED (same seed, different result)\n";
+        return false;
+    }
+    if (qr_numerical_rank(QR3, 1e-10) != 30) {
+        std::cout << "FAILED (rank with another seed)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_least_squares() {
+    std::cout << "Testing rank-deficient least squares... ";
+
+    const int m = 150, n = 60, r = 25;
+    Matrix A = random_low_rank(m, n, r);
+    Matrix B(m, 3);
+    B.fill_random();
+
+    Matrix X(n, 3);
+    int rank = least_squares_pivoted(A, B, X, 1e-10, 16);
+    if (rank != r) {
+        std::cout << "FAILED (rank " << rank << ")\n";
+        return false;
+    }
+
+    // Basic solution: at most r nonzero rows
+    int nonzero_rows = 0;
+    for (int i = 0; i < n; i++) {
+        bool nz = false;
+        for (int j = 0; j < 3; j++) nz |= X(i, j) != 0.0;
+        nonzero_rows += nz;
+    }
+    if (nonzero_rows > r) {
+        std::cout << "FAILED (" << nonzero_rows << " nonzero rows)\n";
+        return false;
+    }
+
+    // Normal equations: A^T (B - A X) = 0
+    Matrix AX(m, 3);
+    gemm_ikj(A, X, AX);
+    for (size_t i = 0; i < AX.data.size(); i++) AX.data[i] = B.data[i] - AX.data[i];
+    Matrix AtR(n, 3);
+    gemm_ikj(A.transpose(), AX, AtR);
+    if (max_abs(AtR) > 1e-10 * max_abs(A) * max_abs(B) * m) {
+        std::cout << "FAILED (residual not orthogonal to range(A))\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Pivoted QR\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_factorization();
+    all_passed &= test_norm_recomputation();
+    all_passed &= test_rank_revealing();
+    all_passed &= test_randomized_seed();
+    all_passed &= test_least_squares();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+#include "qr_update.h"
+#include "../householder/householder.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+#include <cmath>
+
+// Block size handed to gemm_blocked for the trailing update
+static const int kGemmBlock = 64;
+
+QRUpdater::QRUpdater(int n, int nrhs, int block_size)
+    : n_(n), nrhs_(nrhs), block_size_(block_size), R_(n, n), Z_(n, nrhs) {}
+
+// ============================================================================
+// Reflector for x = [top(j,j); bot(0:k, j)] (xLARFG sign convention)
+//
+// On return top(j,j) = beta and bot(:, j) holds y, so that the reflector
+// is I - tau * [e_j; y] [e_j; y]^T. R's other rows are not involved.
+// ============================================================================
+static double pentagonal_reflector(Matrix& top, Matrix& bot, int j) {
+    double sigma = 0.0;
+    for (int i = 0; i < bot.m; i++) sigma += bot(i, j) * bot(i, j);
+    if (sigma == 0.0) return 0.0;
+
+    const double alpha = top(j, j);
+    const double norm = std::sqrt(alpha * alpha + sigma);
+    const double beta = (alpha >= 0.0) ? -norm : norm;
+    const double tau = (beta - alpha) / beta;
+    const double scale = 1.0 / (alpha - beta);
+    for (int i = 0; i < bot.m; i++) bot(i, j) *= scale;
+    top(j, j) = beta;
+    return tau;
+}
+
+// ============================================================================
+// TRIANGULAR-PENTAGONAL QR of [top; bot]
+//
+// top = [R Z] (n × n+nrhs), bot = [A B] (k × n+nrhs).
+// for each panel of block_size columns:
+//     for j in panel: reflector from (top(j,j), bot(:,j)), applied to the
+//                     rest of the panel (row j of top and all of bot)
+//     trailing columns, compact WY with V = [I; Y]:
+//         W   = top(panel, trailing) + Y^T * bot(:, trailing)   (GEMM)
+//         W   = T^T * W
+//         top(panel, trailing) -= W
+//         bot(:, trailing)     -= Y * W                        (GEMM)
+// The identity part of V makes V^T V = I + Y^T Y, so T is built from Y
+// alone by householder_block_t.
+// ============================================================================
+void QRUpdater::add_rows(const Matrix& A, const Matrix& B) {
+    const int k = A.m;
+    if (k == 0) return;
+    const int cols = n_ + nrhs_;
+
+    Matrix top(n_, cols), bot(k, cols);
+    top.set_block(0, 0, R_);
+    top.set_block(0, n_, Z_);
+    bot.set_block(0, 0, A);
+    bot.set_block(0, n_, B);
+
+    std::vector<double> tau(n_, 0.0);
+    std::vector<double> w(cols);
+
+    for (int j0 = 0; j0 < n_; j0 += block_size_) {
+        const int nb = std::min(block_size_, n_ - j0);
+        const int panel_end = j0 + nb;
+
+        for (int j = j0; j < panel_end; j++) {
+            const double t = pentagonal_reflector(top, bot, j);
+            tau[j] = t;
+            if (t == 0.0) continue;
+
+            // w = top(j, c) + y^T bot(:, c) for the rest of the panel
+            for (int c = j + 1; c < panel_end; c++) w[c] = top(j, c);
+            for (int i = 0; i < k; i++) {
+                const double y_i = bot(i, j);
+                for (int c = j + 1; c < panel_end; c++) w[c] += y_i * bot(i, c);
+            }
+            for (int c = j + 1; c < panel_end; c++) top(j, c) -= t * w[c];
+            for (int i = 0; i < k; i++) {
+                const double ty = t * bot(i, j);
+                for (int c = j + 1; c < panel_end; c++) bot(i, c) -= ty * w[c];
+            }
+        }
+
+        const int trailing = cols - panel_end;
+        if (trailing == 0) continue;
+
+        Matrix Y = bot.block(0, j0, k, nb);
+        std::vector<double> tau_b(tau.begin() + j0, tau.begin() + panel_end);
+        Matrix T = householder_block_t(Y, tau_b);
+
+        Matrix W = top.block(j0, panel_end, nb, trailing);
+        Matrix C = bot.block(0, panel_end, k, trailing);
+        gemm_blocked(Y.transpose(), C, W, kGemmBlock);
+
+        // W = T^T * W: row p uses rows q <= p, so sweep bottom-up
+        std::vector<double> row(trailing);
+        for (int p = nb - 1; p >= 0; p--) {
+            std::fill(row.begin(), row.end(), 0.0);
+            for (int q = 0; q <= p; q++) {
+                const double t_qp = T(q, p);
+                const double* w_q = &W(q, 0);
+                for (int c = 0; c < trailing; c++) row[c] += t_qp * w_q[c];
+            }
+            std::copy(row.begin(), row.end(), &W(p, 0));
+        }
+
+        for (int p = 0; p < nb; p++) {
+            double* top_p = &top(j0 + p, panel_end);
+            const double* w_p = &W(p, 0);
+            for (int c = 0; c < trailing; c++) top_p[c] -= w_p[c];
+        }
+        for (auto& x : W.data) x = -x;
+        gemm_blocked(Y, W, C, kGemmBlock);
+        bot.set_block(0, panel_end, C);
+    }
+
+    // The right-hand side columns of bot are now the residuals of the new rows
+    for (int i = 0; i < k; i++) {
+        for (int c = n_; c < cols; c++) residual_sq_ += bot(i, c) * bot(i, c);
+    }
+    R_ = top.block(0, 0, n_, n_);
+    Z_ = top.block(0, n_, n_, nrhs_);
+    rows_ += k;
+}
+
+// ============================================================================
+// R X = Z, row-oriented back substitution
+// ============================================================================
+bool QRUpdater::solve(Matrix& X) const {
+    if (rows_ < n_) return false;
+    for (int i = 0; i < n_; i++) {
+        if (R_(i, i) == 0.0) return false;
+    }
+    X = Z_;
+    for (int i = n_ - 1; i >= 0; i--) {
+        double* x_i = &X(i, 0);
+        for (int p = i + 1; p < n_; p++) {
+            const double r_ip = R_(i, p);
+            const double* x_p = &X(p, 0);
+            for (int j = 0; j < nrhs_; j++) x_i[j] -= r_ip * x_p[j];
+        }
+        const double inv = 1.0 / R_(i, i);
+        for (int j = 0; j < nrhs_; j++) x_i[j] *= inv;
+    }
+    return true;
+}
+
+double QRUpdater::residual_norm() const {
+    return std::sqrt(residual_sq_);
+}
+
+double qr_update_flops(int k, int n, int nrhs) {
+    return 2.0 * k * n * n + 4.0 * k * n * nrhs;
+}
@@ -0,0 +1,63 @@
+#ifndef QR_UPDATE_H
+#define QR_UPDATE_H
+
+#include <vector>
+#include "../../chapter1/src/matrix_utils.h"
+
+// Recursive least squares by QR updating, Golub & Van Loan Section 6.5.3
+//
+// Rows [A_new  B_new] arriving in blocks are folded into the triangular
+// factor of everything seen so far:
+//
+//   [ R  Z ]            [ R'  Z' ]
+//   [ A  B ]  = Q  *    [ 0   E  ]        A, B: the k new rows
+//
+// Q is a product of Householder reflectors whose vectors are e_j on top
+// and y_j (k entries) below, so each one touches only row j of R and the
+// k new rows (LAPACK xTPQRT, triangular-pentagonal QR). The update costs
+// about 2kn^2 flops, independent of how many rows came before. The rows of
+// E are the residuals of the new rows and only their norm is kept.
+//
+// Blocked: the reflectors of a panel of block_size columns are built with
+// Level 2 updates restricted to the panel and then applied to the trailing
+// columns in compact WY form, W = T^T (R_panel + Y^T A_trailing), through
+// gemm_blocked.
+
+class QRUpdater {
+public:
+    // n unknowns, nrhs right-hand sides
+    QRUpdater(int n, int nrhs, int block_size = 32);
+
+    // Fold in the rows of A (k×n) and B (k×nrhs)
+    void add_rows(const Matrix& A, const Matrix& B);
+
+    int unknowns() const { return n_; }
+    long long rows_seen() const { return rows_; }
+
+    // Upper triangular R (n×n) with R^T R = A^T A over all rows seen, and
+    // Z = (Q^T B)(0:n, :) (n×nrhs)
+    const Matrix& R() const { return R_; }
+    const Matrix& Z() const { return Z_; }
+
+    // min ||A X - B|| over all rows seen: X = R^-1 Z by back substitution,
+    // O(n^2 nrhs). Returns false while fewer than n rows have been seen or
+    // R has an exactly zero diagonal entry; near rank deficiency is not
+    // detected.
+    bool solve(Matrix& X) const;
+
+    // Residual norm ||A X - B||_F of the current least-squares solution
+    double residual_norm() const;
+
+private:
+    int n_;
+    int nrhs_;
+    int block_size_;
+    long long rows_ = 0;
+    Matrix R_;
+    Matrix Z_;
+    double residual_sq_ = 0.0;
+};
+
+double qr_update_flops(int k, int n, int nrhs);
+
+#endif // QR_UPDATE_H
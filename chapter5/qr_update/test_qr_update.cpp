@@ -0,0 +1,176 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "qr_update.h"
+#include "../householder/householder.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+
+// Least squares from scratch on all rows: householder_qr, Q^T B, back
+// substitution. Returns the residual norm; R gets the triangular factor.
+double reference_solve(const Matrix& A, const Matrix& B, Matrix& X, Matrix& R) {
+    const int m = A.m, n = A.n, nrhs = B.n;
+    Matrix QR = A;
+    std::vector<double> tau;
+    householder_qr(QR, tau, 16);
+    Matrix QtB = B;
+    householder_qr_apply_q(QR, tau, QtB, true, 16);
+
+    R = Matrix(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = i; j < n; j++) R(i, j) = QR(i, j);
+    }
+    X = QtB.block(0, 0, n, nrhs);
+    for (int i = n - 1; i >= 0; i--) {
+        for (int p = i + 1; p < n; p++) {
+            for (int j = 0; j < nrhs; j++) X(i, j) -= R(i, p) * X(p, j);
+        }
+        for (int j = 0; j < nrhs; j++) X(i, j) /= R(i, i);
+    }
+    double res = 0.0;
+    for (int i = n; i < m; i++) {
+        for (int j = 0; j < nrhs; j++) res += QtB(i, j) * QtB(i, j);
+    }
+    return std::sqrt(res);
+}
+
+// R is unique up to the sign of each row: compare |R| row by row after
+// matching the sign of the diagonal
+double r_factor_diff(const Matrix& R1, const Matrix& R2) {
+    double d = 0.0;
+    for (int i = 0; i < R1.m; i++) {
+        const double s = (R1(i, i) * R2(i, i) < 0.0) ? -1.0 : 1.0;
+        for (int j = 0; j < R1.n; j++) d = std::max(d, std::abs(R1(i, j) - s * R2(i, j)));
+    }
+    return d;
+}
+
+// Stream the rows of A, B in blocks of the given sizes (cycled)
+QRUpdater stream_rows(const Matrix& A, const Matrix& B, const std::vector<int>& sizes,
+                      int block_size) {
+    QRUpdater qr(A.n, B.n, block_size);
+    int r0 = 0;
+    for (size_t s = 0; r0 < A.m; s++) {
+        const int k = std::min(sizes[s % sizes.size()], A.m - r0);
+        qr.add_rows(A.block(r0, 0, k, A.n), B.block(r0, 0, k, B.n));
+        r0 += k;
+    }
+    return qr;
+}
+
+bool test_against_full_qr() {
+    std::cout << "Testing streamed R, solution and residual against full QR... ";
+
+    const int m = 600, n = 45, nrhs = 3;
+    Matrix A(m, n), B(m, nrhs);
+    A.fill_random();
+    B.fill_random();
+    Matrix X_ref(0, 0), R_ref(0, 0);
+    const double res_ref = reference_solve(A, B, X_ref, R_ref);
+
+    // Row blocks down to single rows, panel widths around and above n
+    const std::vector<std::vector<int>> row_blocks = {{1}, {7, 64, 3}, {100}, {600}};
+    for (const auto& sizes : row_blocks) {
+        for (int block_size : {1, 8, 32, 64}) {
+            QRUpdater qr = stream_rows(A, B, sizes, block_size);
+            Matrix X(0, 0);
+            if (!qr.solve(X) || qr.rows_seen() != m ||
+                r_factor_diff(qr.R(), R_ref) > 1e-10 || max_abs_diff(X, X_ref) > 1e-10 ||
+                std::abs(qr.residual_norm() - res_ref) > 1e-10 * res_ref) {
+                std::cout << "FAILED (first row block " << sizes[0] << ", block_size "
+                          << block_size << ")\n";
+                return false;
+            }
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// The solution is current after every block, including the first one that
+// makes R nonsingular; before that solve() reports failure
+bool test_solution_at_any_moment() {
+    std::cout << "Testing the solution after every block... ";
+
+    const int n = 20, nrhs = 2;
+    QRUpdater qr(n, nrhs, 8);
+    Matrix A_all(0, n), B_all(0, nrhs);
+    Matrix X(0, 0);
+
+    for (int k : {6, 6, 6, 6, 30, 1, 50}) {
+        Matrix A(k, n), B(k, nrhs);
+        A.fill_random();
+        B.fill_random();
+        qr.add_rows(A, B);
+
+        Matrix A_next(A_all.m + k, n), B_next(B_all.m + k, nrhs);
+        A_next.set_block(0, 0, A_all);
+        A_next.set_block(A_all.m, 0, A);
+        B_next.set_block(0, 0, B_all);
+        B_next.set_block(B_all.m, 0, B);
+        A_all = A_next;
+        B_all = B_next;
+
+        if (A_all.m < n) {
+            if (qr.solve(X)) {
+                std::cout << "FAILED (solved with " << A_all.m << " rows)\n";
+                return false;
+            }
+            continue;
+        }
+        Matrix X_ref(0, 0), R_ref(0, 0);
+        const double res_ref = reference_solve(A_all, B_all, X_ref, R_ref);
+        if (!qr.solve(X) || max_abs_diff(X, X_ref) > 1e-9 ||
+            std::abs(qr.residual_norm() - res_ref) > 1e-10 * std::max(1.0, res_ref)) {
+            std::cout << "FAILED (" << A_all.m << " rows)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Consistent data: the exact solution is recovered and the residual stays
+// at rounding level as rows keep arriving
+bool test_consistent_system() {
+    std::cout << "Testing recovery of an exact solution... ";
+
+    const int m = 2000, n = 60;
+    Matrix A(m, n), X_true(n, 1), B(m, 1);
+    A.fill_random();
+    X_true.fill_random();
+    gemm_ikj(A, X_true, B);
+
+    QRUpdater qr = stream_rows(A, B, {128}, 32);
+    Matrix X(0, 0);
+    if (!qr.solve(X) || max_abs_diff(X, X_true) > 1e-12 || qr.residual_norm() > 1e-11) {
+        std::cout << "FAILED (residual " << qr.residual_norm() << ")\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing QR Updating (Recursive Least Squares)\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_against_full_qr();
+    all_passed &= test_solution_at_any_moment();
+    all_passed &= test_consistent_system();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,250 @@
+#include "hessenberg.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+#include "../../chapter5/householder/householder.h"
+#include "../../chapter1/src/dot.h"
+#include <algorithm>
+
+// Block size handed to gemm_blocked for the trailing updates
+static const int kGemmBlock = 64;
+
+// ============================================================================
+// UNBLOCKED REFERENCE (Algorithm 7.4.2)
+//
+// for k = 0 .. n-2:
+//     generate P_k from A(k+1:n, k)
+//     A(k+1:n, k+1:n) = P_k * A(k+1:n, k+1:n)     (rank-1 update)
+//     A(0:n,   k+1:n) = A(0:n, k+1:n) * P_k       (rank-1 update)
+//
+// Every column costs two full passes over the trailing matrix.
+// ============================================================================
+void hessenberg_unblocked(Matrix& A, std::vector<double>& tau) {
+    const int n = A.n;
+    tau.assign(std::max(n - 1, 0), 0.0);
+    std::vector<double> v(n), w(n);
+
+    for (int k = 0; k < n - 1; k++) {
+        tau[k] = householder_column(A, k + 1, k);
+        if (tau[k] == 0.0) continue;
+
+        v[k + 1] = 1.0;
+        for (int i = k + 2; i < n; i++) v[i] = A(i, k);
+
+        // Left: w^T = v^T * A(k+1:n, k+1:n), then A -= tau * v * w^T
+        std::fill(w.begin() + k + 1, w.end(), 0.0);
+        for (int i = k + 1; i < n; i++) {
+            for (int j = k + 1; j < n; j++) {
+                w[j] += v[i] * A(i, j);
+            }
+        }
+        for (int i = k + 1; i < n; i++) {
+            double tv = tau[k] * v[i];
+            for (int j = k + 1; j < n; j++) {
+                A(i, j) -= tv * w[j];
+            }
+        }
+
+        // Right: s = A(0:n, k+1:n) * v, then A -= tau * s * v^T
+        for (int i = 0; i < n; i++) {
+            double s = 0.0;
+            for (int j = k + 1; j < n; j++) {
+                s += A(i, j) * v[j];
+            }
+            s *= tau[k];
+            for (int j = k + 1; j < n; j++) {
+                A(i, j) -= s * v[j];
+            }
+        }
+    }
+}
+
+// ============================================================================
+// PANEL FACTORIZATION (LAPACK xLAHR2)
+//
+// Reduces columns j0 .. j0+nb-1 while leaving the rest of A untouched.
+// Builds, for the panel's reflectors Q = I - V*T*V^T:
+//   V (n×nb)  Householder vectors, zero above row j0+c+1 in column c
+//   T (nb×nb) upper triangular compact-WY factor
+//   Y (n×nb)  Y = A0*V*T, where A0 is A at the start of the panel
+//
+// Column j of the panel is brought up to date lazily just before its
+// reflector is generated:
+//   a_j = a_j - Y*V(j,:)^T           (previous reflectors from the right)
+//   a_j = a_j - V*T^T*(V^T*a_j)      (previous reflectors from the left)
+// Columns to the right of j still hold A0, so A0*v can be read directly.
+// ============================================================================
+static void hessenberg_panel(Matrix& A, std::vector<double>& tau, int j0, int nb,
+                             Matrix& V, Matrix& T, Matrix& Y) {
+    const int n = A.n;
+    std::vector<double> w(nb), z(nb), v(n);
+
+    for (int c = 0; c < nb; c++) {
+        const int j = j0 + c;
+
+        if (c > 0) {
+            // Right update of column j by the panel's earlier reflectors
+            for (int i = 0; i < n; i++) {
+                double s = 0.0;
+                for (int p = 0; p < c; p++) s += Y(i, p) * V(j, p);
+                A(i, j) -= s;
+            }
+
+            // Left update: w = V^T * a_j, w = T^T * w, a_j -= V * w
+            // (row-oriented: each A(i, j) is loaded once, not once per p)
+            std::fill(w.begin(), w.begin() + c, 0.0);
+            for (int i = j0 + 1; i < n; i++) {
+                double a_ij = A(i, j);
+                for (int p = 0; p < c; p++) w[p] += V(i, p) * a_ij;
+            }
+            for (int p = c - 1; p >= 0; p--) {
+                double s = 0.0;
+                for (int q = 0; q <= p; q++) s += T(q, p) * w[q];
+                w[p] = s;
+            }
+            for (int i = j0 + 1; i < n; i++) {
+                double s = 0.0;
+                for (int p = 0; p < c; p++) s += V(i, p) * w[p];
+                A(i, j) -= s;
+            }
+        }
+
+        double t = householder_column(A, j + 1, j);
+        tau[j] = t;
+
+        // Keep a contiguous copy of v for the mat-vec below
+        v[j + 1] = 1.0;
+        for (int i = j + 2; i < n; i++) v[i] = A(i, j);
+        for (int i = j + 1; i < n; i++) V(i, c) = v[i];
+
+        // y = A0 * v (the only Level 2 product left in the blocked algorithm)
+        for (int i = 0; i < n; i++) {
+            Y(i, c) = dot(&A(i, j + 1), &v[j + 1], n - j - 1);
+        }
+
+        // z = V(:, 0:c)^T * v
+        std::fill(z.begin(), z.begin() + c, 0.0);
+        for (int i = j + 1; i < n; i++) {
+            for (int p = 0; p < c; p++) z[p] += V(i, p) * v[i];
+        }
+
+        // Y(:, c) = tau * (y - Y(:, 0:c) * z)
+        for (int i = 0; i < n; i++) {
+            double s = 0.0;
+            for (int p = 0; p < c; p++) s += Y(i, p) * z[p];
+            Y(i, c) = t * (Y(i, c) - s);
+        }
+
+        // T(0:c, c) = -tau * T(0:c, 0:c) * z,  T(c, c) = tau
+        for (int p = 0; p < c; p++) {
+            double s = 0.0;
+            for (int q = p; q < c; q++) s += T(p, q) * z[q];
+            T(p, c) = -t * s;
+        }
+        T(c, c) = t;
+    }
+}
+
+// ============================================================================
+// BLOCKED REDUCTION
+//
+// for each panel of block_size columns:
+//     factor the panel -> V, T, Y
+//     A(:, trailing)     -= Y * V(trailing, :)^T           (GEMM)
+//     A(j0+1:, trailing)  = Q^T * A(j0+1:, trailing)       (2 GEMMs)
+//
+// The trailing block is copied out once per panel so the updates can run
+// on whole Matrix operands - the same role packing plays in a real BLAS.
+// ============================================================================
+void hessenberg_blocked(Matrix& A, std::vector<double>& tau, int block_size) {
+    const int n = A.n;
+    tau.assign(std::max(n - 1, 0), 0.0);
+
+    for (int j0 = 0; j0 < n - 1; j0 += block_size) {
+        const int nb = std::min(block_size, n - 1 - j0);
+
+        Matrix V(n, nb), T(nb, nb), Y(n, nb);
+        hessenberg_panel(A, tau, j0, nb, V, T, Y);
+
+        const int jt = j0 + nb;         // first trailing column
+        const int cols = n - jt;
+        if (cols <= 0) continue;
+
+        // Right update: A(:, jt:n) -= Y * V(jt:n, :)^T
+        // Rows 0..j0 only see this update; rows j0+1..n-1 also get Q^T
+        // from the left, so the two row ranges are copied out separately.
+        Matrix Vt_neg = V.block(jt, 0, cols, nb).transpose();
+        for (auto& v : Vt_neg.data) v = -v;
+
+        const int top = j0 + 1;
+        const int rows = n - top;
+        Matrix C_top = A.block(0, jt, top, cols);
+        gemm_blocked(Y.block(0, 0, top, nb), Vt_neg, C_top, kGemmBlock);
+        A.set_block(0, jt, C_top);
+
+        Matrix C_low = A.block(top, jt, rows, cols);
+        gemm_blocked(Y.block(top, 0, rows, nb), Vt_neg, C_low, kGemmBlock);
+
+        // Left update on rows j0+1 .. n-1: C = Q^T * C
+        apply_block_reflector_left(V.block(top, 0, rows, nb), T, C_low, true);
+        A.set_block(top, jt, C_low);
+    }
+}
+
+// ============================================================================
+// Convenience wrappers for testing different block sizes
+// ============================================================================
+void hessenberg_blocked_16(Matrix& A, std::vector<double>& tau) {
+    hessenberg_blocked(A, tau, 16);
+}
+
+void hessenberg_blocked_32(Matrix& A, std::vector<double>& tau) {
+    hessenberg_blocked(A, tau, 32);
+}
+
+void hessenberg_blocked_64(Matrix& A, std::vector<double>& tau) {
+    hessenberg_blocked(A, tau, 64);
+}
+
+// ============================================================================
+// Post-processing helpers
+// ============================================================================
+Matrix hessenberg_extract_h(const Matrix& A) {
+    Matrix H = A;
+    for (int i = 2; i < H.m; i++) {
+        for (int j = 0; j < i - 1; j++) {
+            H(i, j) = 0.0;
+        }
+    }
+    return H;
+}
+
+// Q = P_0 * P_1 * ... * P_{n-2}, accumulated backwards (Section 5.1.6)
+Matrix hessenberg_form_q(const Matrix& A, const std::vector<double>& tau) {
+    const int n = A.n;
+    Matrix Q(n, n);
+    for (int i = 0; i < n; i++) Q(i, i) = 1.0;
+
+    std::vector<double> v(n), w(n);
+    for (int k = n - 2; k >= 0; k--) {
+        if (tau[k] == 0.0) continue;
+        v[k + 1] = 1.0;
+        for (int i = k + 2; i < n; i++) v[i] = A(i, k);
+
+        std::fill(w.begin() + k + 1, w.end(), 0.0);
+        for (int i = k + 1; i < n; i++) {
+            for (int j = k + 1; j < n; j++) {
+                w[j] += v[i] * Q(i, j);
+            }
+        }
+        for (int i = k + 1; i < n; i++) {
+            double tv = tau[k] * v[i];
+            for (int j = k + 1; j < n; j++) {
+                Q(i, j) -= tv * w[j];
+            }
+        }
+    }
+    return Q;
+}
+
+double hessenberg_flops(int n) {
+    return 10.0 / 3.0 * static_cast<double>(n) * n * n;
+}
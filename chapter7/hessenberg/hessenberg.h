@@ -0,0 +1,48 @@
+#ifndef HESSENBERG_H
+#define HESSENBERG_H
+
+#include <vector>
+#include "../../chapter1/src/matrix_utils.h"
+
+// Householder reduction to upper Hessenberg form: A = Q*H*Q^T
+// Golub & Van Loan Section 7.4.3
+//
+// Storage (same for every variant, so results can be compared directly):
+//   On return, A holds H on and above the first subdiagonal.
+//   Below the subdiagonal, column j holds the Householder vector v_j
+//   (v_j(j+1) = 1 is implicit and not stored).
+//   tau has n-1 entries: H_j = I - tau[j] * v_j * v_j^T
+//   Q = H_0 * H_1 * ... * H_{n-2}
+
+// ============================================================================
+// Unblocked reference (Algorithm 7.4.2)
+// Each reflector is applied as two rank-1 updates that stream the whole
+// trailing matrix once per column - Level 2 BLAS throughout.
+// ============================================================================
+void hessenberg_unblocked(Matrix& A, std::vector<double>& tau);
+
+// ============================================================================
+// Blocked reduction (Quintana-Orti & van de Geijn, LAPACK xGEHRD)
+// Reflectors for block_size columns are accumulated as Q = I - V*T*V^T
+// together with Y = A*V*T. The trailing matrix is then updated with GEMM:
+//   A = A - Y*V^T            (right update)
+//   A = A - V*T^T*(V^T*A)    (left update)
+// Only the products A*v inside each panel remain Level 2.
+// ============================================================================
+void hessenberg_blocked(Matrix& A, std::vector<double>& tau, int block_size);
+
+// Convenience wrappers for different block sizes
+void hessenberg_blocked_16(Matrix& A, std::vector<double>& tau);
+void hessenberg_blocked_32(Matrix& A, std::vector<double>& tau);
+void hessenberg_blocked_64(Matrix& A, std::vector<double>& tau);
+
+// Copy H out of a reduced matrix (zeros below the subdiagonal)
+Matrix hessenberg_extract_h(const Matrix& A);
+
+// Form Q explicitly from the stored reflectors
+Matrix hessenberg_form_q(const Matrix& A, const std::vector<double>& tau);
+
+// Flop count of the reduction (10/3 n^3), used for GFLOPS reporting
+double hessenberg_flops(int n);
+
+#endif // HESSENBERG_H
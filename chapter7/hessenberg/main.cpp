@@ -0,0 +1,103 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include "hessenberg.h"
+
+// Benchmark a Hessenberg reduction, returns average time in milliseconds
+double benchmark_hessenberg(void (*reduce)(Matrix&, std::vector<double>&),
+                            const Matrix& A, int iterations) {
+    std::vector<double> tau;
+    Timer timer;
+
+    // Warm-up
+    Matrix R = A;
+    reduce(R, tau);
+
+    // Timed runs (the O(n^2) copy is negligible next to the O(n^3) reduction)
+    timer.start();
+    for (int iter = 0; iter < iterations; iter++) {
+        R = A;
+        reduce(R, tau);
+    }
+    double total_time = timer.elapsed_ms();
+
+    return total_time / iterations;
+}
+
+void compare_hessenberg(void (*reduce1)(Matrix&, std::vector<double>&),
+                        void (*reduce2)(Matrix&, std::vector<double>&),
+                        const std::string& name1,
+                        const std::string& name2,
+                        int size,
+                        int iterations) {
+    Matrix A(size, size);
+    A.fill_random();
+
+    double time1 = benchmark_hessenberg(reduce1, A, iterations);
+    double time2 = benchmark_hessenberg(reduce2, A, iterations);
+
+    double flops = hessenberg_flops(size);
+    double gflops1 = flops / (time1 * 1e6);
+    double gflops2 = flops / (time2 * 1e6);
+    double speedup = time1 / time2;  // >1 means reduce2 is faster
+
+    std::cout << "Matrix size: " << size << "×" << size << "\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "  " << std::left << std::setw(30) << (name1 + ":")
+              << std::right << std::setw(10) << time1 << " ms"
+              << std::setw(10) << gflops1 << " GFLOPS\n";
+    std::cout << "  " << std::left << std::setw(30) << (name2 + ":")
+              << std::right << std::setw(10) << time2 << " ms"
+              << std::setw(10) << gflops2 << " GFLOPS\n";
+    std::cout << "  Speedup: " << speedup << "x";
+
+    if (speedup > 1.05) {
+        std::cout << " (" << name2 << " is FASTER) ⭐\n";
+    } else if (speedup < 0.95) {
+        std::cout << " (" << name1 << " is FASTER)\n";
+    } else {
+        std::cout << " (similar performance)\n";
+    }
+    std::cout << "\n";
+}
+
+int main() {
+    std::cout << "================================================================\n";
+    std::cout << "BLOCKED HESSENBERG REDUCTION BENCHMARK\n";
+    std::cout << "================================================================\n\n";
+
+    std::cout << "Control: unblocked Householder (Algorithm 7.4.2, rank-1 updates)\n";
+    std::cout << "Test: blocked reduction with GEMM trailing updates (xGEHRD)\n";
+    std::cout << "Flop count: 10/3 n^3\n\n";
+
+    std::cout << "================================================================\n\n";
+
+    std::vector<int> sizes = {200, 400, 800, 1600};
+    std::vector<int> iters = {10, 3, 1, 1};
+
+    for (size_t i = 0; i < sizes.size(); i++) {
+        std::cout << ">>> Testing at size " << sizes[i] << " <<<\n\n";
+
+        compare_hessenberg(hessenberg_unblocked, hessenberg_blocked_16,
+                           "unblocked", "blocked-16",
+                           sizes[i], iters[i]);
+
+        compare_hessenberg(hessenberg_unblocked, hessenberg_blocked_32,
+                           "unblocked", "blocked-32",
+                           sizes[i], iters[i]);
+
+        compare_hessenberg(hessenberg_unblocked, hessenberg_blocked_64,
+                           "unblocked", "blocked-64",
+                           sizes[i], iters[i]);
+
+        std::cout << "================================================================\n\n";
+    }
+
+    std::cout << "What to look for:\n";
+    std::cout << "  • The blocked version pulls ahead as n outgrows the cache:\n";
+    std::cout << "    the unblocked code streams the matrix twice per column\n";
+    std::cout << "  • About 30% of the flops (the A*v products in each panel)\n";
+    std::cout << "    stay Level 2, which caps the achievable speedup\n";
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include "hessenberg.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+
+// Largest |H(i,j)| strictly below the first subdiagonal
+double below_subdiagonal(const Matrix& H) {
+    double max_val = 0.0;
+    for (int i = 2; i < H.m; i++) {
+        for (int j = 0; j < i - 1; j++) {
+            max_val = std::max(max_val, std::abs(H(i, j)));
+        }
+    }
+    return max_val;
+}
+
+// ||Q*H*Q^T - A||_max
+double reconstruction_error(const Matrix& A, const Matrix& Q, const Matrix& H) {
+    const int n = A.n;
+    Matrix QH(n, n), QHQt(n, n);
+    gemm_ikj(Q, H, QH);
+    gemm_ikj(QH, Q.transpose(), QHQt);
+
+    double max_diff = 0.0;
+    for (size_t i = 0; i < A.data.size(); i++) {
+        max_diff = std::max(max_diff, std::abs(QHQt.data[i] - A.data[i]));
+    }
+    return max_diff;
+}
+
+bool test_reduction(void (*reduce)(Matrix&, std::vector<double>&),
+                    const std::string& name) {
+    std::cout << "Testing " << name << "... ";
+
+    for (int n : {1, 2, 3, 17, 50, 101}) {
+        Matrix A(n, n);
+        A.fill_random();
+
+        Matrix R = A;
+        std::vector<double> tau;
+        reduce(R, tau);
+
+        Matrix H = hessenberg_extract_h(R);
+        Matrix Q = hessenberg_form_q(R, tau);
+
+        // Reference result from the unblocked algorithm
+        Matrix R_ref = A;
+        std::vector<double> tau_ref;
+        hessenberg_unblocked(R_ref, tau_ref);
+
+        double tol = 1e-12 * n;
+        if (below_subdiagonal(H) != 0.0) {
+            std::cout << "FAILED (n=" << n << ", not Hessenberg)\n";
+            return false;
+        }
+        if (orthogonality_error(Q) > tol) {
+            std::cout << "FAILED (n=" << n << ", Q not orthogonal)\n";
+            return false;
+        }
+        if (reconstruction_error(A, Q, H) > tol) {
+            std::cout << "FAILED (n=" << n << ", Q*H*Q^T != A)\n";
+            return false;
+        }
+
+        double max_diff = 0.0;
+        for (size_t i = 0; i < R.data.size(); i++) {
+            max_diff = std::max(max_diff, std::abs(R.data[i] - R_ref.data[i]));
+        }
+        if (max_diff > tol) {
+            std::cout << "FAILED (n=" << n << ", differs from unblocked by "
+                      << max_diff << ")\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Hessenberg Reduction\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_reduction(hessenberg_unblocked, "unblocked (control)");
+    all_passed &= test_reduction(hessenberg_blocked_16, "blocked (block_size=16)");
+    all_passed &= test_reduction(hessenberg_blocked_32, "blocked (block_size=32)");
+    all_passed &= test_reduction(hessenberg_blocked_64, "blocked (block_size=64)");
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
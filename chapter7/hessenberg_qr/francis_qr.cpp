@@ -0,0 +1,546 @@
+#include "hessenberg_qr.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+static const double kUlp = std::numeric_limits<double>::epsilon();
+static const double kSafeMin = std::numeric_limits<double>::min();
+
+// ============================================================================
+// SMALL REFLECTORS (nr <= 3)
+// ============================================================================
+
+// LAPACK xLARFG on x(0:nr): on return x(0) = beta, x(1:nr) = v(1:nr)
+// with v(0) = 1 implicit. Returns tau (0 when x(1:) is already zero).
+double householder_small(int nr, double* x) {
+    double xnorm = 0.0;
+    for (int i = 1; i < nr; i++) xnorm = std::hypot(xnorm, x[i]);
+    if (xnorm == 0.0) return 0.0;
+
+    double alpha = x[0];
+    double beta = -std::copysign(std::hypot(alpha, xnorm), alpha);
+    double scale = 1.0 / (alpha - beta);
+    for (int i = 1; i < nr; i++) x[i] *= scale;
+    x[0] = beta;
+    return (beta - alpha) / beta;
+}
+
+// A(r:r+nr, c0:c1) = (I - tau*v*v^T) * A(r:r+nr, c0:c1), v(0) = 1
+void reflect_rows(Matrix& A, int r, int nr, const double* v, double tau, int c0, int c1) {
+    if (tau == 0.0) return;
+    double* a0 = &A(r, 0);
+    double* a1 = &A(r + 1, 0);
+    if (nr == 3) {
+        double* a2 = &A(r + 2, 0);
+        for (int j = c0; j < c1; j++) {
+            double s = tau * (a0[j] + v[1] * a1[j] + v[2] * a2[j]);
+            a0[j] -= s;
+            a1[j] -= s * v[1];
+            a2[j] -= s * v[2];
+        }
+    } else {
+        for (int j = c0; j < c1; j++) {
+            double s = tau * (a0[j] + v[1] * a1[j]);
+            a0[j] -= s;
+            a1[j] -= s * v[1];
+        }
+    }
+}
+
+// A(r0:r1, c:c+nr) = A(r0:r1, c:c+nr) * (I - tau*v*v^T), v(0) = 1
+void reflect_cols(Matrix& A, int c, int nr, const double* v, double tau, int r0, int r1) {
+    if (tau == 0.0) return;
+    for (int i = r0; i < r1; i++) {
+        double* a = &A(i, c);
+        if (nr == 3) {
+            double s = tau * (a[0] + v[1] * a[1] + v[2] * a[2]);
+            a[0] -= s;
+            a[1] -= s * v[1];
+            a[2] -= s * v[2];
+        } else {
+            double s = tau * (a[0] + v[1] * a[1]);
+            a[0] -= s;
+            a[1] -= s * v[1];
+        }
+    }
+}
+
+// ============================================================================
+// 2×2 STANDARD FORM (LAPACK xLANV2)
+//
+// Computes a rotation [cs -sn; sn cs] such that
+//   [a b; c d] = [cs -sn; sn cs] * [aa bb; cc dd] * [cs sn; -sn cs]
+// where either cc = 0 (real eigenvalues aa, dd) or aa = dd and bb*cc < 0.
+// ============================================================================
+static void lanv2(double& a, double& b, double& c, double& d,
+                  double& rt1r, double& rt1i, double& rt2r, double& rt2i,
+                  double& cs, double& sn) {
+    const double multpl = 4.0;
+    cs = 1.0;
+    sn = 0.0;
+
+    if (c == 0.0) {
+        // already upper triangular
+    } else if (b == 0.0) {
+        // swap rows and columns
+        cs = 0.0;
+        sn = 1.0;
+        std::swap(a, d);
+        b = -c;
+        c = 0.0;
+    } else if (a - d == 0.0 && std::signbit(b) != std::signbit(c)) {
+        // already standard complex form
+    } else {
+        double temp = a - d;
+        double p = 0.5 * temp;
+        double bcmax = std::max(std::abs(b), std::abs(c));
+        double bcmis = std::min(std::abs(b), std::abs(c)) *
+                       std::copysign(1.0, b) * std::copysign(1.0, c);
+        double scale = std::max(std::abs(p), bcmax);
+        double z = (p / scale) * p + (bcmax / scale) * bcmis;
+
+        if (z >= multpl * kUlp) {
+            // Real eigenvalues: compute a and d
+            z = p + std::copysign(std::sqrt(scale) * std::sqrt(z), p);
+            a = d + z;
+            d = d - (bcmax / z) * bcmis;
+            double tau = std::hypot(c, z);
+            cs = z / tau;
+            sn = c / tau;
+            b = b - c;
+            c = 0.0;
+        } else {
+            // Complex or nearly equal real eigenvalues: make the diagonal equal
+            double sigma = b + c;
+            double tau = std::hypot(sigma, temp);
+            cs = std::sqrt(0.5 * (1.0 + std::abs(sigma) / tau));
+            sn = -(p / (tau * cs)) * std::copysign(1.0, sigma);
+
+            double aa = a * cs + b * sn;
+            double bb = -a * sn + b * cs;
+            double cc = c * cs + d * sn;
+            double dd = -c * sn + d * cs;
+
+            a = aa * cs + cc * sn;
+            b = bb * cs + dd * sn;
+            c = -aa * sn + cc * cs;
+            d = -bb * sn + dd * cs;
+
+            temp = 0.5 * (a + d);
+            a = temp;
+            d = temp;
+
+            if (c != 0.0) {
+                if (b != 0.0) {
+                    if (std::signbit(b) == std::signbit(c)) {
+                        // Real eigenvalues: reduce to upper triangular form
+                        double sab = std::sqrt(std::abs(b));
+                        double sac = std::sqrt(std::abs(c));
+                        p = std::copysign(sab * sac, c);
+                        tau = 1.0 / std::sqrt(std::abs(b + c));
+                        a = temp + p;
+                        d = temp - p;
+                        b = b - c;
+                        c = 0.0;
+                        double cs1 = sab * tau;
+                        double sn1 = sac * tau;
+                        temp = cs * cs1 - sn * sn1;
+                        sn = cs * sn1 + sn * cs1;
+                        cs = temp;
+                    }
+                } else {
+                    b = -c;
+                    c = 0.0;
+                    temp = cs;
+                    cs = -sn;
+                    sn = temp;
+                }
+            }
+        }
+    }
+
+    rt1r = a;
+    rt2r = d;
+    if (c == 0.0) {
+        rt1i = 0.0;
+        rt2i = 0.0;
+    } else {
+        rt1i = std::sqrt(std::abs(b)) * std::sqrt(std::abs(c));
+        rt2i = -rt1i;
+    }
+}
+
+// Plane rotation on two rows / two columns (BLAS xROT):
+//   x = cs*x + sn*y,  y = cs*y - sn*x
+static void rotate_rows(Matrix& A, int r1, int r2, double cs, double sn, int c0, int c1) {
+    double* x = &A(r1, 0);
+    double* y = &A(r2, 0);
+    for (int j = c0; j < c1; j++) {
+        double t = cs * x[j] + sn * y[j];
+        y[j] = cs * y[j] - sn * x[j];
+        x[j] = t;
+    }
+}
+
+static void rotate_cols(Matrix& A, int c1, int c2, double cs, double sn, int r0, int r1) {
+    for (int i = r0; i < r1; i++) {
+        double t = cs * A(i, c1) + sn * A(i, c2);
+        A(i, c2) = cs * A(i, c2) - sn * A(i, c1);
+        A(i, c1) = t;
+    }
+}
+
+bool standardize_2x2(Matrix& T, int i, Matrix* Z) {
+    const int n = T.n;
+    double rt1r, rt1i, rt2r, rt2i, cs, sn;
+    lanv2(T(i, i), T(i, i + 1), T(i + 1, i), T(i + 1, i + 1),
+          rt1r, rt1i, rt2r, rt2i, cs, sn);
+
+    rotate_rows(T, i, i + 1, cs, sn, i + 2, n);
+    rotate_cols(T, i, i + 1, cs, sn, 0, i);
+    if (Z != nullptr) rotate_cols(*Z, i, i + 1, cs, sn, 0, Z->m);
+    return T(i + 1, i) != 0.0;
+}
+
+void schur_eigenvalues(const Matrix& T, std::vector<double>& wr, std::vector<double>& wi) {
+    const int n = T.n;
+    wr.assign(n, 0.0);
+    wi.assign(n, 0.0);
+    for (int i = 0; i < n;) {
+        if (i + 1 < n && T(i + 1, i) != 0.0) {
+            double a = T(i, i), b = T(i, i + 1), c = T(i + 1, i), d = T(i + 1, i + 1);
+            double cs, sn;
+            lanv2(a, b, c, d, wr[i], wi[i], wr[i + 1], wi[i + 1], cs, sn);
+            i += 2;
+        } else {
+            wr[i] = T(i, i);
+            i++;
+        }
+    }
+}
+
+// ============================================================================
+// NEGLIGIBLE SUBDIAGONAL (Ahues & Tisseur, as in LAPACK xLAHQR)
+// Besides |h(k,k-1)| <= ulp * (|h(k-1,k-1)| + |h(k,k)|), the product of the
+// off-diagonal entries of the 2×2 block must be tiny relative to the
+// product of its diagonal scale, which avoids deflating too early.
+// ============================================================================
+bool negligible_subdiagonal(const Matrix& H, int k, double smlnum) {
+    double h = std::abs(H(k, k - 1));
+    if (h <= smlnum) return true;
+
+    double tst = std::abs(H(k - 1, k - 1)) + std::abs(H(k, k));
+    if (tst == 0.0) {
+        if (k >= 2) tst += std::abs(H(k - 1, k - 2));
+        if (k + 1 < H.n) tst += std::abs(H(k + 1, k));
+    }
+    if (h > kUlp * tst) return false;
+
+    double ab = std::max(h, std::abs(H(k - 1, k)));
+    double ba = std::min(h, std::abs(H(k - 1, k)));
+    double aa = std::max(std::abs(H(k, k)), std::abs(H(k - 1, k - 1) - H(k, k)));
+    double bb = std::min(std::abs(H(k, k)), std::abs(H(k - 1, k - 1) - H(k, k)));
+    double s = aa + ab;
+    return ba * (ab / s) <= std::max(smlnum, kUlp * (bb * (aa / s)));
+}
+
+// ============================================================================
+// FRANCIS DOUBLE-SHIFT QR ON AN ACTIVE BLOCK (Algorithm 7.5.2)
+//
+// while the block ilo..i is not reduced to 1×1 / 2×2 pieces:
+//     find the last negligible subdiagonal l, the active block is l..i
+//     shifts = eigenvalues of the trailing 2×2 (exceptional shifts every
+//              10 iterations without convergence)
+//     start the bulge at the lowest m where two consecutive subdiagonals
+//     make it safe, then chase it to the bottom with 3×3 reflectors
+// ============================================================================
+bool francis_qr_block(Matrix& H, int ilo, int ihi, Matrix* Z, HessenbergQRStats* stats) {
+    const int n = H.n;
+    if (ilo > ihi) return true;
+    const int nh = ihi - ilo + 1;
+    const double smlnum = kSafeMin * (nh / kUlp);
+    const int itmax = 30 * std::max(10, nh);
+
+    int i = ihi;
+    while (i >= ilo) {
+        int l = ilo;
+        bool converged = false;
+
+        for (int its = 0; its <= itmax; its++) {
+            int k = i;
+            for (; k > l; k--) {
+                if (negligible_subdiagonal(H, k, smlnum)) break;
+            }
+            l = k;
+            if (l > ilo) H(l, l - 1) = 0.0;
+            if (l >= i - 1) {
+                converged = true;
+                break;
+            }
+
+            // Shifts: eigenvalues of a 2×2 matrix
+            double h11, h12, h21, h22;
+            if (its > 0 && its % 20 == 10) {
+                double s = std::abs(H(l + 1, l)) + std::abs(H(l + 2, l + 1));
+                h11 = 0.75 * s + H(l, l);
+                h12 = -0.4375 * s;
+                h21 = s;
+                h22 = h11;
+            } else if (its > 0 && its % 20 == 0) {
+                double s = std::abs(H(i, i - 1)) + std::abs(H(i - 1, i - 2));
+                h11 = 0.75 * s + H(i, i);
+                h12 = -0.4375 * s;
+                h21 = s;
+                h22 = h11;
+            } else {
+                h11 = H(i - 1, i - 1);
+                h21 = H(i, i - 1);
+                h12 = H(i - 1, i);
+                h22 = H(i, i);
+            }
+
+            double rt1r = 0.0, rt1i = 0.0, rt2r = 0.0, rt2i = 0.0;
+            double s = std::abs(h11) + std::abs(h12) + std::abs(h21) + std::abs(h22);
+            if (s != 0.0) {
+                h11 /= s;
+                h21 /= s;
+                h12 /= s;
+                h22 /= s;
+                double tr = 0.5 * (h11 + h22);
+                double det = (h11 - tr) * (h22 - tr) - h12 * h21;
+                double rtdisc = std::sqrt(std::abs(det));
+                if (det >= 0.0) {
+                    // complex conjugate shifts
+                    rt1r = tr * s;
+                    rt2r = rt1r;
+                    rt1i = rtdisc * s;
+                    rt2i = -rt1i;
+                } else {
+                    // real shifts: use the one closer to h22 twice
+                    rt1r = tr + rtdisc;
+                    rt2r = tr - rtdisc;
+                    if (std::abs(rt1r - h22) <= std::abs(rt2r - h22)) {
+                        rt1r *= s;
+                        rt2r = rt1r;
+                    } else {
+                        rt2r *= s;
+                        rt1r = rt2r;
+                    }
+                }
+            }
+
+            // First column of (H - rt1)(H - rt2), started as low as possible
+            double v[3];
+            int m = i - 2;
+            for (; m >= l; m--) {
+                double h21s = H(m + 1, m);
+                double sc = std::abs(H(m, m) - rt2r) + std::abs(rt2i) + std::abs(h21s);
+                h21s /= sc;
+                v[0] = h21s * H(m, m + 1) + (H(m, m) - rt1r) * ((H(m, m) - rt2r) / sc) -
+                       rt1i * (rt2i / sc);
+                v[1] = h21s * (H(m, m) + H(m + 1, m + 1) - rt1r - rt2r);
+                v[2] = h21s * H(m + 2, m + 1);
+                sc = std::abs(v[0]) + std::abs(v[1]) + std::abs(v[2]);
+                v[0] /= sc;
+                v[1] /= sc;
+                v[2] /= sc;
+                if (m == l) break;
+                double h00 = std::abs(H(m, m - 1)) * (std::abs(v[1]) + std::abs(v[2]));
+                double h01 = std::abs(v[0]) * (std::abs(H(m - 1, m - 1)) + std::abs(H(m, m)) +
+                                               std::abs(H(m + 1, m + 1)));
+                if (h00 <= kUlp * h01) break;
+            }
+
+            // Chase the bulge from m to the bottom of the block
+            for (k = m; k <= i - 1; k++) {
+                const int nr = std::min(3, i - k + 1);
+                if (k > m) {
+                    for (int r = 0; r < nr; r++) v[r] = H(k + r, k - 1);
+                }
+                double tau = householder_small(nr, v);
+                if (k > m) {
+                    H(k, k - 1) = v[0];
+                    H(k + 1, k - 1) = 0.0;
+                    if (k < i - 1) H(k + 2, k - 1) = 0.0;
+                } else if (m > l) {
+                    // H(m+1:m+2, m-1) are negligible by the choice of m
+                    H(k, k - 1) *= (1.0 - tau);
+                }
+                v[0] = 1.0;
+
+                reflect_rows(H, k, nr, v, tau, k, n);
+                reflect_cols(H, k, nr, v, tau, 0, std::min(k + 3, i) + 1);
+                if (Z != nullptr) reflect_cols(*Z, k, nr, v, tau, 0, Z->m);
+            }
+            if (stats != nullptr) stats->double_shift_steps++;
+        }
+
+        if (!converged) return false;
+        if (l == i - 1) standardize_2x2(H, i - 1, Z);
+        i = l - 1;
+    }
+    return true;
+}
+
+// ============================================================================
+// SWAP ADJACENT SCHUR BLOCKS (LAPACK xLAEXC, direct method)
+//
+// Solve the small Sylvester equation T11*X - X*T22 = T12 (at most 4
+// unknowns). Then [-X; I] spans the invariant subspace of T22, and with
+// the QR factorization [-X; I] = Q*[R; 0]
+//   Q^T * [T11 T12; 0 T22] * Q = [R*T22*R^-1  *; 0  T11']
+// The swap is rejected if the new lower-left block is not negligible.
+// ============================================================================
+bool swap_schur_blocks(Matrix& T, int j, int p, int q, Matrix* Z) {
+    const int n = T.n;
+    const int nn = p + q;
+    Matrix D = T.block(j, j, nn, nn);
+
+    double dnorm = 0.0;
+    for (double x : D.data) dnorm = std::max(dnorm, std::abs(x));
+    const double smlnum = kSafeMin / kUlp;
+    const double thresh = std::max(10.0 * kUlp * dnorm, smlnum);
+    const double smin = std::max(kUlp * dnorm, smlnum);
+
+    // Kronecker form (I (x) T11 - T22^T (x) I) vec(X) = vec(T12), vec by columns
+    const int nx = p * q;
+    double K[4][5] = {};
+    for (int c = 0; c < q; c++) {
+        for (int i = 0; i < p; i++) {
+            const int row = i + c * p;
+            for (int k = 0; k < p; k++) K[row][k + c * p] += D(i, k);
+            for (int l = 0; l < q; l++) K[row][i + l * p] -= D(p + l, p + c);
+            K[row][nx] = D(i, p + c);
+        }
+    }
+
+    // Gaussian elimination with complete pivoting; tiny pivots are
+    // perturbed to smin as in LAPACK xLASY2
+    int perm[4] = {0, 1, 2, 3};
+    for (int k = 0; k < nx; k++) {
+        int pr = k, pc = k;
+        for (int r = k; r < nx; r++) {
+            for (int c = k; c < nx; c++) {
+                if (std::abs(K[r][c]) > std::abs(K[pr][pc])) {
+                    pr = r;
+                    pc = c;
+                }
+            }
+        }
+        for (int c = 0; c <= nx; c++) std::swap(K[k][c], K[pr][c]);
+        for (int r = 0; r < nx; r++) std::swap(K[r][k], K[r][pc]);
+        std::swap(perm[k], perm[pc]);
+        if (std::abs(K[k][k]) < smin) K[k][k] = smin;
+
+        for (int r = k + 1; r < nx; r++) {
+            double f = K[r][k] / K[k][k];
+            for (int c = k; c <= nx; c++) K[r][c] -= f * K[k][c];
+        }
+    }
+    double sol[4];
+    for (int k = nx - 1; k >= 0; k--) {
+        double s = K[k][nx];
+        for (int c = k + 1; c < nx; c++) s -= K[k][c] * sol[c];
+        sol[k] = s / K[k][k];
+    }
+    double x[4];
+    for (int k = 0; k < nx; k++) x[perm[k]] = sol[k];
+
+    // M = [-X; I], then Q = P_0 * ... * P_{q-1} from its Householder QR
+    Matrix M(nn, q);
+    for (int c = 0; c < q; c++) {
+        for (int i = 0; i < p; i++) M(i, c) = -x[i + c * p];
+        M(p + c, c) = 1.0;
+    }
+    Matrix Q(nn, nn);
+    for (int i = 0; i < nn; i++) Q(i, i) = 1.0;
+    for (int c = 0; c < q; c++) {
+        double v[4];
+        const int len = nn - c;
+        for (int i = 0; i < len; i++) v[i] = M(c + i, c);
+        double tau = 0.0;
+        double xnorm = 0.0;
+        for (int i = 1; i < len; i++) xnorm = std::hypot(xnorm, v[i]);
+        if (xnorm != 0.0) {
+            double beta = -std::copysign(std::hypot(v[0], xnorm), v[0]);
+            double scale = 1.0 / (v[0] - beta);
+            for (int i = 1; i < len; i++) v[i] *= scale;
+            tau = (beta - v[0]) / beta;
+        }
+        v[0] = 1.0;
+        if (tau == 0.0) continue;
+
+        for (int cc = c + 1; cc < q; cc++) {
+            double s = 0.0;
+            for (int i = 0; i < len; i++) s += v[i] * M(c + i, cc);
+            for (int i = 0; i < len; i++) M(c + i, cc) -= tau * s * v[i];
+        }
+        for (int r = 0; r < nn; r++) {
+            double s = 0.0;
+            for (int i = 0; i < len; i++) s += Q(r, c + i) * v[i];
+            for (int i = 0; i < len; i++) Q(r, c + i) -= tau * s * v[i];
+        }
+    }
+
+    // D = Q^T * D * Q
+    Matrix QtD(nn, nn), Dn(nn, nn);
+    for (int i = 0; i < nn; i++) {
+        for (int k = 0; k < nn; k++) {
+            for (int c = 0; c < nn; c++) QtD(i, c) += Q(k, i) * D(k, c);
+        }
+    }
+    for (int i = 0; i < nn; i++) {
+        for (int k = 0; k < nn; k++) {
+            for (int c = 0; c < nn; c++) Dn(i, c) += QtD(i, k) * Q(k, c);
+        }
+    }
+
+    double lower_left = 0.0;
+    for (int i = q; i < nn; i++) {
+        for (int c = 0; c < q; c++) lower_left = std::max(lower_left, std::abs(Dn(i, c)));
+    }
+    if (lower_left > thresh) return false;
+    for (int i = q; i < nn; i++) {
+        for (int c = 0; c < q; c++) Dn(i, c) = 0.0;
+    }
+    T.set_block(j, j, Dn);
+
+    // Rows j..j+nn to the right, columns j..j+nn above, and Z
+    std::vector<double> tmp(nn);
+    for (int c = j + nn; c < n; c++) {
+        for (int i = 0; i < nn; i++) {
+            double s = 0.0;
+            for (int k = 0; k < nn; k++) s += Q(k, i) * T(j + k, c);
+            tmp[i] = s;
+        }
+        for (int i = 0; i < nn; i++) T(j + i, c) = tmp[i];
+    }
+    auto right_multiply = [&](Matrix& A, int rows) {
+        for (int r = 0; r < rows; r++) {
+            double* a = &A(r, j);
+            for (int c = 0; c < nn; c++) {
+                double s = 0.0;
+                for (int k = 0; k < nn; k++) s += a[k] * Q(k, c);
+                tmp[c] = s;
+            }
+            std::copy(tmp.begin(), tmp.end(), a);
+        }
+    };
+    right_multiply(T, j);
+    if (Z != nullptr) right_multiply(*Z, Z->m);
+
+    if (q == 2) standardize_2x2(T, j, Z);
+    if (p == 2) standardize_2x2(T, j + q, Z);
+    return true;
+}
+
+// ============================================================================
+// DOUBLE-SHIFT DRIVER
+// ============================================================================
+bool hessenberg_qr_double_shift(Matrix& H, std::vector<double>& wr,
+                                std::vector<double>& wi, Matrix* Z,
+                                HessenbergQRStats* stats) {
+    bool ok = francis_qr_block(H, 0, H.n - 1, Z, stats);
+    schur_eigenvalues(H, wr, wi);
+    return ok;
+}
@@ -0,0 +1,99 @@
+#ifndef HESSENBERG_QR_H
+#define HESSENBERG_QR_H
+
+#include <vector>
+#include "../../chapter1/src/matrix_utils.h"
+
+// Real Schur decomposition of an upper Hessenberg matrix, H = Z * T * Z^T
+// Golub & Van Loan Sections 7.5 (Francis QR) and 7.5.7 (multishift)
+//
+// T is quasi-upper triangular: 1×1 blocks hold real eigenvalues and 2×2
+// blocks hold complex conjugate pairs in standard form
+//   [a b; c a] with b*c < 0,  eigenvalues a ± sqrt(-b*c) i.
+// Every solver below overwrites H with T, fills wr/wi with the eigenvalues
+// in the order they appear on the diagonal of T, and, when Z is not null,
+// multiplies Z on the right by the accumulated orthogonal transformations
+// (pass the identity to get the Schur vectors of H, or the Q of a
+// Hessenberg reduction to get those of the original matrix).
+// Returns false if the iteration fails to converge.
+
+// Iteration counts, for comparing the two solvers
+struct HessenbergQRStats {
+    int double_shift_steps = 0;  // Francis double-shift steps (small blocks and AED windows)
+    int sweeps = 0;              // multishift sweeps
+    int aed_windows = 0;         // aggressive early deflation attempts
+    int aed_deflated = 0;        // eigenvalues deflated by AED
+};
+
+// ============================================================================
+// Francis double-shift QR (Algorithm 7.5.2, LAPACK xLAHQR)
+// One 3×3 bulge is chased at a time and every reflector is applied to the
+// whole matrix: Level 2 throughout.
+// ============================================================================
+bool hessenberg_qr_double_shift(Matrix& H, std::vector<double>& wr,
+                                std::vector<double>& wi, Matrix* Z,
+                                HessenbergQRStats* stats = nullptr);
+
+// ============================================================================
+// Small-bulge multishift QR with aggressive early deflation
+// (Braman, Byers & Mathias 2002; LAPACK xLAQR0/xLAQR3/xLAQR5)
+//
+// Each sweep chases a chain of tightly packed 3×3 bulges, one per shift
+// pair. The reflectors are applied inside a window that slides down the
+// diagonal and accumulated into a small orthogonal U; the rest of H and Z
+// is then updated with GEMM.
+// Before each sweep, AED computes the Schur form of a trailing window and
+// deflates every eigenvalue whose spike entry is negligible, not only the
+// bottom one. The window's undeflated eigenvalues become the next shifts.
+// Active blocks of 75 rows or fewer fall back to double shift.
+// ============================================================================
+bool hessenberg_qr_multishift(Matrix& H, std::vector<double>& wr,
+                              std::vector<double>& wi, Matrix* Z,
+                              HessenbergQRStats* stats = nullptr);
+
+// ============================================================================
+// Dense drivers: blocked Hessenberg reduction followed by multishift QR
+// ============================================================================
+
+// A = Z * T * Z^T
+bool real_schur(const Matrix& A, Matrix& T, Matrix& Z, std::vector<double>& wr,
+                std::vector<double>& wi, int block_size);
+
+// Eigenvalues only: Q is neither formed nor accumulated
+bool nonsymmetric_eigenvalues(const Matrix& A, std::vector<double>& wr,
+                              std::vector<double>& wi, int block_size);
+
+// ============================================================================
+// Building blocks (francis_qr.cpp), shared by both solvers and AED
+// ============================================================================
+
+// Eigenvalues read off the diagonal blocks of a quasi-triangular T
+void schur_eigenvalues(const Matrix& T, std::vector<double>& wr, std::vector<double>& wi);
+
+// Double-shift QR on the active block H(ilo:ihi, ilo:ihi). Transformations
+// are applied to all of H (and Z) so the result stays a Schur form.
+bool francis_qr_block(Matrix& H, int ilo, int ihi, Matrix* Z, HessenbergQRStats* stats);
+
+// Put the 2×2 block at (i, i) in standard form (LAPACK xLANV2). Returns
+// false if it splits into two real 1×1 blocks.
+bool standardize_2x2(Matrix& T, int i, Matrix* Z);
+
+// Swap the adjacent diagonal blocks T11 (p×p at j) and T22 (q×q at j+p)
+// of a Schur form (LAPACK xLAEXC). Returns false, leaving T untouched,
+// if the swap would be too inaccurate.
+bool swap_schur_blocks(Matrix& T, int j, int p, int q, Matrix* Z);
+
+// Negligible subdiagonal test of Ahues & Tisseur (used by LAPACK)
+bool negligible_subdiagonal(const Matrix& H, int k, double smlnum);
+
+// Reflector of length nr <= 3 (LAPACK xLARFG): on return x(0) = beta and
+// x(1:nr) = v(1:nr) with v(0) = 1 implicit. Returns tau.
+double householder_small(int nr, double* x);
+
+// Apply I - tau*v*v^T (v(0) = 1, nr <= 3) to rows r..r+nr-1, columns c0..c1-1
+void reflect_rows(Matrix& A, int r, int nr, const double* v, double tau, int c0, int c1);
+
+// Apply I - tau*v*v^T (v(0) = 1, nr <= 3) to columns c..c+nr-1, rows r0..r1-1
+void reflect_cols(Matrix& A, int c, int nr, const double* v, double tau, int r0, int r1);
+
+#endif // HESSENBERG_QR_H
@@ -0,0 +1,91 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include "hessenberg_qr.h"
+#include "../hessenberg/hessenberg.h"
+
+Matrix random_hessenberg(int n) {
+    Matrix H(n, n);
+    H.fill_random();
+    for (int i = 2; i < n; i++) {
+        for (int j = 0; j < i - 1; j++) H(i, j) = 0.0;
+    }
+    return H;
+}
+
+Matrix identity(int n) {
+    Matrix I(n, n);
+    for (int i = 0; i < n; i++) I(i, i) = 1.0;
+    return I;
+}
+
+void print_row(const char* label, double ms, const HessenbergQRStats& stats) {
+    std::cout << "  " << std::left << std::setw(26) << label
+              << std::right << std::setw(10) << ms << " ms"
+              << std::setw(8) << stats.double_shift_steps << " dbl"
+              << std::setw(6) << stats.sweeps << " sweeps"
+              << std::setw(6) << stats.aed_windows << " AED"
+              << std::setw(7) << stats.aed_deflated << " defl\n";
+}
+
+// Time both solvers on one random Hessenberg matrix, with and without Z
+void benchmark_size(int n) {
+    Matrix H = random_hessenberg(n);
+    Timer timer;
+    std::vector<double> wr, wi;
+
+    std::cout << "Matrix size: " << n << "×" << n << "\n";
+    std::cout << std::fixed << std::setprecision(1);
+
+    for (bool want_z : {false, true}) {
+        HessenbergQRStats s_double, s_multi;
+
+        Matrix T = H;
+        Matrix Z = identity(n);
+        timer.start();
+        hessenberg_qr_double_shift(T, wr, wi, want_z ? &Z : nullptr, &s_double);
+        double t_double = timer.elapsed_ms();
+
+        T = H;
+        Z = identity(n);
+        timer.start();
+        hessenberg_qr_multishift(T, wr, wi, want_z ? &Z : nullptr, &s_multi);
+        double t_multi = timer.elapsed_ms();
+
+        std::cout << (want_z ? " Schur form + vectors\n" : " Schur form only\n");
+        print_row("Double shift:", t_double, s_double);
+        print_row("Multishift + AED:", t_multi, s_multi);
+        std::cout << "  " << std::left << std::setw(26) << "Speedup:"
+                  << std::right << std::setw(10) << std::setprecision(2)
+                  << t_double / t_multi << "x\n" << std::setprecision(1);
+    }
+    std::cout << "\n";
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "================================================================\n";
+    std::cout << "HESSENBERG QR EIGENVALUE BENCHMARK\n";
+    std::cout << "Francis double shift vs small-bulge multishift + AED\n";
+    std::cout << "================================================================\n\n";
+
+    std::vector<int> sizes = {200, 400, 800};
+
+    // Usage: ./hessenberg_qr_bench [n]
+    if (argc > 1) sizes = {atoi(argv[1])};
+
+    for (int n : sizes) {
+        benchmark_size(n);
+    }
+
+    std::cout << "What to look for:\n";
+    std::cout << "  • dbl = double-shift steps, each a Level 2 pass over H;\n";
+    std::cout << "    the multishift solver only takes them inside AED windows\n";
+    std::cout << "    and on the last small blocks\n";
+    std::cout << "  • AED deflates most eigenvalues, so few full sweeps are needed\n";
+    std::cout << "  • The gap grows with n and is largest when Z is accumulated,\n";
+    std::cout << "    where nearly all multishift flops are GEMM\n";
+    std::cout << "Usage: " << argv[0] << " [n]\n";
+
+    return 0;
+}
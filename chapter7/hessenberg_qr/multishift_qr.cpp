@@ -0,0 +1,431 @@
+#include "hessenberg_qr.h"
+#include "../hessenberg/hessenberg.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+static const double kUlp = std::numeric_limits<double>::epsilon();
+static const double kSafeMin = std::numeric_limits<double>::min();
+
+// Active blocks this small go to the double-shift solver (LAPACK NMIN)
+static const int kSmallBlock = 75;
+// Skip the sweep when AED deflates more than this percentage of its window
+static const int kNibble = 14;
+// Exceptional shifts after this many AED windows without a deflation
+static const int kExceptional = 6;
+// Block size handed to gemm_blocked for the off-window updates
+static const int kGemmBlock = 64;
+
+static Matrix identity(int n) {
+    Matrix I(n, n);
+    for (int i = 0; i < n; i++) I(i, i) = 1.0;
+    return I;
+}
+
+// A(r0:r0+rows, c0:c0+U.m) = A(r0:r0+rows, c0:c0+U.m) * U
+static void update_right(Matrix& A, int r0, int rows, int c0, const Matrix& U) {
+    if (rows <= 0) return;
+    Matrix B = A.block(r0, c0, rows, U.m);
+    Matrix C(rows, U.n);
+    gemm_blocked(B, U, C, kGemmBlock);
+    A.set_block(r0, c0, C);
+}
+
+// A(r0:r0+Ut.m, c0:c0+cols) = Ut * A(r0:r0+Ut.m, c0:c0+cols)
+static void update_left(Matrix& A, int r0, int c0, int cols, const Matrix& Ut) {
+    if (cols <= 0) return;
+    Matrix B = A.block(r0, c0, Ut.n, cols);
+    Matrix C(Ut.m, cols);
+    gemm_blocked(Ut, B, C, kGemmBlock);
+    A.set_block(r0, c0, C);
+}
+
+// Recommended number of shifts for an active block of nh rows (LAPACK IPARMQ)
+static int recommended_shifts(int nh) {
+    int ns;
+    if (nh < 30) ns = 2;
+    else if (nh < 60) ns = 4;
+    else if (nh < 150) ns = 10;
+    else if (nh < 590) ns = std::max(10, nh / static_cast<int>(std::lround(std::log2(nh))));
+    else if (nh < 3000) ns = 64;
+    else if (nh < 6000) ns = 128;
+    else ns = 256;
+    return std::max(2, ns - ns % 2);
+}
+
+// ============================================================================
+// AGGRESSIVE EARLY DEFLATION (LAPACK xLAQR3)
+//
+// With the trailing nw×nw window W of the active block and the spike
+// s = H(kwtop, kwtop-1):
+//   1. W = V * T * V^T (Schur form, double shift)
+//   2. the spike becomes s * V(0, :); an eigenvalue of T whose spike
+//      entries are negligible is deflated, otherwise its block is moved
+//      to the top of T by Schur swaps and the next one is checked
+//   3. the ns undeflated eigenvalues are returned as shifts; the spike is
+//      reflected onto e1 and T(0:ns, 0:ns) reduced back to Hessenberg form
+//   4. the window's transformation V is applied to the rest of H and Z
+//      with GEMM
+// Returns the number of deflated eigenvalues (the bottom nd of the window).
+// ============================================================================
+static int aggressive_early_deflation(Matrix& H, Matrix* Z, int ktop, int kbot, int nw,
+                                      std::vector<double>& sr, std::vector<double>& si,
+                                      HessenbergQRStats* stats) {
+    const int n = H.n;
+    nw = std::min(nw, kbot - ktop + 1);
+    const int kwtop = kbot - nw + 1;
+    const double s = (kwtop == ktop) ? 0.0 : H(kwtop, kwtop - 1);
+    const double smlnum = kSafeMin * (n / kUlp);
+    sr.clear();
+    si.clear();
+
+    Matrix T = H.block(kwtop, kwtop, nw, nw);
+    Matrix V = identity(nw);
+    if (!francis_qr_block(T, 0, nw - 1, &V, stats)) return 0;
+
+    // Deflation checks from the bottom; undeflatable blocks move to the top
+    int ns = nw;
+    int ilst = 0;
+    while (ilst < ns) {
+        const bool pair = ns > 1 && T(ns - 1, ns - 2) != 0.0;
+        const int nb = pair ? 2 : 1;
+        const int ifst = ns - nb;
+
+        double foo = std::abs(T(ns - 1, ns - 1));
+        if (pair) foo += std::sqrt(std::abs(T(ns - 1, ns - 2))) *
+                         std::sqrt(std::abs(T(ns - 2, ns - 1)));
+        if (foo == 0.0) foo = std::abs(s);
+        double spike = std::abs(s * V(0, ns - 1));
+        if (pair) spike = std::max(spike, std::abs(s * V(0, ns - 2)));
+
+        if (spike <= std::max(smlnum, kUlp * foo)) {
+            ns -= nb;
+            continue;
+        }
+
+        // Move the block from ifst up to ilst, one adjacent swap at a time
+        int here = ifst;
+        bool moved = true;
+        while (here > ilst) {
+            const int pb = (here >= 2 && T(here - 1, here - 2) != 0.0) ? 2 : 1;
+            if (!swap_schur_blocks(T, here - pb, pb, nb, &V)) {
+                moved = false;
+                break;
+            }
+            here -= pb;
+            if (nb == 2 && T(here + 1, here) == 0.0) {
+                // The pair split into two reals; stop reordering here
+                moved = false;
+                break;
+            }
+        }
+        if (!moved) break;
+        ilst += nb;
+    }
+    const int nd = nw - ns;
+
+    // Undeflated eigenvalues become the shifts for the next sweep
+    if (ns > 0) {
+        Matrix Tns = T.block(0, 0, ns, ns);
+        schur_eigenvalues(Tns, sr, si);
+    }
+
+    if (s != 0.0) {
+        if (ns == 0) {
+            H(kwtop, kwtop - 1) = 0.0;
+        } else if (ns == 1) {
+            H(kwtop, kwtop - 1) = s * V(0, 0);
+        } else {
+            // Reflect the spike s * V(0, 0:ns) onto beta * e1
+            std::vector<double> v(ns);
+            for (int i = 0; i < ns; i++) v[i] = s * V(0, i);
+            double xnorm = 0.0;
+            for (int i = 1; i < ns; i++) xnorm = std::hypot(xnorm, v[i]);
+            double beta = v[0];
+            double tau = 0.0;
+            if (xnorm != 0.0) {
+                beta = -std::copysign(std::hypot(v[0], xnorm), v[0]);
+                double scale = 1.0 / (v[0] - beta);
+                for (int i = 1; i < ns; i++) v[i] *= scale;
+                tau = (beta - v[0]) / beta;
+            }
+            v[0] = 1.0;
+
+            if (tau != 0.0) {
+                // T(0:ns, :) = P * T(0:ns, :)
+                std::vector<double> w(nw, 0.0);
+                for (int i = 0; i < ns; i++) {
+                    for (int j = 0; j < nw; j++) w[j] += v[i] * T(i, j);
+                }
+                for (int i = 0; i < ns; i++) {
+                    double tv = tau * v[i];
+                    for (int j = 0; j < nw; j++) T(i, j) -= tv * w[j];
+                }
+                // T(0:ns, 0:ns) = T(0:ns, 0:ns) * P and V(:, 0:ns) = V(:, 0:ns) * P
+                auto reflect_right = [&](Matrix& A, int rows) {
+                    for (int r = 0; r < rows; r++) {
+                        double* a = &A(r, 0);
+                        double d = 0.0;
+                        for (int j = 0; j < ns; j++) d += a[j] * v[j];
+                        d *= tau;
+                        for (int j = 0; j < ns; j++) a[j] -= d * v[j];
+                    }
+                };
+                reflect_right(T, ns);
+                reflect_right(V, nw);
+
+                // Back to Hessenberg form; Q e1 = e1 keeps the spike on e1
+                Matrix R = T.block(0, 0, ns, ns);
+                std::vector<double> tau_h;
+                hessenberg_unblocked(R, tau_h);
+                Matrix Q = hessenberg_form_q(R, tau_h);
+                T.set_block(0, 0, hessenberg_extract_h(R));
+                if (ns < nw) update_left(T, 0, ns, nw - ns, Q.transpose());
+                Matrix V_top = V.block(0, 0, nw, ns);
+                Matrix VQ(nw, ns);
+                gemm_blocked(V_top, Q, VQ, kGemmBlock);
+                V.set_block(0, 0, VQ);
+            }
+            H(kwtop, kwtop - 1) = beta;
+        }
+    }
+
+    // Write the window back and apply V to the rest of H and to Z
+    H.set_block(kwtop, kwtop, T);
+    update_right(H, 0, kwtop, kwtop, V);
+    update_left(H, kwtop, kbot + 1, n - kbot - 1, V.transpose());
+    if (Z != nullptr) update_right(*Z, 0, Z->m, kwtop, V);
+
+    if (stats != nullptr) {
+        stats->aed_windows++;
+        stats->aed_deflated += nd;
+    }
+    return nd;
+}
+
+// ============================================================================
+// SMALL-BULGE MULTISHIFT SWEEP (LAPACK xLAQR5)
+//
+// Bulge b carries the shift pair (sr[2b], si[2b]), (sr[2b+1], si[2b+1]).
+// At chase step t its reflector sits at row j = ktop + t - 3b, so the
+// bulges follow each other three rows apart; within a step the lowest
+// bulge moves first so the ones above never see its fill-in.
+//
+// Steps are grouped into chunks. A chunk only touches rows and columns
+// kw0..kw1-1 directly; its reflectors are accumulated into U, and then
+//   H(kw0:kw1, kw1:n) = U^T * H(kw0:kw1, kw1:n)
+//   H(0:kw0,  kw0:kw1) = H(0:kw0, kw0:kw1) * U
+//   Z(:,      kw0:kw1) = Z(:, kw0:kw1) * U
+// turn the bulk of the work into GEMM.
+// ============================================================================
+static void multishift_sweep(Matrix& H, Matrix* Z, int ktop, int kbot,
+                             const std::vector<double>& sr, const std::vector<double>& si) {
+    const int n = H.n;
+    const int nbulges = static_cast<int>(sr.size()) / 2;
+    if (nbulges == 0) return;
+
+    const int last_step = (kbot - 1 - ktop) + 3 * (nbulges - 1);
+    const int chunk = std::max(3 * nbulges, 12);
+
+    for (int t0 = 0; t0 <= last_step; t0 += chunk) {
+        const int t1 = std::min(t0 + chunk, last_step + 1);
+        const int top_bulge = std::min(nbulges - 1, t0 / 3);
+        const int kw0 = std::max(ktop, ktop + t0 - 3 * top_bulge - 1);
+        const int kw1 = std::min(kbot + 1, ktop + t1 - 1 + 4);
+        Matrix U = identity(kw1 - kw0);
+
+        for (int t = t0; t < t1; t++) {
+            for (int b = 0; b < nbulges; b++) {
+                const int j = ktop + t - 3 * b;
+                if (j < ktop || j > kbot - 1) continue;
+                const int nr = std::min(3, kbot - j + 1);
+
+                double v[3];
+                if (j == ktop) {
+                    // Introduce the bulge: first column of (H - s1)(H - s2)
+                    const double sr1 = sr[2 * b], si1 = si[2 * b];
+                    const double sr2 = sr[2 * b + 1], si2 = si[2 * b + 1];
+                    double h21s = H(j + 1, j);
+                    double sc = std::abs(H(j, j) - sr2) + std::abs(si2) + std::abs(h21s);
+                    if (sc == 0.0) continue;
+                    h21s /= sc;
+                    v[0] = h21s * H(j, j + 1) + (H(j, j) - sr1) * ((H(j, j) - sr2) / sc) -
+                           si1 * (si2 / sc);
+                    v[1] = h21s * (H(j, j) + H(j + 1, j + 1) - sr1 - sr2);
+                    v[2] = h21s * H(j + 2, j + 1);
+                } else {
+                    for (int r = 0; r < nr; r++) v[r] = H(j + r, j - 1);
+                }
+
+                double tau = householder_small(nr, v);
+                if (j > ktop) {
+                    H(j, j - 1) = v[0];
+                    H(j + 1, j - 1) = 0.0;
+                    if (nr == 3) H(j + 2, j - 1) = 0.0;
+                }
+                v[0] = 1.0;
+
+                reflect_rows(H, j, nr, v, tau, j, kw1);
+                reflect_cols(H, j, nr, v, tau, kw0, std::min(j + 3, kbot) + 1);
+                reflect_cols(U, j - kw0, nr, v, tau, 0, U.m);
+            }
+        }
+
+        update_left(H, kw0, kw1, n - kw1, U.transpose());
+        update_right(H, 0, kw0, kw0, U);
+        if (Z != nullptr) update_right(*Z, 0, Z->m, kw0, U);
+    }
+}
+
+// ============================================================================
+// Shift pairs for the sweep: complex conjugates stay together, real shifts
+// are paired up in order, and a leftover real shift is dropped.
+// ============================================================================
+static void pair_shifts(const std::vector<double>& sr_in, const std::vector<double>& si_in,
+                        std::vector<double>& sr, std::vector<double>& si) {
+    sr.clear();
+    si.clear();
+    std::vector<double> reals;
+    for (size_t i = 0; i < sr_in.size(); i++) {
+        if (si_in[i] == 0.0) {
+            reals.push_back(sr_in[i]);
+        } else if (si_in[i] > 0.0 && i + 1 < sr_in.size() && si_in[i + 1] == -si_in[i]) {
+            sr.push_back(sr_in[i]);
+            si.push_back(si_in[i]);
+            sr.push_back(sr_in[i + 1]);
+            si.push_back(si_in[i + 1]);
+            i++;
+        }
+    }
+    for (size_t i = 0; i + 1 < reals.size(); i += 2) {
+        sr.push_back(reals[i]);
+        si.push_back(0.0);
+        sr.push_back(reals[i + 1]);
+        si.push_back(0.0);
+    }
+}
+
+// Ad hoc shifts to break a stall (LAPACK xLAQR0)
+static void exceptional_shifts(const Matrix& H, int ktop, int kbot, int ns,
+                               std::vector<double>& sr, std::vector<double>& si) {
+    sr.clear();
+    si.clear();
+    for (int i = kbot; i >= std::max(kbot - ns + 2, ktop + 2); i -= 2) {
+        double ss = std::abs(H(i, i - 1)) + std::abs(H(i - 1, i - 2));
+        Matrix B(2, 2);
+        B(0, 0) = 0.75 * ss + H(i, i);
+        B(0, 1) = ss;
+        B(1, 0) = -0.4375 * ss;
+        B(1, 1) = B(0, 0);
+        std::vector<double> wr, wi;
+        schur_eigenvalues(B, wr, wi);
+        sr.insert(sr.end(), wr.begin(), wr.end());
+        si.insert(si.end(), wi.begin(), wi.end());
+    }
+}
+
+// ============================================================================
+// MULTISHIFT DRIVER (LAPACK xLAQR0)
+//
+// while eigenvalues remain (active block ktop..kbot):
+//     small block  -> double shift, done with it
+//     AED on the trailing window, kbot -= deflated
+//     if AED deflated little: multishift sweep with its leftover shifts
+//     zero any subdiagonal the sweep made negligible
+// ============================================================================
+bool hessenberg_qr_multishift(Matrix& H, std::vector<double>& wr,
+                              std::vector<double>& wi, Matrix* Z,
+                              HessenbergQRStats* stats) {
+    const int n = H.n;
+    if (n <= kSmallBlock) return hessenberg_qr_double_shift(H, wr, wi, Z, stats);
+
+    const double smlnum = kSafeMin * (n / kUlp);
+    const int itmax = 30 * std::max(10, n);
+    std::vector<double> aed_sr, aed_si, sr, si;
+    int kbot = n - 1;
+    int ndfl = 1;
+
+    for (int it = 0; kbot >= 0; it++) {
+        if (it > itmax) return false;
+
+        int ktop = kbot;
+        while (ktop > 0 && H(ktop, ktop - 1) != 0.0) ktop--;
+        const int nh = kbot - ktop + 1;
+
+        if (nh <= kSmallBlock) {
+            if (!francis_qr_block(H, ktop, kbot, Z, stats)) return false;
+            kbot = ktop - 1;
+            ndfl = 1;
+            continue;
+        }
+
+        // Window size: grows when AED keeps coming up empty
+        const int ns_rec = recommended_shifts(nh);
+        int nw = (nh <= 500) ? ns_rec : 3 * ns_rec / 2;
+        if (ndfl >= 5) nw = std::min(2 * nw, nh / 3);
+        nw = std::max(nw, 2);
+
+        const int nd = aggressive_early_deflation(H, Z, ktop, kbot, nw, aed_sr, aed_si, stats);
+        kbot -= nd;
+        ndfl = (nd > 0) ? 1 : ndfl + 1;
+
+        if (nd > 0 && 100 * nd > kNibble * nw) continue;
+        if (kbot - ktop + 1 <= kSmallBlock) continue;
+
+        // Shifts: the AED window's undeflated eigenvalues nearest the bottom
+        const int ns = std::min(ns_rec, kbot - ktop - 1) & ~1;
+        if (ndfl % kExceptional == 0) {
+            exceptional_shifts(H, ktop, kbot, ns, sr, si);
+        } else if (aed_sr.size() >= 2) {
+            size_t start = aed_sr.size() > static_cast<size_t>(ns) ? aed_sr.size() - ns : 0;
+            if (start > 0 && aed_si[start] < 0.0) start++;
+            std::vector<double> tail_r(aed_sr.begin() + start, aed_sr.end());
+            std::vector<double> tail_i(aed_si.begin() + start, aed_si.end());
+            pair_shifts(tail_r, tail_i, sr, si);
+        } else {
+            Matrix B = H.block(kbot - ns + 1, kbot - ns + 1, ns, ns);
+            std::vector<double> br, bi;
+            if (francis_qr_block(B, 0, ns - 1, nullptr, nullptr)) {
+                schur_eigenvalues(B, br, bi);
+                pair_shifts(br, bi, sr, si);
+            } else {
+                exceptional_shifts(H, ktop, kbot, ns, sr, si);
+            }
+        }
+        if (sr.empty()) exceptional_shifts(H, ktop, kbot, ns, sr, si);
+
+        multishift_sweep(H, Z, ktop, kbot, sr, si);
+        if (stats != nullptr) stats->sweeps++;
+
+        // Vigilant deflation: the sweep may have made subdiagonals negligible
+        for (int k = ktop + 1; k <= kbot; k++) {
+            if (negligible_subdiagonal(H, k, smlnum)) H(k, k - 1) = 0.0;
+        }
+    }
+
+    schur_eigenvalues(H, wr, wi);
+    return true;
+}
+
+// ============================================================================
+// DENSE DRIVERS
+// ============================================================================
+bool real_schur(const Matrix& A, Matrix& T, Matrix& Z, std::vector<double>& wr,
+                std::vector<double>& wi, int block_size) {
+    Matrix R = A;
+    std::vector<double> tau;
+    hessenberg_blocked(R, tau, block_size);
+    Z = hessenberg_form_q(R, tau);
+    T = hessenberg_extract_h(R);
+    return hessenberg_qr_multishift(T, wr, wi, &Z);
+}
+
+bool nonsymmetric_eigenvalues(const Matrix& A, std::vector<double>& wr,
+                              std::vector<double>& wi, int block_size) {
+    Matrix R = A;
+    std::vector<double> tau;
+    hessenberg_blocked(R, tau, block_size);
+    Matrix T = hessenberg_extract_h(R);
+    return hessenberg_qr_multishift(T, wr, wi, nullptr);
+}
@@ -0,0 +1,340 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <algorithm>
+#include <complex>
+#include "hessenberg_qr.h"
+#include "../hessenberg/hessenberg.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+
+typedef bool (*SchurSolver)(Matrix&, std::vector<double>&, std::vector<double>&,
+                            Matrix*, HessenbergQRStats*);
+
+Matrix identity(int n) {
+    Matrix I(n, n);
+    for (int i = 0; i < n; i++) I(i, i) = 1.0;
+    return I;
+}
+
+Matrix random_hessenberg(int n) {
+    Matrix H(n, n);
+    H.fill_random();
+    for (int i = 2; i < n; i++) {
+        for (int j = 0; j < i - 1; j++) H(i, j) = 0.0;
+    }
+    return H;
+}
+
+double max_abs(const Matrix& A) {
+    double m = 0.0;
+    for (double x : A.data) m = std::max(m, std::abs(x));
+    return m;
+}
+
+// ||Z*T*Z^T - A||_max
+double schur_residual(const Matrix& A, const Matrix& T, const Matrix& Z) {
+    const int n = A.n;
+    Matrix ZT(n, n), ZTZt(n, n);
+    gemm_ikj(Z, T, ZT);
+    gemm_ikj(ZT, Z.transpose(), ZTZt);
+    double max_diff = 0.0;
+    for (size_t i = 0; i < A.data.size(); i++) {
+        max_diff = std::max(max_diff, std::abs(ZTZt.data[i] - A.data[i]));
+    }
+    return max_diff;
+}
+
+// Quasi-triangular with 2×2 blocks in standard form holding complex pairs
+bool is_real_schur_form(const Matrix& T) {
+    const int n = T.n;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < i - 1; j++) {
+            if (T(i, j) != 0.0) return false;
+        }
+    }
+    for (int i = 0; i + 1 < n; i++) {
+        if (T(i + 1, i) == 0.0) continue;
+        if (i + 2 < n && T(i + 2, i + 1) != 0.0) return false;
+        if (T(i, i) != T(i + 1, i + 1)) return false;
+        if (T(i, i + 1) * T(i + 1, i) >= 0.0) return false;
+        i++;
+    }
+    return true;
+}
+
+std::vector<std::complex<double>> sorted_eigenvalues(const std::vector<double>& wr,
+                                                     const std::vector<double>& wi) {
+    std::vector<std::complex<double>> ev;
+    for (size_t i = 0; i < wr.size(); i++) ev.emplace_back(wr[i], wi[i]);
+    std::sort(ev.begin(), ev.end(), [](const std::complex<double>& a, const std::complex<double>& b) {
+        if (a.real() != b.real()) return a.real() < b.real();
+        return a.imag() < b.imag();
+    });
+    return ev;
+}
+
+// Greedy matching distance between two eigenvalue sets
+double eigenvalue_distance(const std::vector<double>& wr1, const std::vector<double>& wi1,
+                           const std::vector<double>& wr2, const std::vector<double>& wi2) {
+    std::vector<std::complex<double>> a = sorted_eigenvalues(wr1, wi1);
+    std::vector<std::complex<double>> b = sorted_eigenvalues(wr2, wi2);
+    std::vector<bool> used(b.size(), false);
+    double worst = 0.0;
+    for (const auto& x : a) {
+        double best = 1e300;
+        size_t best_j = 0;
+        for (size_t j = 0; j < b.size(); j++) {
+            if (!used[j] && std::abs(x - b[j]) < best) {
+                best = std::abs(x - b[j]);
+                best_j = j;
+            }
+        }
+        used[best_j] = true;
+        worst = std::max(worst, best);
+    }
+    return worst;
+}
+
+bool check_solver(SchurSolver solver, const Matrix& H0, const std::string& label,
+                  HessenbergQRStats* stats = nullptr) {
+    const int n = H0.n;
+    Matrix T = H0;
+    Matrix Z = identity(n);
+    std::vector<double> wr, wi;
+    if (!solver(T, wr, wi, &Z, stats)) {
+        std::cout << "FAILED (" << label << ", no convergence)\n";
+        return false;
+    }
+
+    double tol = 1e-13 * n * std::max(1.0, max_abs(H0));
+    if (!is_real_schur_form(T)) {
+        std::cout << "FAILED (" << label << ", T not in real Schur form)\n";
+        return false;
+    }
+    if (orthogonality_error(Z) > tol || schur_residual(H0, T, Z) > tol) {
+        std::cout << "FAILED (" << label << ", Z*T*Z^T != H)\n";
+        return false;
+    }
+
+    // Eigenvalues only (no Z) must agree. Random Hessenberg matrices have
+    // some ill-conditioned eigenvalues, so a backward error of 1e-14 can
+    // move them by far more than that.
+    Matrix T2 = H0;
+    std::vector<double> wr2, wi2;
+    solver(T2, wr2, wi2, nullptr, nullptr);
+    if (eigenvalue_distance(wr, wi, wr2, wi2) > 1e-6) {
+        std::cout << "FAILED (" << label << ", eigenvalues depend on Z)\n";
+        return false;
+    }
+    return true;
+}
+
+bool test_building_blocks() {
+    std::cout << "Testing 2x2 standardization and Schur swaps... ";
+
+    // Swap every pair of adjacent blocks of a random Schur form and check
+    // that the decomposition is preserved and the eigenvalues trade places
+    for (int trial = 0; trial < 20; trial++) {
+        const int n = 12;
+        Matrix T = random_hessenberg(n);
+        Matrix Z = identity(n);
+        if (!francis_qr_block(T, 0, n - 1, &Z, nullptr)) {
+            std::cout << "FAILED (double shift did not converge)\n";
+            return false;
+        }
+        Matrix A(n, n), ZT(n, n);
+        gemm_ikj(Z, T, ZT);
+        gemm_ikj(ZT, Z.transpose(), A);
+
+        int j = 0;
+        while (j < n) {
+            const int p = (j + 1 < n && T(j + 1, j) != 0.0) ? 2 : 1;
+            if (j + p >= n) break;
+            const int q = (j + p + 1 < n && T(j + p + 1, j + p) != 0.0) ? 2 : 1;
+
+            std::vector<double> wr_before, wi_before;
+            schur_eigenvalues(T, wr_before, wi_before);
+            double moved_r = wr_before[j + p], moved_i = std::abs(wi_before[j + p]);
+
+            if (swap_schur_blocks(T, j, p, q, &Z)) {
+                std::vector<double> wr, wi;
+                schur_eigenvalues(T, wr, wi);
+                if (std::abs(wr[j] - moved_r) > 1e-10 ||
+                    std::abs(std::abs(wi[j]) - moved_i) > 1e-10) {
+                    std::cout << "FAILED (swap p=" << p << " q=" << q
+                              << " did not move the eigenvalue)\n";
+                    return false;
+                }
+                if (!is_real_schur_form(T) || schur_residual(A, T, Z) > 1e-12) {
+                    std::cout << "FAILED (swap p=" << p << " q=" << q
+                              << " broke the decomposition)\n";
+                    return false;
+                }
+            }
+            j += q;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_double_shift() {
+    std::cout << "Testing Francis double-shift QR... ";
+
+    for (int n : {1, 2, 3, 10, 60}) {
+        if (!check_solver(hessenberg_qr_double_shift, random_hessenberg(n),
+                          "n=" + std::to_string(n))) {
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_multishift() {
+    std::cout << "Testing multishift QR with AED... ";
+
+    for (int n : {50, 120, 300, 500}) {
+        Matrix H = random_hessenberg(n);
+        HessenbergQRStats stats;
+        if (!check_solver(hessenberg_qr_multishift, H, "n=" + std::to_string(n), &stats)) {
+            return false;
+        }
+        if (n > 75 && (stats.aed_windows == 0 || stats.aed_deflated == 0)) {
+            std::cout << "FAILED (n=" << n << ", AED never deflated)\n";
+            return false;
+        }
+
+        // Same spectrum as the double-shift reference (up to conditioning)
+        Matrix T1 = H, T2 = H;
+        std::vector<double> wr1, wi1, wr2, wi2;
+        hessenberg_qr_double_shift(T1, wr1, wi1, nullptr);
+        hessenberg_qr_multishift(T2, wr2, wi2, nullptr);
+        if (eigenvalue_distance(wr1, wi1, wr2, wi2) > 1e-6) {
+            std::cout << "FAILED (n=" << n << ", eigenvalues differ from double shift)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// ============================================================================
+// Known spectrum: A = Q * B * Q^T with B block upper triangular, holding
+// real eigenvalues 1..k and complex pairs a ± b i as [a b; -b a] blocks
+// ============================================================================
+bool test_known_spectrum() {
+    std::cout << "Testing dense driver on a known spectrum... ";
+
+    const int n = 200;
+    Matrix B(n, n);
+    B.fill_random();
+    std::vector<double> wr_exact, wi_exact;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < i; j++) B(i, j) = 0.0;
+        for (int j = i; j < n; j++) B(i, j) *= 0.1;
+    }
+    for (int i = 0; i < n;) {
+        if (i % 4 == 0 && i + 1 < n) {
+            double a = 0.5 * i, b = 1.0 + 0.01 * i;
+            B(i, i) = a;
+            B(i, i + 1) = b;
+            B(i + 1, i) = -b;
+            B(i + 1, i + 1) = a;
+            wr_exact.push_back(a);
+            wi_exact.push_back(b);
+            wr_exact.push_back(a);
+            wi_exact.push_back(-b);
+            i += 2;
+        } else {
+            B(i, i) = -1.0 - i;
+            wr_exact.push_back(B(i, i));
+            wi_exact.push_back(0.0);
+            i++;
+        }
+    }
+
+    Matrix Q(n, n);
+    {
+        Matrix R(n, n);
+        R.fill_random();
+        std::vector<double> tau;
+        hessenberg_blocked(R, tau, 32);
+        Q = hessenberg_form_q(R, tau);
+    }
+    Matrix QB(n, n), A(n, n);
+    gemm_ikj(Q, B, QB);
+    gemm_ikj(QB, Q.transpose(), A);
+
+    Matrix T(n, n), Z(n, n);
+    std::vector<double> wr, wi;
+    if (!real_schur(A, T, Z, wr, wi, 32)) {
+        std::cout << "FAILED (no convergence)\n";
+        return false;
+    }
+    double tol = 1e-12 * n * max_abs(A);
+    if (schur_residual(A, T, Z) > tol || orthogonality_error(Z) > 1e-12 * n) {
+        std::cout << "FAILED (A != Z*T*Z^T)\n";
+        return false;
+    }
+    if (eigenvalue_distance(wr, wi, wr_exact, wi_exact) > 1e-8) {
+        std::cout << "FAILED (eigenvalues wrong)\n";
+        return false;
+    }
+
+    std::vector<double> wr2, wi2;
+    nonsymmetric_eigenvalues(A, wr2, wi2, 32);
+    if (eigenvalue_distance(wr2, wi2, wr_exact, wi_exact) > 1e-8) {
+        std::cout << "FAILED (eigenvalues-only driver wrong)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// ============================================================================
+// Grcar matrix: -1 on the subdiagonal, 1 on the diagonal and the first three
+// superdiagonals. Highly non-normal, its eigenvalues are very sensitive, so
+// only backward stability (small Schur residual) is checked.
+// ============================================================================
+bool test_non_normal() {
+    std::cout << "Testing non-normal Grcar matrix... ";
+
+    const int n = 250;
+    Matrix G(n, n);
+    for (int i = 0; i < n; i++) {
+        if (i > 0) G(i, i - 1) = -1.0;
+        for (int j = i; j < std::min(n, i + 4); j++) G(i, j) = 1.0;
+    }
+    if (!check_solver(hessenberg_qr_multishift, G, "Grcar")) return false;
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Hessenberg QR Eigenvalue Solvers\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_building_blocks();
+    all_passed &= test_double_shift();
+    all_passed &= test_multishift();
+    all_passed &= test_known_spectrum();
+    all_passed &= test_non_normal();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,101 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include "sylvester.h"
+
+Matrix random_shifted(int n, double shift) {
+    Matrix A(n, n);
+    A.fill_random();
+    for (int i = 0; i < n; i++) A(i, i) += shift;
+    return A;
+}
+
+void print_row(const char* label, double ms, double flops) {
+    std::cout << "  " << std::left << std::setw(34) << label
+              << std::right << std::setw(10) << ms << " ms";
+    if (flops > 0) std::cout << std::setw(10) << flops / (ms * 1e6) << " GFLOPS";
+    std::cout << "\n";
+}
+
+// Time the stages of A*X + X*B = C and A*X + X*A^T = -Q at one size
+void benchmark_size(int n, int block_size) {
+    Timer timer;
+    const double shift = std::sqrt(static_cast<double>(n)) + 1.0;
+    Matrix A = random_shifted(n, shift);
+    Matrix B = random_shifted(n, shift);
+    Matrix C(n, n);
+    C.fill_random();
+
+    std::cout << "Matrix size: " << n << "×" << n << " (block_size=" << block_size << ")\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    // Schur forms (done once per coefficient matrix)
+    SchurFactor FA, FB;
+    timer.start();
+    schur_factor(A, FA, block_size);
+    schur_factor(B, FB, block_size);
+    double t_schur = timer.elapsed_ms();
+
+    // Quasi-triangular solve, unblocked vs recursive
+    Matrix Y = C;
+    timer.start();
+    sylvester_quasi_triangular_unblocked(FA.T, FB.T, Y);
+    double t_unblocked = timer.elapsed_ms();
+
+    Y = C;
+    timer.start();
+    sylvester_quasi_triangular(FA.T, FB.T, Y, block_size);
+    double t_recursive = timer.elapsed_ms();
+
+    // One more right-hand side with the cached Schur factors
+    Matrix X(n, n);
+    timer.start();
+    sylvester_solve_schur(FA, FB, C, X, block_size);
+    double t_cached = timer.elapsed_ms();
+
+    // Lyapunov with a stable A (one Schur form)
+    Matrix As = random_shifted(n, -shift);
+    timer.start();
+    lyapunov_solve(As, C, X, block_size);
+    double t_lyap = timer.elapsed_ms();
+
+    double flops = sylvester_triangular_flops(n, n);
+    print_row("Two Schur forms:", t_schur, 0);
+    print_row("Triangular solve (unblocked):", t_unblocked, flops);
+    print_row("Triangular solve (recursive):", t_recursive, flops);
+    print_row("Solve with cached Schur factors:", t_cached, 0);
+    print_row("Lyapunov from scratch:", t_lyap, 0);
+    std::cout << "  " << std::left << std::setw(34) << "Speedup (triangular):"
+              << std::right << std::setw(10) << t_unblocked / t_recursive << "x\n\n";
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "================================================================\n";
+    std::cout << "BARTELS-STEWART SYLVESTER / LYAPUNOV BENCHMARK\n";
+    std::cout << "Unblocked vs recursive blocked quasi-triangular solve\n";
+    std::cout << "================================================================\n\n";
+
+    std::vector<int> sizes = {200, 400, 800};
+    int block_size = 64;
+
+    // Usage: ./sylvester_bench [n] [block_size]
+    if (argc > 1) sizes = {atoi(argv[1])};
+    if (argc > 2) block_size = atoi(argv[2]);
+
+    for (int n : sizes) {
+        benchmark_size(n, block_size);
+    }
+
+    std::cout << "What to look for:\n";
+    std::cout << "  • The Schur forms dominate a solve from scratch; reuse them\n";
+    std::cout << "    when the coefficients stay fixed and only C changes\n";
+    std::cout << "  • The unblocked triangular solve is all contiguous row axpys and\n";
+    std::cout << "    wins while Y fits in cache; the recursive one does all but the\n";
+    std::cout << "    leaves in GEMM and pulls ahead once it does not\n";
+    std::cout << "  • A cached solve costs 4 GEMMs plus the triangular solve\n";
+    std::cout << "Usage: " << argv[0] << " [n] [block_size]\n";
+
+    return 0;
+}
@@ -0,0 +1,269 @@
+#include "sylvester.h"
+#include "../hessenberg_qr/hessenberg_qr.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Block size handed to gemm_blocked
+static const int kGemmBlock = 64;
+
+// C = A * B
+static Matrix multiply(const Matrix& A, const Matrix& B) {
+    Matrix C(A.m, B.n);
+    gemm_blocked(A, B, C, kGemmBlock);
+    return C;
+}
+
+// C(r0:r0+M.m, c0:c0+N.n) -= M * N
+static void subtract_product(Matrix& C, int r0, int c0, const Matrix& M, const Matrix& N) {
+    Matrix M_neg = M;
+    for (auto& x : M_neg.data) x = -x;
+    Matrix Cb = C.block(r0, c0, M.m, N.n);
+    gemm_blocked(M_neg, N, Cb, kGemmBlock);
+    C.set_block(r0, c0, Cb);
+}
+
+// ============================================================================
+// SMALL SYSTEM: TA(k:k+p, k:k+p) * Y + Y * TB(l:l+q, l:l+q) = R, p, q <= 2
+//
+// Written as the pq×pq Kronecker system (I ⊗ A + B^T ⊗ I) vec(Y) = vec(R)
+// and solved by Gaussian elimination with complete pivoting (xLASY2).
+// A pivot below eps*max|K| is raised to that size and false is returned.
+// R is p×q, row-major, and is overwritten by Y.
+// ============================================================================
+static bool solve_small(const Matrix& TA, int k, int p, const Matrix& TB, int l, int q,
+                        double* R) {
+    const int s = p * q;
+    double K[4][4] = {};
+    double rhs[4];
+    double kmax = 0.0;
+    for (int j = 0; j < q; j++) {
+        for (int i = 0; i < p; i++) {
+            const int row = j * p + i;
+            rhs[row] = R[i * q + j];
+            for (int ll = 0; ll < q; ll++) {
+                for (int kk = 0; kk < p; kk++) {
+                    double v = 0.0;
+                    if (ll == j) v += TA(k + i, k + kk);
+                    if (kk == i) v += TB(l + ll, l + j);
+                    K[row][ll * p + kk] = v;
+                    kmax = std::max(kmax, std::abs(v));
+                }
+            }
+        }
+    }
+    const double smin = std::max(std::numeric_limits<double>::epsilon() * kmax,
+                                 std::numeric_limits<double>::min());
+
+    bool ok = true;
+    int col_perm[4] = {0, 1, 2, 3};
+    for (int d = 0; d < s; d++) {
+        // Complete pivoting over the trailing (s-d)×(s-d) block
+        int pr = d, pc = d;
+        for (int i = d; i < s; i++) {
+            for (int j = d; j < s; j++) {
+                if (std::abs(K[i][j]) > std::abs(K[pr][pc])) {
+                    pr = i;
+                    pc = j;
+                }
+            }
+        }
+        std::swap(K[d], K[pr]);
+        std::swap(rhs[d], rhs[pr]);
+        if (pc != d) {
+            for (int i = 0; i < s; i++) std::swap(K[i][d], K[i][pc]);
+            std::swap(col_perm[d], col_perm[pc]);
+        }
+        if (std::abs(K[d][d]) < smin) {
+            K[d][d] = smin;
+            ok = false;
+        }
+        for (int i = d + 1; i < s; i++) {
+            double f = K[i][d] / K[d][d];
+            for (int j = d + 1; j < s; j++) K[i][j] -= f * K[d][j];
+            rhs[i] -= f * rhs[d];
+        }
+    }
+
+    double y[4];
+    for (int d = s - 1; d >= 0; d--) {
+        double t = rhs[d];
+        for (int j = d + 1; j < s; j++) t -= K[d][j] * y[j];
+        y[d] = t / K[d][d];
+    }
+    for (int d = 0; d < s; d++) {
+        const int u = col_perm[d];   // unknown u = ll*p + kk
+        R[(u % p) * q + u / p] = y[d];
+    }
+    return ok;
+}
+
+// ============================================================================
+// UNBLOCKED: TA(a0:a1, a0:a1) * Y + Y * TB(b0:b1, b0:b1) = C(a0:a1, b0:b1)
+//
+// Row-oriented so every update is a contiguous axpy along a row of C:
+// for each block row k of Y, bottom to top:
+//     C(k, :) -= TA(k, k+p:a1) * Y(k+p:a1, :)        (rows already solved)
+//     for each block column l, left to right:
+//         solve the small system for Y(k, l)
+//         C(k, l+q:b1) -= Y(k, l) * TB(l, l+q:b1)
+// ============================================================================
+static bool solve_unblocked(const Matrix& TA, const Matrix& TB, Matrix& C,
+                            int a0, int a1, int b0, int b1) {
+    bool ok = true;
+
+    for (int k_end = a1; k_end > a0;) {
+        int k = k_end - 1, p = 1;
+        if (k > a0 && TA(k, k - 1) != 0.0) {
+            k--;
+            p = 2;
+        }
+
+        for (int i = 0; i < p; i++) {
+            double* c_row = &C(k + i, 0);
+            const double* ta_row = &TA(k + i, 0);
+            for (int r = k + p; r < a1; r++) {
+                const double t = ta_row[r];
+                if (t == 0.0) continue;
+                const double* y_row = &C(r, 0);
+                for (int j = b0; j < b1; j++) c_row[j] -= t * y_row[j];
+            }
+        }
+
+        for (int l = b0; l < b1;) {
+            const int q = (l + 1 < b1 && TB(l + 1, l) != 0.0) ? 2 : 1;
+            double R[4];
+            for (int i = 0; i < p; i++) {
+                for (int j = 0; j < q; j++) R[i * q + j] = C(k + i, l + j);
+            }
+            ok &= solve_small(TA, k, p, TB, l, q, R);
+            for (int i = 0; i < p; i++) {
+                double* c_row = &C(k + i, 0);
+                for (int t = 0; t < q; t++) {
+                    const double y = R[i * q + t];
+                    c_row[l + t] = y;
+                    const double* tb_row = &TB(l + t, 0);
+                    for (int j = l + q; j < b1; j++) c_row[j] -= y * tb_row[j];
+                }
+            }
+            l += q;
+        }
+        k_end = k;
+    }
+    return ok;
+}
+
+bool sylvester_quasi_triangular_unblocked(const Matrix& TA, const Matrix& TB, Matrix& C) {
+    return solve_unblocked(TA, TB, C, 0, TA.n, 0, TB.n);
+}
+
+// ============================================================================
+// RECURSIVE BLOCKED
+// ============================================================================
+static bool solve_recursive(const Matrix& TA, const Matrix& TB, Matrix& C,
+                            int a0, int a1, int b0, int b1, int block_size) {
+    const int m = a1 - a0;
+    const int n = b1 - b0;
+    if (m <= block_size && n <= block_size) {
+        return solve_unblocked(TA, TB, C, a0, a1, b0, b1);
+    }
+
+    bool ok = true;
+    if (m >= n) {
+        int mid = a0 + m / 2;
+        if (TA(mid, mid - 1) != 0.0) mid++;   // keep 2×2 blocks whole
+        ok &= solve_recursive(TA, TB, C, mid, a1, b0, b1, block_size);
+        subtract_product(C, a0, b0, TA.block(a0, mid, mid - a0, a1 - mid),
+                         C.block(mid, b0, a1 - mid, n));
+        ok &= solve_recursive(TA, TB, C, a0, mid, b0, b1, block_size);
+    } else {
+        int mid = b0 + n / 2;
+        if (TB(mid, mid - 1) != 0.0) mid++;
+        ok &= solve_recursive(TA, TB, C, a0, a1, b0, mid, block_size);
+        subtract_product(C, a0, mid, C.block(a0, b0, m, mid - b0),
+                         TB.block(b0, mid, mid - b0, b1 - mid));
+        ok &= solve_recursive(TA, TB, C, a0, a1, mid, b1, block_size);
+    }
+    return ok;
+}
+
+bool sylvester_quasi_triangular(const Matrix& TA, const Matrix& TB, Matrix& C, int block_size) {
+    // A split point can move past a 2×2 block, so leaves hold at least 2
+    return solve_recursive(TA, TB, C, 0, TA.n, 0, TB.n, std::max(block_size, 2));
+}
+
+// ============================================================================
+// DRIVERS
+// ============================================================================
+bool schur_factor(const Matrix& A, SchurFactor& F, int block_size) {
+    std::vector<double> wr, wi;
+    return real_schur(A, F.T, F.Z, wr, wi, block_size);
+}
+
+bool sylvester_solve_schur(const SchurFactor& FA, const SchurFactor& FB, const Matrix& C,
+                           Matrix& X, int block_size) {
+    Matrix Y = multiply(multiply(FA.Z.transpose(), C), FB.Z);
+    bool ok = sylvester_quasi_triangular(FA.T, FB.T, Y, block_size);
+    X = multiply(multiply(FA.Z, Y), FB.Z.transpose());
+    return ok;
+}
+
+bool sylvester_solve(const Matrix& A, const Matrix& B, const Matrix& C, Matrix& X,
+                     int block_size) {
+    SchurFactor FA, FB;
+    if (!schur_factor(A, FA, block_size) || !schur_factor(B, FB, block_size)) return false;
+    return sylvester_solve_schur(FA, FB, C, X, block_size);
+}
+
+bool lyapunov_solve_schur(const SchurFactor& FA, const Matrix& Q, Matrix& X, int block_size) {
+    const int n = FA.T.n;
+    Matrix Ct = multiply(multiply(FA.Z.transpose(), Q), FA.Z);
+
+    // TB = J * TA^T * J and W = -Ct * J (reversal permutation J)
+    Matrix TB(n, n), W(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            TB(i, j) = FA.T(n - 1 - j, n - 1 - i);
+            W(i, j) = -Ct(i, n - 1 - j);
+        }
+    }
+    bool ok = sylvester_quasi_triangular(FA.T, TB, W, block_size);
+
+    // Y = W * J
+    Matrix Y(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) Y(i, j) = W(i, n - 1 - j);
+    }
+    X = multiply(multiply(FA.Z, Y), FA.Z.transpose());
+
+    bool symmetric = true;
+    for (int i = 0; i < n && symmetric; i++) {
+        for (int j = 0; j < i; j++) {
+            if (Q(i, j) != Q(j, i)) {
+                symmetric = false;
+                break;
+            }
+        }
+    }
+    if (symmetric) {
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < i; j++) {
+                double x = 0.5 * (X(i, j) + X(j, i));
+                X(i, j) = x;
+                X(j, i) = x;
+            }
+        }
+    }
+    return ok;
+}
+
+bool lyapunov_solve(const Matrix& A, const Matrix& Q, Matrix& X, int block_size) {
+    SchurFactor FA;
+    if (!schur_factor(A, FA, block_size)) return false;
+    return lyapunov_solve_schur(FA, Q, X, block_size);
+}
+
+double sylvester_triangular_flops(int m, int n) {
+    return static_cast<double>(m) * m * n + static_cast<double>(m) * n * n;
+}
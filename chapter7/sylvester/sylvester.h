@@ -0,0 +1,74 @@
+#ifndef SYLVESTER_H
+#define SYLVESTER_H
+
+#include <vector>
+#include "../../chapter1/src/matrix_utils.h"
+
+// Sylvester equation A*X + X*B = C and Lyapunov equation A*X + X*A^T = -Q
+// by the Bartels-Stewart method (Golub & Van Loan Section 7.6.3)
+//
+//   A = ZA * TA * ZA^T,  B = ZB * TB * ZB^T         (real Schur forms)
+//   TA * Y + Y * TB = ZA^T * C * ZB                  (quasi-triangular solve)
+//   X = ZA * Y * ZB^T
+//
+// The equation has a unique solution iff A and -B have no common
+// eigenvalue. Near-singular 1×1/2×2 subproblems get their pivot raised to
+// eps*||.||, and the solvers then return false (LAPACK xTRSYL info = 1).
+
+// Real Schur form of one coefficient matrix, A = Z * T * Z^T, computed once
+// and reused by every solve with that coefficient
+struct SchurFactor {
+    Matrix T{0, 0};
+    Matrix Z{0, 0};
+};
+
+// Factor A with real_schur (chapter7/hessenberg_qr). Returns false if the
+// QR iteration fails to converge.
+bool schur_factor(const Matrix& A, SchurFactor& F, int block_size);
+
+// ============================================================================
+// Quasi-triangular kernels: solve TA*Y + Y*TB = C in place (C becomes Y)
+// TA (m×m) and TB (n×n) are upper quasi-triangular; a nonzero subdiagonal
+// entry marks a 2×2 block.
+// ============================================================================
+
+// Unblocked reference (xTRSYL order, transposed for row-major storage): Y is
+// swept one block row at a time, bottom to top, and each block row left to
+// right. Each step solves a 1×1, 1×2, 2×1 or 2×2 Sylvester system (Kronecker
+// form, complete pivoting). The rows below and the columns to the left are
+// subtracted as contiguous row updates, so the inner loops vectorize.
+bool sylvester_quasi_triangular_unblocked(const Matrix& TA, const Matrix& TB, Matrix& C);
+
+// Recursive blocked solve (Jonsson & Kågström, RECSY). Split the larger
+// dimension in half (never through a 2×2 block):
+//   split TA:  solve rows 2 first, then C1 -= TA12 * Y2 (GEMM), then rows 1
+//   split TB:  solve cols 1 first, then C2 -= Y1 * TB12 (GEMM), then cols 2
+// Subproblems with both sides <= block_size go to the unblocked kernel, so
+// all but O(block_size/n) of the flops are GEMM.
+bool sylvester_quasi_triangular(const Matrix& TA, const Matrix& TB, Matrix& C, int block_size);
+
+// ============================================================================
+// Dense drivers
+// ============================================================================
+
+// A*X + X*B = C with precomputed Schur factors (4 GEMMs + triangular solve)
+bool sylvester_solve_schur(const SchurFactor& FA, const SchurFactor& FB, const Matrix& C,
+                           Matrix& X, int block_size);
+
+// A*X + X*B = C from scratch (two Schur decompositions)
+bool sylvester_solve(const Matrix& A, const Matrix& B, const Matrix& C, Matrix& X,
+                     int block_size);
+
+// A*X + X*A^T = -Q with a precomputed Schur factor of A. B = A^T reuses the
+// same Schur form: with J the reversal permutation, J*TA^T*J is again upper
+// quasi-triangular, so the equation becomes TA*W + W*(J*TA^T*J) = -ZA^T*Q*ZA*J
+// with Y = W*J. For symmetric Q the result is symmetrized.
+bool lyapunov_solve_schur(const SchurFactor& FA, const Matrix& Q, Matrix& X, int block_size);
+
+// A*X + X*A^T = -Q from scratch (one Schur decomposition)
+bool lyapunov_solve(const Matrix& A, const Matrix& Q, Matrix& X, int block_size);
+
+// Flop count of the quasi-triangular solve (m^2*n + m*n^2)
+double sylvester_triangular_flops(int m, int n);
+
+#endif // SYLVESTER_H
@@ -0,0 +1,220 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include "sylvester.h"
+#include "../hessenberg_qr/hessenberg_qr.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+
+Matrix product(const Matrix& A, const Matrix& B) {
+    Matrix C(A.m, B.n);
+    gemm_ikj(A, B, C);
+    return C;
+}
+
+double max_abs(const Matrix& A) {
+    double m = 0.0;
+    for (double x : A.data) m = std::max(m, std::abs(x));
+    return m;
+}
+
+// Random n×n matrix plus shift*I: for shift around sqrt(n), the spectra of
+// two such matrices stay well away from each other's negatives
+Matrix random_shifted(int n, double shift) {
+    Matrix A(n, n);
+    A.fill_random();
+    for (int i = 0; i < n; i++) A(i, i) += shift;
+    return A;
+}
+
+// ||A*X + X*B - C||_max
+double sylvester_residual(const Matrix& A, const Matrix& B, const Matrix& X, const Matrix& C) {
+    Matrix R = product(A, X);
+    Matrix XB = product(X, B);
+    for (size_t i = 0; i < R.data.size(); i++) R.data[i] += XB.data[i] - C.data[i];
+    return max_abs(R);
+}
+
+bool test_triangular_kernels() {
+    std::cout << "Testing quasi-triangular kernels (unblocked vs recursive)... ";
+
+    for (auto [m, n] : {std::pair{1, 1}, {2, 3}, {37, 20}, {20, 37}, {130, 90}}) {
+        // Schur forms of random matrices have 2×2 blocks
+        std::vector<double> wr, wi;
+        Matrix TA(m, m), ZA(m, m), TB(n, n), ZB(n, n);
+        real_schur(random_shifted(m, 0.0), TA, ZA, wr, wi, 16);
+        real_schur(random_shifted(n, 0.0), TB, ZB, wr, wi, 16);
+        double shift = std::sqrt(static_cast<double>(std::max(m, n))) + 1.0;
+        for (int i = 0; i < m; i++) TA(i, i) += shift;
+        for (int i = 0; i < n; i++) TB(i, i) += shift;
+
+        Matrix C(m, n);
+        C.fill_random();
+
+        Matrix Y_ref = C;
+        if (!sylvester_quasi_triangular_unblocked(TA, TB, Y_ref)) {
+            std::cout << "FAILED (" << m << "x" << n << ", reported near singular)\n";
+            return false;
+        }
+        if (sylvester_residual(TA, TB, Y_ref, C) > 1e-12 * (m + n)) {
+            std::cout << "FAILED (" << m << "x" << n << ", unblocked residual)\n";
+            return false;
+        }
+        for (int block_size : {2, 8, 32}) {
+            Matrix Y = C;
+            sylvester_quasi_triangular(TA, TB, Y, block_size);
+            if (max_abs_diff(Y, Y_ref) > 1e-12 * (m + n)) {
+                std::cout << "FAILED (" << m << "x" << n << ", block_size=" << block_size << ")\n";
+                return false;
+            }
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_sylvester() {
+    std::cout << "Testing dense Sylvester solver... ";
+
+    for (auto [m, n] : {std::pair{1, 4}, {60, 60}, {150, 80}}) {
+        double shift = std::sqrt(static_cast<double>(std::max(m, n))) + 1.0;
+        Matrix A = random_shifted(m, shift);
+        Matrix B = random_shifted(n, shift);
+        Matrix X_true(m, n);
+        X_true.fill_random();
+        Matrix C = product(A, X_true);
+        Matrix XB = product(X_true, B);
+        for (size_t i = 0; i < C.data.size(); i++) C.data[i] += XB.data[i];
+
+        Matrix X(m, n);
+        if (!sylvester_solve(A, B, C, X, 32)) {
+            std::cout << "FAILED (" << m << "x" << n << ", solver reported failure)\n";
+            return false;
+        }
+        if (max_abs_diff(X, X_true) > 1e-10) {
+            std::cout << "FAILED (" << m << "x" << n << ", X wrong)\n";
+            return false;
+        }
+        if (sylvester_residual(A, B, X, C) > 1e-12 * (m + n) * max_abs(C)) {
+            std::cout << "FAILED (" << m << "x" << n << ", residual)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_lyapunov() {
+    std::cout << "Testing Lyapunov solver... ";
+
+    for (int n : {1, 3, 50, 120}) {
+        // Stable A, symmetric positive definite Q: X is symmetric positive definite
+        Matrix A = random_shifted(n, -(std::sqrt(static_cast<double>(n)) + 1.0));
+        Matrix G(n, n);
+        G.fill_random();
+        Matrix Q = product(G, G.transpose());
+        for (int i = 0; i < n; i++) Q(i, i) += 1.0;
+
+        Matrix X(n, n);
+        if (!lyapunov_solve(A, Q, X, 16)) {
+            std::cout << "FAILED (n=" << n << ", solver reported failure)\n";
+            return false;
+        }
+        Matrix minus_Q = Q;
+        for (double& q : minus_Q.data) q = -q;
+        if (sylvester_residual(A, A.transpose(), X, minus_Q) > 1e-12 * n * max_abs(Q)) {
+            std::cout << "FAILED (n=" << n << ", residual)\n";
+            return false;
+        }
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < i; j++) {
+                if (X(i, j) != X(j, i)) {
+                    std::cout << "FAILED (n=" << n << ", X not symmetric)\n";
+                    return false;
+                }
+            }
+        }
+        for (int trial = 0; trial < 5; trial++) {
+            Matrix x(n, 1);
+            x.fill_random();
+            Matrix Xx = product(X, x);
+            double q = 0.0;
+            for (int i = 0; i < n; i++) q += x(i, 0) * Xx(i, 0);
+            if (q <= 0.0) {
+                std::cout << "FAILED (n=" << n << ", X not positive definite)\n";
+                return false;
+            }
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_reused_factors() {
+    std::cout << "Testing repeated solves with one Schur factorization... ";
+
+    const int m = 70, n = 40;
+    Matrix A = random_shifted(m, 10.0);
+    Matrix B = random_shifted(n, 10.0);
+    SchurFactor FA, FB;
+    schur_factor(A, FA, 32);
+    schur_factor(B, FB, 32);
+
+    for (int trial = 0; trial < 3; trial++) {
+        Matrix C(m, n);
+        C.fill_random();
+        Matrix X_reused(m, n), X_fresh(m, n);
+        sylvester_solve_schur(FA, FB, C, X_reused, 32);
+        sylvester_solve(A, B, C, X_fresh, 32);
+        if (max_abs_diff(X_reused, X_fresh) > 1e-12 ||
+            sylvester_residual(A, B, X_reused, C) > 1e-12 * (m + n)) {
+            std::cout << "FAILED (trial " << trial << ")\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_singular() {
+    std::cout << "Testing detection of common eigenvalues of A and -B... ";
+
+    // lambda(A) = {1, 2}, lambda(-B) = {1, -5}
+    Matrix A(2, 2), B(2, 2), C(2, 2), X(2, 2);
+    A(0, 0) = 1.0; A(1, 1) = 2.0; A(0, 1) = 0.5;
+    B(0, 0) = -1.0; B(1, 1) = 5.0;
+    C.fill_random();
+    if (sylvester_solve(A, B, C, X, 32)) {
+        std::cout << "FAILED (singular equation not reported)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Sylvester and Lyapunov Solvers\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_triangular_kernels();
+    all_passed &= test_sylvester();
+    all_passed &= test_lyapunov();
+    all_passed &= test_reused_factors();
+    all_passed &= test_singular();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
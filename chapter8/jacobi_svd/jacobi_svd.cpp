@@ -0,0 +1,248 @@
+#include "jacobi_svd.h"
+#include "../../chapter5/householder/householder.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+static const int kMaxSweeps = 30;
+static const int kQrBlock = 32;
+
+// ============================================================================
+// ROTATE ONE COLUMN PAIR
+//
+// x, y are two columns of the working matrix (stored as rows).
+//   alpha = x^T x,  beta = y^T y,  gamma = x^T y   (one fused pass)
+// If |gamma| > tol * sqrt(alpha*beta) the pair is rotated so that x^T y = 0:
+//   zeta = (beta - alpha) / (2 gamma),  t = sign(zeta) / (|zeta| + sqrt(1 + zeta^2))
+//   c = 1 / sqrt(1 + t^2),  s = c*t
+//   [x y] = [x y] * [c s; -s c]
+// The same rotation is applied to rows vx, vy of V^T when they are given.
+// ============================================================================
+static bool rotate_pair(double* x, double* y, int len, double tol,
+                        double* vx, double* vy, int vlen) {
+    double alpha = 0.0, beta = 0.0, gamma = 0.0;
+    #pragma omp simd reduction(+:alpha, beta, gamma)
+    for (int i = 0; i < len; i++) {
+        alpha += x[i] * x[i];
+        beta += y[i] * y[i];
+        gamma += x[i] * y[i];
+    }
+    if (alpha == 0.0 || beta == 0.0) return false;
+    if (std::abs(gamma) <= tol * std::sqrt(alpha) * std::sqrt(beta)) return false;
+
+    double zeta = (beta - alpha) / (2.0 * gamma);
+    double t = (std::abs(zeta) > 1e150)
+                   ? 0.5 / zeta
+                   : std::copysign(1.0, zeta) / (std::abs(zeta) + std::sqrt(1.0 + zeta * zeta));
+    double c = 1.0 / std::sqrt(1.0 + t * t);
+    double s = c * t;
+
+    #pragma omp simd
+    for (int i = 0; i < len; i++) {
+        double xi = x[i];
+        double yi = y[i];
+        x[i] = c * xi - s * yi;
+        y[i] = s * xi + c * yi;
+    }
+    if (vx != nullptr) {
+        #pragma omp simd
+        for (int i = 0; i < vlen; i++) {
+            double xi = vx[i];
+            double yi = vy[i];
+            vx[i] = c * xi - s * yi;
+            vy[i] = s * xi + c * yi;
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// ROUND-ROBIN SWEEPS
+//
+// W is k×len with one column of the matrix per row. With k padded to an
+// even p, a sweep is p-1 rounds; in each round position q plays position
+// p-1-q, then positions 1..p-1 rotate by one (position 0 stays put).
+// Every pair meets exactly once per sweep and the pairs within a round
+// are disjoint, so they are rotated in parallel. Pairs with the padding
+// index are byes.
+//
+// Stops after the first sweep that makes no rotation and returns true, or
+// returns false once kMaxSweeps sweeps have all rotated. sweeps receives
+// the number of sweeps taken.
+// ============================================================================
+static bool jacobi_sweeps(Matrix& W, Matrix* Vt, int& sweeps) {
+    const int k = W.m;
+    const int len = W.n;
+    sweeps = 0;
+    if (k < 2) return true;
+
+    const int p = k + (k & 1);
+    const double tol = std::max(len, 1) * std::numeric_limits<double>::epsilon();
+    std::vector<int> order(p);
+    std::iota(order.begin(), order.end(), 0);
+
+    while (sweeps < kMaxSweeps) {
+        sweeps++;
+        long rotations = 0;
+
+        #pragma omp parallel shared(W, Vt, order, rotations)
+        for (int round = 0; round < p - 1; round++) {
+            #pragma omp for schedule(static) reduction(+:rotations)
+            for (int q = 0; q < p / 2; q++) {
+                int i = std::min(order[q], order[p - 1 - q]);
+                int j = std::max(order[q], order[p - 1 - q]);
+                if (j >= k) continue;
+
+                double* vx = (Vt != nullptr) ? &(*Vt)(i, 0) : nullptr;
+                double* vy = (Vt != nullptr) ? &(*Vt)(j, 0) : nullptr;
+                int vlen = (Vt != nullptr) ? Vt->n : 0;
+                if (rotate_pair(&W(i, 0), &W(j, 0), len, tol, vx, vy, vlen)) {
+                    rotations++;
+                }
+            }
+
+            #pragma omp single
+            std::rotate(order.begin() + 1, order.end() - 1, order.end());
+        }
+
+        if (rotations == 0) return true;
+    }
+    return false;
+}
+
+// 2-norm of a row, scaled so that tiny or huge entries neither underflow
+// nor overflow when squared
+static double row_norm(const Matrix& W, int i) {
+    const double* x = &W(i, 0);
+    double scale = 0.0;
+    for (int j = 0; j < W.n; j++) scale = std::max(scale, std::abs(x[j]));
+    if (scale == 0.0) return 0.0;
+    double sum = 0.0;
+    for (int j = 0; j < W.n; j++) {
+        double r = x[j] / scale;
+        sum += r * r;
+    }
+    return scale * std::sqrt(sum);
+}
+
+// Row indices of W ordered by descending norm, with the norms in sigma
+static std::vector<int> sort_by_norm(const Matrix& W, std::vector<double>& sigma) {
+    const int k = W.m;
+    std::vector<double> norms(k);
+    for (int i = 0; i < k; i++) norms[i] = row_norm(W, i);
+
+    std::vector<int> idx(k);
+    std::iota(idx.begin(), idx.end(), 0);
+    std::stable_sort(idx.begin(), idx.end(),
+                     [&](int a, int b) { return norms[a] > norms[b]; });
+
+    sigma.resize(k);
+    for (int c = 0; c < k; c++) sigma[c] = norms[idx[c]];
+    return idx;
+}
+
+// ============================================================================
+// Converged W = (A*V)^T: row i of W is sigma_i * u_i. Splits W and the
+// accumulated V^T into sorted sigma, left vectors L (len×k) and right
+// vectors R (k×k).
+// ============================================================================
+static void extract_vectors(const Matrix& W, const Matrix& Vt, std::vector<double>& sigma,
+                            Matrix& L, Matrix& R) {
+    const int k = W.m;
+    const int len = W.n;
+    std::vector<int> idx = sort_by_norm(W, sigma);
+
+    L = Matrix(len, k);
+    R = Matrix(k, k);
+    for (int c = 0; c < k; c++) {
+        const int i = idx[c];
+        double inv = (sigma[c] > 0.0) ? 1.0 / sigma[c] : 0.0;
+        for (int r = 0; r < len; r++) L(r, c) = W(i, r) * inv;
+        for (int r = 0; r < k; r++) R(r, c) = Vt(i, r);
+    }
+}
+
+static Matrix identity(int n) {
+    Matrix I(n, n);
+    for (int i = 0; i < n; i++) I(i, i) = 1.0;
+    return I;
+}
+
+// Upper triangle of a householder_qr factor, n×n
+static Matrix qr_r_factor(const Matrix& QR) {
+    const int n = QR.n;
+    Matrix R(n, n);
+    for (int i = 0; i < n; i++) {
+        std::copy(&QR(i, i), &QR(i, 0) + n, &R(i, i));
+    }
+    return R;
+}
+
+// ============================================================================
+// FULL SVD (m >= n after transposing wide inputs)
+//
+// Plain:          W = A^T,  A*V = U*Sigma
+// Preconditioned: A = Q*R,  W = R holds the columns of R^T,
+//                 R^T = U1*Sigma*V1^T  =>  A = (Q*V1) * Sigma * U1^T
+// ============================================================================
+bool jacobi_svd(const Matrix& A, std::vector<double>& sigma, Matrix& U, Matrix& V,
+                bool qr_precondition, int* sweeps) {
+    if (A.m < A.n) {
+        // A^T = U' * Sigma * V'^T  =>  A = V' * Sigma * U'^T
+        return jacobi_svd(A.transpose(), sigma, V, U, qr_precondition, sweeps);
+    }
+
+    const int m = A.m;
+    const int n = A.n;
+    Matrix Vt = identity(n);
+
+    if (!qr_precondition) {
+        Matrix W = A.transpose();
+        int taken = 0;
+        bool converged = jacobi_sweeps(W, &Vt, taken);
+        extract_vectors(W, Vt, sigma, U, V);
+        if (sweeps) *sweeps = taken;
+        return converged;
+    }
+
+    Matrix QR = A;
+    std::vector<double> tau;
+    householder_qr(QR, tau, kQrBlock);
+
+    Matrix W = qr_r_factor(QR);
+    int taken = 0;
+    bool converged = jacobi_sweeps(W, &Vt, taken);
+
+    Matrix V1(n, n);
+    extract_vectors(W, Vt, sigma, V, V1);
+
+    U = Matrix(m, n);
+    U.set_block(0, 0, V1);
+    householder_qr_apply_q(QR, tau, U, false, kQrBlock);
+    if (sweeps) *sweeps = taken;
+    return converged;
+}
+
+bool jacobi_singular_values(const Matrix& A, std::vector<double>& sigma,
+                            bool qr_precondition, int* sweeps) {
+    if (A.m < A.n) {
+        return jacobi_singular_values(A.transpose(), sigma, qr_precondition, sweeps);
+    }
+
+    Matrix W(0, 0);
+    if (qr_precondition) {
+        Matrix QR = A;
+        std::vector<double> tau;
+        householder_qr(QR, tau, kQrBlock);
+        W = qr_r_factor(QR);
+    } else {
+        W = A.transpose();
+    }
+
+    int taken = 0;
+    bool converged = jacobi_sweeps(W, nullptr, taken);
+    sort_by_norm(W, sigma);
+    if (sweeps) *sweeps = taken;
+    return converged;
+}
@@ -0,0 +1,41 @@
+#ifndef JACOBI_SVD_H
+#define JACOBI_SVD_H
+
+#include <vector>
+#include "../../chapter1/src/matrix_utils.h"
+
+// One-sided Jacobi SVD, A = U * diag(sigma) * V^T
+// Golub & Van Loan Section 8.6.3 (Hestenes / one-sided Jacobi)
+//
+// Plane rotations are applied to pairs of columns until every pair is
+// numerically orthogonal; the column norms are then the singular values.
+// Unlike bidiagonalization-based SVDs, small singular values of a
+// column-graded matrix A = B*D are found to high relative accuracy.
+//
+// Parallelism: columns are paired with the round-robin (chess tournament)
+// ordering, so each round is a set of k/2 disjoint pairs that are rotated
+// concurrently with OpenMP. The working copy holds the columns of A as
+// contiguous rows, so each pair kernel is a vectorized fused pass.
+//
+// Optional QR preconditioning: A = Q*R, then Jacobi runs on the n×n R^T.
+// For tall matrices every rotation then touches n instead of m entries,
+// and R^T is closer to orthogonal columns, so fewer sweeps are needed.
+
+// ============================================================================
+// Thin SVD. For an m×n A with k = min(m, n):
+//   sigma (k)  singular values in descending order
+//   U (m×k)    left singular vectors, V (n×k) right singular vectors
+// Columns of U for exactly zero singular values are left zero.
+// Returns false if some pair was still rotated in the last allowed sweep
+// (30), e.g. with a NaN in A; the outputs then hold the unconverged
+// iterate. If sweeps is non-null it receives the number of sweeps taken;
+// after convergence the last one makes no rotations.
+// ============================================================================
+bool jacobi_svd(const Matrix& A, std::vector<double>& sigma, Matrix& U, Matrix& V,
+                bool qr_precondition, int* sweeps = nullptr);
+
+// Singular values only: no rotations are accumulated and Q is never formed
+bool jacobi_singular_values(const Matrix& A, std::vector<double>& sigma,
+                            bool qr_precondition, int* sweeps = nullptr);
+
+#endif // JACOBI_SVD_H
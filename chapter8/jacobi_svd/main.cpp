@@ -0,0 +1,81 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include "jacobi_svd.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Time the SVD of one m×n matrix, with and without QR preconditioning
+void benchmark_shape(int m, int n) {
+    Matrix A(m, n);
+    A.fill_random();
+    Timer timer;
+
+    std::cout << "Matrix size: " << m << "×" << n << "\n";
+    std::cout << std::fixed << std::setprecision(3);
+
+    for (bool precondition : {false, true}) {
+        std::vector<double> sigma;
+        Matrix U(0, 0), V(0, 0);
+
+        timer.start();
+        int sweeps_values = 0;
+        jacobi_singular_values(A, sigma, precondition, &sweeps_values);
+        double t_values = timer.elapsed_ms();
+
+        timer.start();
+        int sweeps_full = 0;
+        jacobi_svd(A, sigma, U, V, precondition, &sweeps_full);
+        double t_full = timer.elapsed_ms();
+
+        const char* label = precondition ? "QR preconditioned" : "plain";
+        std::cout << "  " << std::left << std::setw(20) << label
+                  << std::setw(16) << "values only:" << std::right
+                  << std::setw(10) << t_values << " ms"
+                  << std::setw(4) << sweeps_values << " sweeps\n";
+        std::cout << "  " << std::left << std::setw(20) << ""
+                  << std::setw(16) << "U, sigma, V:" << std::right
+                  << std::setw(10) << t_full << " ms"
+                  << std::setw(4) << sweeps_full << " sweeps\n";
+    }
+    std::cout << "\n";
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "================================================================\n";
+    std::cout << "ONE-SIDED JACOBI SVD BENCHMARK\n";
+    std::cout << "Round-robin parallel sweeps, optional QR preconditioning\n";
+    std::cout << "================================================================\n";
+#ifdef _OPENMP
+    std::cout << "Threads: " << omp_get_max_threads() << "\n\n";
+#else
+    std::cout << "Threads: 1 (compiled without -fopenmp)\n\n";
+#endif
+
+    std::vector<std::pair<int, int>> shapes = {
+        {200, 200}, {400, 400}, {800, 800}, {2000, 200}, {4000, 400}};
+
+    // Usage: ./jacobi_svd_bench [m] [n]
+    if (argc > 1) {
+        int m = atoi(argv[1]);
+        int n = (argc > 2) ? atoi(argv[2]) : m;
+        shapes = {{m, n}};
+    }
+
+    for (auto& s : shapes) {
+        benchmark_shape(s.first, s.second);
+    }
+
+    std::cout << "What to look for:\n";
+    std::cout << "  • A sweep costs up to 6 m n^2 flops, plus 3 n^3 to accumulate V\n";
+    std::cout << "  • QR preconditioning wins big on tall matrices: rotations act on\n";
+    std::cout << "    n-vectors instead of m-vectors, often with fewer sweeps\n";
+    std::cout << "  • Scaling with OMP_NUM_THREADS: each round rotates k/2 disjoint\n";
+    std::cout << "    column pairs concurrently\n";
+    std::cout << "Usage: " << argv[0] << " [m] [n]\n";
+
+    return 0;
+}
@@ -0,0 +1,268 @@
+#include <iostream>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <algorithm>
+#include "jacobi_svd.h"
+#include "../../chapter5/householder/householder.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+
+// ||A*V - U*diag(sigma)||_max
+double svd_residual(const Matrix& A, const std::vector<double>& sigma,
+                    const Matrix& U, const Matrix& V) {
+    Matrix AV(A.m, V.n);
+    gemm_ikj(A, V, AV);
+    double max_diff = 0.0;
+    for (int i = 0; i < U.m; i++) {
+        for (int j = 0; j < U.n; j++) {
+            max_diff = std::max(max_diff, std::abs(AV(i, j) - sigma[j] * U(i, j)));
+        }
+    }
+    return max_diff;
+}
+
+// m×n matrix with orthonormal columns: the thin Q of a random matrix
+Matrix random_orthonormal(int m, int n) {
+    Matrix QR(m, n);
+    QR.fill_random();
+    std::vector<double> tau;
+    householder_qr(QR, tau, 8);
+
+    Matrix Q(m, n);
+    for (int i = 0; i < n; i++) Q(i, i) = 1.0;
+    householder_qr_apply_q(QR, tau, Q, false, 8);
+    return Q;
+}
+
+bool test_householder_qr() {
+    std::cout << "Testing blocked Householder QR... ";
+
+    for (int m : {1, 7, 60, 130}) {
+        for (int n : {1, 5, 60}) {
+            if (n > m) continue;
+            Matrix A(m, n);
+            A.fill_random();
+
+            Matrix QR = A;
+            std::vector<double> tau;
+            householder_qr(QR, tau, 16);
+
+            // Q*R with Q applied to R padded to m rows
+            Matrix QtimesR(m, n);
+            for (int i = 0; i < n; i++) {
+                for (int j = i; j < n; j++) QtimesR(i, j) = QR(i, j);
+            }
+            householder_qr_apply_q(QR, tau, QtimesR, false, 16);
+
+            double max_diff = 0.0;
+            for (size_t i = 0; i < A.data.size(); i++) {
+                max_diff = std::max(max_diff, std::abs(QtimesR.data[i] - A.data[i]));
+            }
+
+            // Q^T undoes Q
+            Matrix C = QtimesR;
+            householder_qr_apply_q(QR, tau, C, true, 16);
+            double round_trip = 0.0;
+            for (int i = 0; i < m; i++) {
+                for (int j = 0; j < n; j++) {
+                    double expected = (i <= j) ? QR(i, j) : 0.0;
+                    round_trip = std::max(round_trip, std::abs(C(i, j) - expected));
+                }
+            }
+
+            double tol = 1e-12 * m;
+            if (max_diff > tol || round_trip > tol) {
+                std::cout << "FAILED (m=" << m << ", n=" << n << ")\n";
+                return false;
+            }
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool check_svd(const Matrix& A, bool qr_precondition, const std::string& label) {
+    const int k = std::min(A.m, A.n);
+    std::vector<double> sigma;
+    Matrix U(0, 0), V(0, 0);
+    if (!jacobi_svd(A, sigma, U, V, qr_precondition)) {
+        std::cout << "FAILED (" << label << ", reported no convergence)\n";
+        return false;
+    }
+
+    if (static_cast<int>(sigma.size()) != k || U.m != A.m || U.n != k ||
+        V.m != A.n || V.n != k) {
+        std::cout << "FAILED (" << label << ", wrong output shape)\n";
+        return false;
+    }
+    for (int i = 1; i < k; i++) {
+        if (sigma[i] > sigma[i - 1]) {
+            std::cout << "FAILED (" << label << ", sigma not sorted)\n";
+            return false;
+        }
+    }
+
+    double tol = 1e-12 * std::max(A.m, A.n);
+    if (svd_residual(A, sigma, U, V) > tol) {
+        std::cout << "FAILED (" << label << ", A*V != U*Sigma)\n";
+        return false;
+    }
+    if (orthogonality_error(U) > tol || orthogonality_error(V) > tol) {
+        std::cout << "FAILED (" << label << ", singular vectors not orthonormal)\n";
+        return false;
+    }
+
+    std::vector<double> values;
+    if (!jacobi_singular_values(A, values, qr_precondition)) {
+        std::cout << "FAILED (" << label << ", values-only path reported no convergence)\n";
+        return false;
+    }
+    for (int i = 0; i < k; i++) {
+        if (std::abs(values[i] - sigma[i]) > tol) {
+            std::cout << "FAILED (" << label << ", values-only path disagrees)\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool test_jacobi_svd() {
+    std::cout << "Testing one-sided Jacobi SVD... ";
+
+    // Square, tall, wide and odd sizes (odd k exercises the round-robin bye)
+    int shapes[][2] = {{1, 1}, {2, 2}, {7, 7}, {40, 40}, {101, 101},
+                       {200, 30}, {90, 33}, {25, 80}};
+    for (auto& s : shapes) {
+        for (bool precondition : {false, true}) {
+            Matrix A(s[0], s[1]);
+            A.fill_random();
+            std::string label = std::to_string(s[0]) + "x" + std::to_string(s[1]) +
+                                (precondition ? " QR" : " plain");
+            if (!check_svd(A, precondition, label)) return false;
+        }
+    }
+
+    // Rank deficient: two equal columns give an exactly zero singular value
+    {
+        Matrix A(30, 10);
+        A.fill_random();
+        for (int i = 0; i < A.m; i++) A(i, 9) = A(i, 2);
+        std::vector<double> sigma;
+        jacobi_singular_values(A, sigma, false);
+        if (sigma[9] > 1e-13 * sigma[0]) {
+            std::cout << "FAILED (rank deficient, smallest sigma " << sigma[9] << ")\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// ============================================================================
+// A = Q * C * D with orthonormal Q, D = diag(1 .. 1e-15) and C made of 2×2
+// blocks [1 0.5; 0.5 1]. The singular values are those of the 2×2 blocks
+// C_k * D_k, which have a closed form accurate to a few ulps:
+//   sigma_max^2 = (F^2 + sqrt(F^4 - 4 det^2)) / 2,  sigma_min = det / sigma_max
+// Jacobi must recover every one, including 1e-15, to high relative accuracy.
+// ============================================================================
+bool test_relative_accuracy() {
+    std::cout << "Testing high relative accuracy on a graded matrix... ";
+
+    const int m = 120, n = 40;
+    Matrix Q = random_orthonormal(m, n);
+    std::vector<double> d(n);
+    for (int j = 0; j < n; j++) d[j] = std::pow(10.0, -15.0 * j / (n - 1));
+
+    Matrix CD(n, n);
+    std::vector<double> exact;
+    for (int b = 0; b < n; b += 2) {
+        double d1 = d[b], d2 = d[b + 1];
+        CD(b, b) = d1;
+        CD(b, b + 1) = 0.5 * d2;
+        CD(b + 1, b) = 0.5 * d1;
+        CD(b + 1, b + 1) = d2;
+
+        double det = 0.75 * d1 * d2;
+        double f2 = 1.25 * (d1 * d1 + d2 * d2);
+        double smax = std::sqrt(0.5 * (f2 + std::sqrt(f2 * f2 - 4.0 * det * det)));
+        exact.push_back(smax);
+        exact.push_back(det / smax);
+    }
+    std::sort(exact.begin(), exact.end(), std::greater<double>());
+
+    Matrix A(m, n);
+    gemm_ikj(Q, CD, A);
+
+    for (bool precondition : {false, true}) {
+        std::vector<double> sigma;
+        jacobi_singular_values(A, sigma, precondition);
+        double max_rel = 0.0;
+        for (int i = 0; i < n; i++) {
+            max_rel = std::max(max_rel, std::abs(sigma[i] - exact[i]) / exact[i]);
+        }
+        if (max_rel > 1e-12) {
+            std::cout << "FAILED (" << (precondition ? "QR" : "plain")
+                      << ", max relative error " << max_rel << ")\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_convergence_flag() {
+    std::cout << "Testing non-convergence is reported... ";
+
+    // A NaN spreads to every column it is rotated with, and no pair
+    // involving it ever passes the orthogonality test
+    Matrix A(30, 12);
+    A.fill_random();
+    A(4, 5) = std::numeric_limits<double>::quiet_NaN();
+
+    for (bool precondition : {false, true}) {
+        const char* label = precondition ? "QR" : "plain";
+        std::vector<double> sigma;
+        Matrix U(0, 0), V(0, 0);
+        int sweeps = 0;
+        if (jacobi_svd(A, sigma, U, V, precondition, &sweeps)) {
+            std::cout << "FAILED (" << label << ", NaN reported as converged)\n";
+            return false;
+        }
+        if (sweeps != 30) {
+            std::cout << "FAILED (" << label << ", stopped after " << sweeps << " sweeps)\n";
+            return false;
+        }
+        if (jacobi_singular_values(A, sigma, precondition)) {
+            std::cout << "FAILED (" << label << ", values only, NaN reported as converged)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing One-Sided Jacobi SVD\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_householder_qr();
+    all_passed &= test_jacobi_svd();
+    all_passed &= test_relative_accuracy();
+    all_passed &= test_convergence_flag();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
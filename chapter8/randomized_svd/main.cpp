@@ -0,0 +1,135 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+#include "randomized_svd.h"
+#include "../jacobi_svd/jacobi_svd.h"
+#include "../../chapter5/householder/householder.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+
+// A = X * diag(s) * Y^T with s_j = 1/(j+1) and random orthonormal X, Y
+Matrix decaying_matrix(int m, int n, std::vector<double>& s) {
+    const int r = std::min(m, n);
+    s.resize(r);
+    for (int j = 0; j < r; j++) s[j] = 1.0 / (j + 1);
+
+    Matrix factors[2] = {Matrix(m, r), Matrix(n, r)};
+    for (Matrix& F : factors) {
+        Matrix QR(F.m, r);
+        QR.fill_random();
+        std::vector<double> tau;
+        householder_qr(QR, tau, 64);
+        for (int j = 0; j < r; j++) F(j, j) = 1.0;
+        householder_qr_apply_q(QR, tau, F, false, 64);
+    }
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < r; j++) factors[0](i, j) *= s[j];
+    }
+    Matrix A(m, n);
+    gemm_blocked(factors[0], factors[1].transpose(), A, 64);
+    return A;
+}
+
+// ||A - U*diag(sigma)*V^T||_F
+double approximation_error(const Matrix& A, const std::vector<double>& sigma,
+                           const Matrix& U, const Matrix& V) {
+    Matrix US = U;
+    for (int i = 0; i < US.m; i++) {
+        for (int j = 0; j < US.n; j++) US(i, j) *= sigma[j];
+    }
+    Matrix R(A.m, A.n);
+    gemm_blocked(US, V.transpose(), R, 64);
+    double e = 0.0;
+    for (size_t i = 0; i < A.data.size(); i++) e += (A.data[i] - R.data[i]) * (A.data[i] - R.data[i]);
+    return std::sqrt(e);
+}
+
+void print_row(const std::string& label, double ms, double full_ms, double ratio, int passes) {
+    std::cout << "  " << std::left << std::setw(24) << label << std::right
+              << std::setw(10) << ms << " ms"
+              << std::setw(9) << full_ms / ms << "x"
+              << std::setw(12) << ratio
+              << std::setw(8) << passes << "\n";
+}
+
+void benchmark_size(int m, int n, const std::vector<int>& ranks) {
+    std::vector<double> s;
+    Matrix A = decaying_matrix(m, n, s);
+    Timer timer;
+
+    std::string path = "/tmp/randomized_svd_bench_" + std::to_string(getpid()) + ".bin";
+    write_matrix_file(path, A);
+    MappedFileSource mapped(path);
+    InMemorySource mem(A);
+
+    std::cout << "Matrix size: " << m << "×" << n << ", sigma_j = 1/(j+1)\n";
+    std::cout << std::fixed << std::setprecision(3);
+
+    std::vector<double> sigma;
+    Matrix U(0, 0), V(0, 0);
+    timer.start();
+    jacobi_svd(A, sigma, U, V, true);
+    double full_ms = timer.elapsed_ms();
+    std::cout << "  Full jacobi_svd: " << full_ms << " ms\n";
+    std::cout << "  " << std::left << std::setw(24) << "rank / variant" << std::right
+              << std::setw(13) << "time" << std::setw(10) << "speedup"
+              << std::setw(12) << "err/optimal" << std::setw(8) << "passes" << "\n";
+
+    for (int k : ranks) {
+        double tail = 0.0;
+        for (size_t j = k; j < s.size(); j++) tail += s[j] * s[j];
+        tail = std::sqrt(tail);
+
+        struct Variant { const char* name; int q; SketchType sketch; const MatrixSource* src; };
+        const Variant variants[] = {
+            {"q=0 gaussian", 0, SketchType::Gaussian, &mem},
+            {"q=2 gaussian", 2, SketchType::Gaussian, &mem},
+            {"q=2 sparse sign", 2, SketchType::SparseSign, &mem},
+            {"q=2 gaussian, mmap", 2, SketchType::Gaussian, &mapped},
+        };
+        for (const Variant& v : variants) {
+            RandomizedSVDOptions opt;
+            opt.power_iterations = v.q;
+            opt.sketch = v.sketch;
+            RandomizedSVDStats stats;
+            timer.start();
+            randomized_svd(*v.src, k, sigma, U, V, opt, &stats);
+            double ms = timer.elapsed_ms();
+            print_row("k=" + std::to_string(k) + " " + v.name, ms, full_ms,
+                      approximation_error(A, sigma, U, V) / tail, stats.passes);
+        }
+    }
+    unlink(path.c_str());
+    std::cout << "\n";
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "================================================================\n";
+    std::cout << "RANDOMIZED SVD BENCHMARK\n";
+    std::cout << "Streaming GEMM passes vs a full one-sided Jacobi SVD\n";
+    std::cout << "================================================================\n\n";
+
+    int m = 1200, n = 600;
+    std::vector<int> ranks = {10, 25, 50, 100};
+
+    // Usage: ./randomized_svd_bench [m] [n] [k]
+    if (argc > 1) m = atoi(argv[1]);
+    if (argc > 2) n = atoi(argv[2]);
+    if (argc > 3) ranks = {atoi(argv[3])};
+
+    benchmark_size(m, n, ranks);
+
+    std::cout << "What to look for:\n";
+    std::cout << "  • err/optimal is ||A - U S V^T||_F over the Eckart-Young optimum;\n";
+    std::cout << "    q=0 is noticeably worse on this slow decay, q=2 is within a few %\n";
+    std::cout << "  • Cost is ~(4q+4) m n l flops in GEMM plus a small l×l SVD, so\n";
+    std::cout << "    the speedup over the full SVD shrinks as k grows\n";
+    std::cout << "  • The mmap source reads every pass from the page cache and\n";
+    std::cout << "    should cost about the same as the in-memory matrix\n";
+    std::cout << "Usage: " << argv[0] << " [m] [n] [k]\n";
+
+    return 0;
+}
@@ -0,0 +1,226 @@
+#include "randomized_svd.h"
+#include "../jacobi_svd/jacobi_svd.h"
+#include "../../chapter5/householder/householder.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Block size handed to gemm_blocked and householder_qr
+static const int kGemmBlock = 64;
+
+// Bytes before the first matrix entry in a matrix file (int32 m, int32 n)
+static const size_t kHeaderBytes = 2 * sizeof(int32_t);
+
+// ============================================================================
+// SOURCES
+// ============================================================================
+void InMemorySource::read_rows(int r0, int count, Matrix& block) const {
+    block = A_.block(r0, 0, count, A_.n);
+}
+
+MappedFileSource::MappedFileSource(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    struct stat st;
+    int32_t dims[2] = {0, 0};
+    if (fstat(fd, &st) != 0 || pread(fd, dims, kHeaderBytes, 0) != (ssize_t)kHeaderBytes ||
+        dims[0] < 0 || dims[1] < 0 ||
+        static_cast<size_t>(st.st_size) <
+            kHeaderBytes + sizeof(double) * static_cast<size_t>(dims[0]) * dims[1]) {
+        close(fd);
+        return;
+    }
+    map_bytes_ = static_cast<size_t>(st.st_size);
+    void* p = mmap(nullptr, map_bytes_, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);   // the mapping keeps the file open
+    if (p == MAP_FAILED) return;
+    madvise(p, map_bytes_, MADV_SEQUENTIAL);
+    map_ = p;
+    m_ = dims[0];
+    n_ = dims[1];
+    data_ = reinterpret_cast<const double*>(static_cast<const char*>(p) + kHeaderBytes);
+}
+
+MappedFileSource::~MappedFileSource() {
+    if (map_) munmap(map_, map_bytes_);
+}
+
+void MappedFileSource::read_rows(int r0, int count, Matrix& block) const {
+    if (block.m != count || block.n != n_) block = Matrix(count, n_);
+    std::memcpy(block.data.data(), data_ + static_cast<size_t>(r0) * n_,
+                sizeof(double) * static_cast<size_t>(count) * n_);
+}
+
+bool write_matrix_file(const std::string& path, const Matrix& A) {
+    FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) return false;
+    int32_t dims[2] = {A.m, A.n};
+    bool ok = std::fwrite(dims, sizeof(int32_t), 2, f) == 2 &&
+              std::fwrite(A.data.data(), sizeof(double), A.data.size(), f) == A.data.size();
+    return std::fclose(f) == 0 && ok;
+}
+
+// ============================================================================
+// PASSES OVER A
+// Each pass reads block_rows rows at a time; only one block is resident.
+// ============================================================================
+
+// Sparse sign test matrix: row j of Omega has `nnz` entries of ±1 in
+// distinct columns cols[j*nnz .. j*nnz+nnz-1]
+struct SparseSign {
+    int nnz = 0;
+    std::vector<int> cols;
+    std::vector<double> signs;
+};
+
+static SparseSign sparse_sign_matrix(int n, int l, int nnz, std::mt19937& gen) {
+    SparseSign S;
+    S.nnz = std::min(nnz, l);
+    S.cols.resize(static_cast<size_t>(n) * S.nnz);
+    S.signs.resize(S.cols.size());
+    std::vector<int> perm(l);
+    for (int c = 0; c < l; c++) perm[c] = c;
+    std::bernoulli_distribution coin(0.5);
+    for (int j = 0; j < n; j++) {
+        // Partial Fisher-Yates: first nnz entries of a random permutation
+        for (int t = 0; t < S.nnz; t++) {
+            std::uniform_int_distribution<int> pick(t, l - 1);
+            std::swap(perm[t], perm[pick(gen)]);
+            S.cols[j * S.nnz + t] = perm[t];
+            S.signs[j * S.nnz + t] = coin(gen) ? 1.0 : -1.0;
+        }
+    }
+    return S;
+}
+
+// Y (m×l) = A * Omega with a sparse sign Omega: each entry of A is
+// scattered into nnz columns of its row of Y, O(nnz(Omega) * m) work
+static void sketch_sparse(const MatrixSource& A, const SparseSign& S, Matrix& Y,
+                          int block_rows) {
+    const int m = A.rows();
+    const int n = A.cols();
+    Matrix blk(0, 0);
+    for (int r0 = 0; r0 < m; r0 += block_rows) {
+        const int b = std::min(block_rows, m - r0);
+        A.read_rows(r0, b, blk);
+        for (int i = 0; i < b; i++) {
+            const double* a_row = &blk(i, 0);
+            double* y_row = &Y(r0 + i, 0);
+            for (int j = 0; j < n; j++) {
+                const double a = a_row[j];
+                const int* cols = &S.cols[j * S.nnz];
+                const double* signs = &S.signs[j * S.nnz];
+                for (int t = 0; t < S.nnz; t++) y_row[cols[t]] += signs[t] * a;
+            }
+        }
+    }
+}
+
+// Y (m×l) = A * W, W is n×l
+static void multiply_right(const MatrixSource& A, const Matrix& W, Matrix& Y, int block_rows,
+                           RandomizedSVDStats* stats) {
+    const int m = A.rows();
+    Y = Matrix(m, W.n);
+    Matrix blk(0, 0);
+    for (int r0 = 0; r0 < m; r0 += block_rows) {
+        const int b = std::min(block_rows, m - r0);
+        A.read_rows(r0, b, blk);
+        Matrix Yb(b, W.n);
+        gemm_blocked(blk, W, Yb, kGemmBlock);
+        Y.set_block(r0, 0, Yb);
+        if (stats) stats->gemms++;
+    }
+}
+
+// Z (n×l) = A^T * Q = sum over row blocks of A_b^T * Q_b
+static void multiply_transpose(const MatrixSource& A, const Matrix& Q, Matrix& Z,
+                               int block_rows, RandomizedSVDStats* stats) {
+    const int m = A.rows();
+    Z = Matrix(A.cols(), Q.n);
+    Matrix blk(0, 0);
+    for (int r0 = 0; r0 < m; r0 += block_rows) {
+        const int b = std::min(block_rows, m - r0);
+        A.read_rows(r0, b, blk);
+        Matrix Qb = Q.block(r0, 0, b, Q.n);
+        gemm_blocked(blk.transpose(), Qb, Z, kGemmBlock);
+        if (stats) stats->gemms++;
+    }
+}
+
+// ============================================================================
+// RANGE FINDER
+// ============================================================================
+void orthonormalize_columns(Matrix& Y) {
+    std::vector<double> tau;
+    householder_qr(Y, tau, kGemmBlock);
+    Matrix Q(Y.m, Y.n);
+    for (int j = 0; j < Y.n; j++) Q(j, j) = 1.0;
+    householder_qr_apply_q(Y, tau, Q, false, kGemmBlock);
+    Y = std::move(Q);
+}
+
+void randomized_range_finder(const MatrixSource& A, int l, Matrix& Q,
+                             const RandomizedSVDOptions& options, RandomizedSVDStats* stats) {
+    const int n = A.cols();
+    std::mt19937 gen(options.seed);
+
+    if (options.sketch == SketchType::SparseSign) {
+        SparseSign S = sparse_sign_matrix(n, l, options.sparse_nonzeros, gen);
+        Q = Matrix(A.rows(), l);
+        sketch_sparse(A, S, Q, options.block_rows);
+    } else {
+        Matrix Omega(n, l);
+        std::normal_distribution<double> normal(0.0, 1.0);
+        for (auto& x : Omega.data) x = normal(gen);
+        multiply_right(A, Omega, Q, options.block_rows, stats);
+    }
+    if (stats) stats->passes++;
+    orthonormalize_columns(Q);
+
+    // Subspace iteration, orthonormalizing after every product
+    Matrix Z(0, 0);
+    for (int it = 0; it < options.power_iterations; it++) {
+        multiply_transpose(A, Q, Z, options.block_rows, stats);
+        orthonormalize_columns(Z);
+        multiply_right(A, Z, Q, options.block_rows, stats);
+        orthonormalize_columns(Q);
+        if (stats) stats->passes += 2;
+    }
+}
+
+// ============================================================================
+// TRUNCATED SVD
+// ============================================================================
+void randomized_svd(const MatrixSource& A, int k, std::vector<double>& sigma, Matrix& U,
+                    Matrix& V, const RandomizedSVDOptions& options, RandomizedSVDStats* stats) {
+    const int m = A.rows();
+    const int n = A.cols();
+    k = std::min(k, std::min(m, n));
+    const int l = std::min(k + options.oversample, std::min(m, n));
+
+    Matrix Q(0, 0);
+    randomized_range_finder(A, l, Q, options, stats);
+
+    // B^T = A^T * Q (n×l), B = Q^T * A = Vb * Sigma * Ub^T
+    Matrix Bt(0, 0);
+    multiply_transpose(A, Q, Bt, options.block_rows, stats);
+    if (stats) stats->passes++;
+
+    std::vector<double> sb;
+    Matrix Ub(0, 0), Vb(0, 0);
+    jacobi_svd(Bt, sb, Ub, Vb, true);
+
+    // U = Q * Vb(:, 0:k), V = Ub(:, 0:k)
+    Matrix Vk = Vb.block(0, 0, Vb.m, k);
+    U = Matrix(m, k);
+    gemm_blocked(Q, Vk, U, kGemmBlock);
+    V = Ub.block(0, 0, n, k);
+    sigma.assign(sb.begin(), sb.begin() + k);
+}
@@ -0,0 +1,107 @@
+#ifndef RANDOMIZED_SVD_H
+#define RANDOMIZED_SVD_H
+
+#include <string>
+#include <vector>
+#include "../../chapter1/src/matrix_utils.h"
+
+// Randomized truncated SVD, A ≈ U * diag(sigma) * V^T with rank k
+// Halko, Martinsson & Tropp (2011), Algorithms 4.4 and 5.1
+//
+//   Y = A * Omega                    sketch, l = k + oversample columns
+//   Q = orth(Y)
+//   repeat q times:                  subspace (power) iteration
+//       Q = orth(A^T * Q),  Q = orth(A * Q)
+//   B^T = A^T * Q                    (n×l)
+//   B^T = Ub * Sigma * Vb^T          small dense SVD (jacobi_svd)
+//   U = Q * Vb,  V = Ub              truncated to k
+//
+// A is only touched through whole passes that read one block of rows at a
+// time, 2q + 2 passes in all, so it can live in a memory-mapped file larger
+// than RAM. Every product is gemm_blocked. Re-orthogonalizing after each
+// half step (Householder QR) keeps the small singular directions from being
+// swamped in floating point.
+
+// ============================================================================
+// Row-block access to A
+// ============================================================================
+class MatrixSource {
+public:
+    virtual ~MatrixSource() = default;
+    virtual int rows() const = 0;
+    virtual int cols() const = 0;
+    // block (count × cols) = A(r0 : r0+count, :)
+    virtual void read_rows(int r0, int count, Matrix& block) const = 0;
+};
+
+// A Matrix already in memory
+class InMemorySource : public MatrixSource {
+public:
+    explicit InMemorySource(const Matrix& A) : A_(A) {}
+    int rows() const override { return A_.m; }
+    int cols() const override { return A_.n; }
+    void read_rows(int r0, int count, Matrix& block) const override;
+private:
+    const Matrix& A_;
+};
+
+// A row-major matrix file written by write_matrix_file, mapped read-only
+// with mmap: pages are brought in by each pass and can be evicted after it
+class MappedFileSource : public MatrixSource {
+public:
+    explicit MappedFileSource(const std::string& path);
+    ~MappedFileSource() override;
+    MappedFileSource(const MappedFileSource&) = delete;
+    MappedFileSource& operator=(const MappedFileSource&) = delete;
+
+    bool ok() const { return data_ != nullptr; }
+    int rows() const override { return m_; }
+    int cols() const override { return n_; }
+    void read_rows(int r0, int count, Matrix& block) const override;
+private:
+    int m_ = 0, n_ = 0;
+    void* map_ = nullptr;
+    size_t map_bytes_ = 0;
+    const double* data_ = nullptr;
+};
+
+// File layout: int32 m, int32 n, then m*n doubles row by row
+bool write_matrix_file(const std::string& path, const Matrix& A);
+
+// ============================================================================
+// Options and driver
+// ============================================================================
+enum class SketchType {
+    Gaussian,     // dense N(0,1) Omega, Y = A*Omega through GEMM
+    SparseSign    // each row of Omega has a few ±1 entries: one O(nnz) pass
+};
+
+struct RandomizedSVDOptions {
+    int oversample = 10;          // l = k + oversample sketch columns
+    int power_iterations = 2;     // q
+    SketchType sketch = SketchType::Gaussian;
+    int sparse_nonzeros = 8;      // nonzeros per row of Omega for SparseSign
+    int block_rows = 256;         // rows of A read per step of a pass
+    unsigned seed = 2011;
+};
+
+struct RandomizedSVDStats {
+    int passes = 0;     // full passes over A
+    int gemms = 0;      // gemm_blocked calls on blocks of A
+};
+
+// Rank-k truncated SVD. sigma (k), U (m×k), V (n×k); k <= min(m, n).
+void randomized_svd(const MatrixSource& A, int k, std::vector<double>& sigma, Matrix& U,
+                    Matrix& V, const RandomizedSVDOptions& options = RandomizedSVDOptions(),
+                    RandomizedSVDStats* stats = nullptr);
+
+// Range finder alone: orthonormal Q (m×l) with A ≈ Q * Q^T * A
+void randomized_range_finder(const MatrixSource& A, int l, Matrix& Q,
+                             const RandomizedSVDOptions& options = RandomizedSVDOptions(),
+                             RandomizedSVDStats* stats = nullptr);
+
+// Replace the columns of Y (m×l, m >= l) by an orthonormal basis of their
+// span (Householder QR, then Q = Q * [I; 0])
+void orthonormalize_columns(Matrix& Y);
+
+#endif // RANDOMIZED_SVD_H
@@ -0,0 +1,221 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <algorithm>
+#include <unistd.h>
+#include "randomized_svd.h"
+#include "../../chapter5/householder/householder.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+
+// m×n matrix with orthonormal columns: the thin Q of a random matrix
+Matrix random_orthonormal(int m, int n) {
+    Matrix QR(m, n);
+    QR.fill_random();
+    std::vector<double> tau;
+    householder_qr(QR, tau, 8);
+
+    Matrix Q(m, n);
+    for (int i = 0; i < n; i++) Q(i, i) = 1.0;
+    householder_qr_apply_q(QR, tau, Q, false, 8);
+    return Q;
+}
+
+// A = X * diag(s) * Y^T with random orthonormal X (m×r), Y (n×r)
+Matrix matrix_with_spectrum(int m, int n, const std::vector<double>& s) {
+    const int r = static_cast<int>(s.size());
+    Matrix X = random_orthonormal(m, r);
+    Matrix Y = random_orthonormal(n, r);
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < r; j++) X(i, j) *= s[j];
+    }
+    Matrix A(m, n);
+    gemm_ikj(X, Y.transpose(), A);
+    return A;
+}
+
+// ||A - U*diag(sigma)*V^T||_F
+double approximation_error(const Matrix& A, const std::vector<double>& sigma,
+                           const Matrix& U, const Matrix& V) {
+    Matrix US = U;
+    for (int i = 0; i < US.m; i++) {
+        for (int j = 0; j < US.n; j++) US(i, j) *= sigma[j];
+    }
+    Matrix R(A.m, A.n);
+    gemm_ikj(US, V.transpose(), R);
+    double s = 0.0;
+    for (size_t i = 0; i < A.data.size(); i++) {
+        double d = A.data[i] - R.data[i];
+        s += d * d;
+    }
+    return std::sqrt(s);
+}
+
+// Optimal rank-k error (Eckart-Young): sqrt(sum_{j>=k} s_j^2)
+double tail_norm(const std::vector<double>& s, int k) {
+    double t = 0.0;
+    for (size_t j = k; j < s.size(); j++) t += s[j] * s[j];
+    return std::sqrt(t);
+}
+
+// Exactly rank r: any sketch with l >= r captures the range, so the
+// truncated SVD is exact to rounding
+bool test_exact_low_rank() {
+    std::cout << "Testing exact recovery of a low-rank matrix... ";
+
+    for (SketchType sketch : {SketchType::Gaussian, SketchType::SparseSign}) {
+        for (int q : {0, 1}) {
+            std::vector<double> s = {10.0, 7.0, 5.0, 3.0, 2.0, 1.0, 0.5, 0.1};
+            Matrix A = matrix_with_spectrum(150, 90, s);
+            InMemorySource src(A);
+
+            RandomizedSVDOptions opt;
+            opt.sketch = sketch;
+            opt.power_iterations = q;
+            opt.block_rows = 37;   // ragged last block
+            std::vector<double> sigma;
+            Matrix U(0, 0), V(0, 0);
+            randomized_svd(src, 8, sigma, U, V, opt);
+
+            double err = approximation_error(A, sigma, U, V);
+            double sv_err = 0.0;
+            for (int j = 0; j < 8; j++) sv_err = std::max(sv_err, std::abs(sigma[j] - s[j]));
+            if (err > 1e-11 || sv_err > 1e-11 || orthogonality_error(U) > 1e-12 ||
+                orthogonality_error(V) > 1e-12) {
+                std::cout << "FAILED (q=" << q << ", err=" << err << ", sv_err=" << sv_err
+                          << ")\n";
+                return false;
+            }
+        }
+    }
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Slowly decaying spectrum s_j = 1/(j+1): without power iterations the
+// tail pollutes the sketch; with q = 2 the error is close to optimal
+bool test_power_iterations() {
+    std::cout << "Testing power iterations on a decaying spectrum... ";
+
+    const int m = 300, n = 200, k = 20;
+    std::vector<double> s(n);
+    for (int j = 0; j < n; j++) s[j] = 1.0 / (j + 1);
+    Matrix A = matrix_with_spectrum(m, n, s);
+    InMemorySource src(A);
+    const double optimal = tail_norm(s, k);
+
+    double ratio[3];
+    for (int q = 0; q <= 2; q++) {
+        RandomizedSVDOptions opt;
+        opt.power_iterations = q;
+        RandomizedSVDStats stats;
+        std::vector<double> sigma;
+        Matrix U(0, 0), V(0, 0);
+        randomized_svd(src, k, sigma, U, V, opt, &stats);
+        ratio[q] = approximation_error(A, sigma, U, V) / optimal;
+
+        if (stats.passes != 2 * q + 2) {
+            std::cout << "FAILED (q=" << q << " took " << stats.passes << " passes)\n";
+            return false;
+        }
+    }
+    if (!(ratio[2] < 1.05 && ratio[2] <= ratio[0])) {
+        std::cout << "FAILED (error / optimal = " << ratio[0] << ", " << ratio[1] << ", "
+                  << ratio[2] << ")\n";
+        return false;
+    }
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// Both sketches give a near-optimal rank-k approximation of a matrix with
+// a gap, and wide matrices work as well as tall ones
+bool test_sketches_and_shapes() {
+    std::cout << "Testing Gaussian and sparse sign sketches, tall and wide... ";
+
+    for (SketchType sketch : {SketchType::Gaussian, SketchType::SparseSign}) {
+        for (auto shape : {std::make_pair(200, 80), std::make_pair(80, 200)}) {
+            const int m = shape.first, n = shape.second, k = 10;
+            std::vector<double> s(std::min(m, n));
+            for (int j = 0; j < static_cast<int>(s.size()); j++) {
+                s[j] = (j < k ? 1.0 : 1e-3) * std::pow(0.9, j);
+            }
+            Matrix A = matrix_with_spectrum(m, n, s);
+            InMemorySource src(A);
+
+            RandomizedSVDOptions opt;
+            opt.sketch = sketch;
+            opt.power_iterations = 1;
+            std::vector<double> sigma;
+            Matrix U(0, 0), V(0, 0);
+            randomized_svd(src, k, sigma, U, V, opt);
+
+            double ratio = approximation_error(A, sigma, U, V) / tail_norm(s, k);
+            if (U.m != m || U.n != k || V.m != n || V.n != k || ratio > 1.05) {
+                std::cout << "FAILED (" << m << "x" << n << ", error / optimal = " << ratio
+                          << ")\n";
+                return false;
+            }
+        }
+    }
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// A memory-mapped file gives the same factorization as the in-memory matrix
+bool test_mapped_file() {
+    std::cout << "Testing memory-mapped matrix source... ";
+
+    std::vector<double> s(40);
+    for (int j = 0; j < 40; j++) s[j] = std::pow(0.7, j);
+    Matrix A = matrix_with_spectrum(120, 70, s);
+
+    std::string path = "/tmp/randomized_svd_test_" + std::to_string(getpid()) + ".bin";
+    if (!write_matrix_file(path, A)) {
+        std::cout << "FAILED (could not write " << path << ")\n";
+        return false;
+    }
+    MappedFileSource mapped(path);
+    InMemorySource mem(A);
+    bool ok = mapped.ok() && mapped.rows() == A.m && mapped.cols() == A.n;
+
+    if (ok) {
+        RandomizedSVDOptions opt;
+        opt.block_rows = 50;
+        std::vector<double> s1, s2;
+        Matrix U1(0, 0), V1(0, 0), U2(0, 0), V2(0, 0);
+        randomized_svd(mem, 12, s1, U1, V1, opt);
+        randomized_svd(mapped, 12, s2, U2, V2, opt);
+        // Same seed, same arithmetic: identical results
+        ok = s1 == s2 && U1.data == U2.data && V1.data == V2.data;
+    }
+    unlink(path.c_str());
+
+    if (!ok) {
+        std::cout << "FAILED\n";
+        return false;
+    }
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Randomized SVD\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_exact_low_rank();
+    all_passed &= test_power_iterations();
+    all_passed &= test_sketches_and_shapes();
+    all_passed &= test_mapped_file();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
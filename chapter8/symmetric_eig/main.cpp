@@ -0,0 +1,113 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include "symmetric_eig.h"
+
+Matrix random_symmetric(int n) {
+    Matrix A(n, n);
+    A.fill_random();
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < i; j++) {
+            A(j, i) = A(i, j);
+        }
+    }
+    return A;
+}
+
+// Time each stage of the eigensolver at one size
+void benchmark_size(int n, int block_size) {
+    Matrix A = random_symmetric(n);
+    Timer timer;
+
+    std::cout << "Matrix size: " << n << "×" << n << " (block_size=" << block_size << ")\n";
+    std::cout << std::fixed << std::setprecision(3);
+
+    // Stage 1: tridiagonalization, unblocked vs blocked
+    std::vector<double> d, e, tau;
+    Matrix R = A;
+    timer.start();
+    tridiagonalize_unblocked(R, d, e, tau);
+    double t_unblocked = timer.elapsed_ms();
+
+    R = A;
+    timer.start();
+    tridiagonalize_blocked(R, d, e, tau, block_size);
+    double t_blocked = timer.elapsed_ms();
+
+    double flops = tridiagonalize_flops(n);
+    std::cout << "  " << std::left << std::setw(32) << "Tridiagonalize (unblocked):"
+              << std::right << std::setw(10) << t_unblocked << " ms"
+              << std::setw(10) << flops / (t_unblocked * 1e6) << " GFLOPS\n";
+    std::cout << "  " << std::left << std::setw(32) << "Tridiagonalize (blocked):"
+              << std::right << std::setw(10) << t_blocked << " ms"
+              << std::setw(10) << flops / (t_blocked * 1e6) << " GFLOPS\n";
+
+    // Stage 2: tridiagonal eigensolvers
+    std::vector<double> lambda;
+    timer.start();
+    tridiagonal_eigenvalues(d, e, lambda);
+    double t_ql = timer.elapsed_ms();
+
+    Matrix U(n, n);
+    timer.start();
+    tridiagonal_eig_dc(d, e, lambda, U);
+    double t_dc = timer.elapsed_ms();
+
+    // Stage 3: back-transformation
+    timer.start();
+    tridiagonal_back_transform(R, tau, U, block_size);
+    double t_back = timer.elapsed_ms();
+
+    std::cout << "  " << std::left << std::setw(32) << "Tridiagonal QL (values):"
+              << std::right << std::setw(10) << t_ql << " ms\n";
+    std::cout << "  " << std::left << std::setw(32) << "Divide-and-conquer (vectors):"
+              << std::right << std::setw(10) << t_dc << " ms\n";
+    std::cout << "  " << std::left << std::setw(32) << "Back-transformation:"
+              << std::right << std::setw(10) << t_back << " ms\n";
+
+    // End to end
+    timer.start();
+    symmetric_eigenvalues(A, lambda, block_size);
+    double t_values = timer.elapsed_ms();
+
+    Matrix Z(n, n);
+    timer.start();
+    symmetric_eig(A, lambda, Z, block_size);
+    double t_vectors = timer.elapsed_ms();
+
+    std::cout << "  " << std::left << std::setw(32) << "TOTAL eigenvalues only:"
+              << std::right << std::setw(10) << t_values << " ms\n";
+    std::cout << "  " << std::left << std::setw(32) << "TOTAL eigenvalues + vectors:"
+              << std::right << std::setw(10) << t_vectors << " ms"
+              << "  (" << std::setprecision(2) << t_vectors / t_values << "x)\n\n";
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "================================================================\n";
+    std::cout << "SYMMETRIC EIGENSOLVER BENCHMARK\n";
+    std::cout << "Tridiagonalization + divide-and-conquer + back-transformation\n";
+    std::cout << "================================================================\n\n";
+
+    int block_size = 32;
+    std::vector<int> sizes = {200, 400, 800, 1600};
+
+    // Usage: ./symmetric_eig_bench [n] [block_size]
+    if (argc > 1) sizes = {atoi(argv[1])};
+    if (argc > 2) block_size = atoi(argv[2]);
+
+    for (int n : sizes) {
+        benchmark_size(n, block_size);
+    }
+
+    std::cout << "What to look for:\n";
+    std::cout << "  • Half of the reduction flops are symmetric mat-vecs (Level 2),\n";
+    std::cout << "    so blocking helps less than for LU or QR\n";
+    std::cout << "  • The blocked reduction only pulls ahead once A outgrows the\n";
+    std::cout << "    last-level cache; try ./symmetric_eig_bench 4000\n";
+    std::cout << "  • Eigenvalues only skip D&C and the back-transformation entirely\n";
+    std::cout << "  • D&C cost depends on deflation: clustered spectra are cheaper\n";
+    std::cout << "Usage: " << argv[0] << " [n] [block_size]\n";
+
+    return 0;
+}
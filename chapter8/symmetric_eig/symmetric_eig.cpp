@@ -0,0 +1,27 @@
+#include "symmetric_eig.h"
+
+// ============================================================================
+// Eigenvalues only: reduction + implicit QL on T.
+// Q is never formed and the O(n^2) QL sweep is negligible next to the
+// 4/3 n^3 reduction.
+// ============================================================================
+bool symmetric_eigenvalues(const Matrix& A, std::vector<double>& lambda,
+                           int block_size) {
+    Matrix R = A;
+    std::vector<double> d, e, tau;
+    tridiagonalize_blocked(R, d, e, tau, block_size);
+    return tridiagonal_eigenvalues(d, e, lambda);
+}
+
+// ============================================================================
+// Full eigen-decomposition: reduction + divide-and-conquer on T + Z = Q*U.
+// ============================================================================
+bool symmetric_eig(const Matrix& A, std::vector<double>& lambda, Matrix& Z,
+                   int block_size) {
+    Matrix R = A;
+    std::vector<double> d, e, tau;
+    tridiagonalize_blocked(R, d, e, tau, block_size);
+    bool converged = tridiagonal_eig_dc(d, e, lambda, Z);
+    tridiagonal_back_transform(R, tau, Z, block_size);
+    return converged;
+}
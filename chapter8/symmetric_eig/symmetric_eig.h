@@ -0,0 +1,77 @@
+#ifndef SYMMETRIC_EIG_H
+#define SYMMETRIC_EIG_H
+
+#include <vector>
+#include "../../chapter1/src/matrix_utils.h"
+
+// Symmetric eigenvalue problem A = Z * diag(lambda) * Z^T
+// Golub & Van Loan Chapter 8
+//
+// Pipeline:
+//   1. Householder tridiagonalization  Q^T * A * Q = T       (Section 8.3.1)
+//   2. Tridiagonal eigensolver         T = U * diag(lambda) * U^T
+//        eigenvalues only:  implicit QL, O(n^2)              (Section 8.3.3)
+//        eigenvectors:      divide-and-conquer, GEMM merges  (Section 8.4.4)
+//   3. Back-transformation             Z = Q * U             (blocked, GEMM)
+//
+// Only the lower triangle of A is referenced.
+
+// ============================================================================
+// Tridiagonalization (tridiagonalize.cpp)
+//
+// On return:
+//   d (n)    diagonal of T,  e (n-1) subdiagonal of T
+//   A        Householder vectors below the subdiagonal (v(0) = 1 implicit)
+//   tau      n-1 reflector scalars,  Q = P_0 * P_1 * ... * P_{n-2}
+// ============================================================================
+
+// Unblocked reference (Algorithm 8.3.1): one symmetric rank-2 update per column
+void tridiagonalize_unblocked(Matrix& A, std::vector<double>& d,
+                              std::vector<double>& e, std::vector<double>& tau);
+
+// Blocked (LAPACK xSYTRD/xLATRD): each panel of block_size columns is
+// accumulated as A22 - V*W^T - W*V^T and applied to the lower triangle of
+// the trailing matrix with gemm_blocked. The panel's symmetric mat-vecs
+// read only the lower triangle.
+void tridiagonalize_blocked(Matrix& A, std::vector<double>& d,
+                            std::vector<double>& e, std::vector<double>& tau,
+                            int block_size);
+
+// Z = Q * Z, applying block_size reflectors at a time as I - V*T*V^T
+void tridiagonal_back_transform(const Matrix& A, const std::vector<double>& tau,
+                                Matrix& Z, int block_size);
+
+// ============================================================================
+// Tridiagonal eigensolvers (tridiagonal_eig.cpp)
+// d, e as produced above; eigenvalues are returned in ascending order.
+// Both return false if implicit QL did not converge (e.g. a NaN in T).
+// ============================================================================
+
+// Implicit QL without eigenvectors
+bool tridiagonal_eigenvalues(std::vector<double> d, std::vector<double> e,
+                             std::vector<double>& lambda);
+
+// Cuppen's divide-and-conquer. U (n×n) receives the eigenvectors of T.
+// Independent subproblems and secular-equation roots run in parallel
+// when compiled with -fopenmp.
+bool tridiagonal_eig_dc(const std::vector<double>& d, const std::vector<double>& e,
+                        std::vector<double>& lambda, Matrix& U);
+
+// ============================================================================
+// Drivers (symmetric_eig.cpp)
+// ============================================================================
+
+// All eigenvalues of A (ascending). Returns false if the tridiagonal
+// solver did not converge.
+bool symmetric_eigenvalues(const Matrix& A, std::vector<double>& lambda,
+                           int block_size);
+
+// All eigenpairs of A: A * Z = Z * diag(lambda), Z orthogonal.
+// Returns false if the tridiagonal solver did not converge.
+bool symmetric_eig(const Matrix& A, std::vector<double>& lambda, Matrix& Z,
+                   int block_size);
+
+// Flop count of the reduction (4/3 n^3), used for GFLOPS reporting
+double tridiagonalize_flops(int n);
+
+#endif // SYMMETRIC_EIG_H
@@ -0,0 +1,261 @@
+#include <iostream>
+#include <cmath>
+#include <limits>
+#include <string>
+#include "symmetric_eig.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+
+Matrix random_symmetric(int n) {
+    Matrix A(n, n);
+    A.fill_random();
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < i; j++) {
+            A(j, i) = A(i, j);
+        }
+    }
+    return A;
+}
+
+Matrix tridiagonal_matrix(const std::vector<double>& d, const std::vector<double>& e) {
+    const int n = static_cast<int>(d.size());
+    Matrix T(n, n);
+    for (int i = 0; i < n; i++) {
+        T(i, i) = d[i];
+        if (i + 1 < n) {
+            T(i + 1, i) = e[i];
+            T(i, i + 1) = e[i];
+        }
+    }
+    return T;
+}
+
+// ||A*Z - Z*diag(lambda)||_max
+double eig_residual(const Matrix& A, const std::vector<double>& lambda, const Matrix& Z) {
+    Matrix AZ(A.m, Z.n);
+    gemm_ikj(A, Z, AZ);
+    double max_diff = 0.0;
+    for (int i = 0; i < Z.m; i++) {
+        for (int j = 0; j < Z.n; j++) {
+            max_diff = std::max(max_diff, std::abs(AZ(i, j) - lambda[j] * Z(i, j)));
+        }
+    }
+    return max_diff;
+}
+
+bool test_tridiagonalization() {
+    std::cout << "Testing blocked tridiagonalization... ";
+
+    for (int n : {1, 2, 3, 17, 50, 101}) {
+        for (int block_size : {8, 32}) {
+            Matrix A = random_symmetric(n);
+
+            Matrix R_ref = A;
+            std::vector<double> d_ref, e_ref, tau_ref;
+            tridiagonalize_unblocked(R_ref, d_ref, e_ref, tau_ref);
+
+            Matrix R = A;
+            std::vector<double> d, e, tau;
+            tridiagonalize_blocked(R, d, e, tau, block_size);
+
+            double tol = 1e-12 * n;
+            if (max_abs_diff(d, d_ref) > tol || max_abs_diff(e, e_ref) > tol) {
+                std::cout << "FAILED (n=" << n << ", blocked != unblocked)\n";
+                return false;
+            }
+
+            // Q from the back-transformation applied to I, then Q*T*Q^T = A
+            Matrix Q(n, n);
+            for (int i = 0; i < n; i++) Q(i, i) = 1.0;
+            tridiagonal_back_transform(R, tau, Q, block_size);
+
+            Matrix QT(n, n), QTQt(n, n);
+            gemm_ikj(Q, tridiagonal_matrix(d, e), QT);
+            gemm_ikj(QT, Q.transpose(), QTQt);
+            double max_diff = 0.0;
+            for (size_t i = 0; i < A.data.size(); i++) {
+                max_diff = std::max(max_diff, std::abs(QTQt.data[i] - A.data[i]));
+            }
+            if (orthogonality_error(Q) > tol || max_diff > tol) {
+                std::cout << "FAILED (n=" << n << ", Q*T*Q^T != A)\n";
+                return false;
+            }
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool check_tridiagonal_solver(const std::vector<double>& d, const std::vector<double>& e,
+                              const std::string& label) {
+    const int n = static_cast<int>(d.size());
+
+    std::vector<double> lambda_ql;
+    std::vector<double> lambda;
+    Matrix U(n, n);
+    if (!tridiagonal_eigenvalues(d, e, lambda_ql) || !tridiagonal_eig_dc(d, e, lambda, U)) {
+        std::cout << "FAILED (" << label << ", reported no convergence)\n";
+        return false;
+    }
+
+    double scale = 1.0;
+    for (double x : lambda_ql) scale = std::max(scale, std::abs(x));
+    double tol = 1e-12 * n * scale;
+
+    if (max_abs_diff(lambda, lambda_ql) > tol) {
+        std::cout << "FAILED (" << label << ", eigenvalues differ from QL)\n";
+        return false;
+    }
+    if (eig_residual(tridiagonal_matrix(d, e), lambda, U) > tol) {
+        std::cout << "FAILED (" << label << ", T*U != U*Lambda)\n";
+        return false;
+    }
+    if (orthogonality_error(U) > 1e-12 * n) {
+        std::cout << "FAILED (" << label << ", U not orthogonal)\n";
+        return false;
+    }
+    return true;
+}
+
+bool test_divide_and_conquer() {
+    std::cout << "Testing divide-and-conquer... ";
+
+    // Random tridiagonals, including sizes that cross the leaf and task limits
+    for (int n : {1, 5, 33, 100, 300}) {
+        Matrix R(2, n);
+        R.fill_random();
+        std::vector<double> d(R.data.begin(), R.data.begin() + n);
+        std::vector<double> e(R.data.begin() + n, R.data.begin() + 2 * n - 1);
+        if (!check_tridiagonal_solver(d, e, "random n=" + std::to_string(n))) return false;
+    }
+
+    // Wilkinson W+: nearly equal eigenvalue pairs exercise Givens deflation
+    {
+        const int n = 101;
+        std::vector<double> d(n), e(n - 1, 1.0);
+        for (int i = 0; i < n; i++) d[i] = std::abs(i - n / 2);
+        if (!check_tridiagonal_solver(d, e, "Wilkinson W+")) return false;
+    }
+
+    // Tiny couplings: almost everything deflates on small z
+    {
+        const int n = 120;
+        std::vector<double> d(n), e(n - 1, 1e-14);
+        for (int i = 0; i < n; i++) d[i] = (i % 7) * 0.5;
+        if (!check_tridiagonal_solver(d, e, "tiny couplings")) return false;
+    }
+
+    // Toeplitz (1, 2, 1): eigenvalues 2 - 2cos(k*pi/(n+1))
+    {
+        const int n = 200;
+        std::vector<double> d(n, 2.0), e(n - 1, -1.0);
+        std::vector<double> lambda;
+        Matrix U(n, n);
+        tridiagonal_eig_dc(d, e, lambda, U);
+        double max_diff = 0.0;
+        for (int k = 1; k <= n; k++) {
+            double exact = 2.0 - 2.0 * std::cos(k * M_PI / (n + 1));
+            max_diff = std::max(max_diff, std::abs(lambda[k - 1] - exact));
+        }
+        if (max_diff > 1e-12) {
+            std::cout << "FAILED (Toeplitz, max error " << max_diff << ")\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_full_eigensolver() {
+    std::cout << "Testing full symmetric eigensolver... ";
+
+    for (int n : {1, 10, 150}) {
+        Matrix A = random_symmetric(n);
+
+        std::vector<double> lambda_only;
+        symmetric_eigenvalues(A, lambda_only, 32);
+
+        std::vector<double> lambda;
+        Matrix Z(n, n);
+        symmetric_eig(A, lambda, Z, 32);
+
+        double tol = 1e-12 * n;
+        if (max_abs_diff(lambda, lambda_only) > tol) {
+            std::cout << "FAILED (n=" << n << ", eigenvalue paths disagree)\n";
+            return false;
+        }
+        if (eig_residual(A, lambda, Z) > tol) {
+            std::cout << "FAILED (n=" << n << ", A*Z != Z*Lambda)\n";
+            return false;
+        }
+        if (orthogonality_error(Z) > tol) {
+            std::cout << "FAILED (n=" << n << ", Z not orthogonal)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_convergence_flag() {
+    std::cout << "Testing non-convergence is reported... ";
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    // A NaN in T never passes the deflation test, so QL runs out of
+    // iterations. n = 100 puts it in one leaf of divide-and-conquer.
+    for (int n : {5, 100}) {
+        Matrix R(2, n);
+        R.fill_random();
+        std::vector<double> d(R.data.begin(), R.data.begin() + n);
+        std::vector<double> e(R.data.begin() + n, R.data.begin() + 2 * n - 1);
+        d[n / 3] = nan;
+
+        std::vector<double> lambda;
+        Matrix U(n, n);
+        if (tridiagonal_eigenvalues(d, e, lambda)) {
+            std::cout << "FAILED (QL, n=" << n << ", NaN reported as converged)\n";
+            return false;
+        }
+        if (tridiagonal_eig_dc(d, e, lambda, U)) {
+            std::cout << "FAILED (D&C, n=" << n << ", NaN reported as converged)\n";
+            return false;
+        }
+    }
+
+    Matrix A = random_symmetric(40);
+    A(7, 3) = A(3, 7) = nan;
+    std::vector<double> lambda;
+    Matrix Z(40, 40);
+    if (symmetric_eigenvalues(A, lambda, 16) || symmetric_eig(A, lambda, Z, 16)) {
+        std::cout << "FAILED (drivers reported NaN input as converged)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Symmetric Eigensolver\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_tridiagonalization();
+    all_passed &= test_divide_and_conquer();
+    all_passed &= test_full_eigensolver();
+    all_passed &= test_convergence_flag();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}
@@ -0,0 +1,419 @@
+#include "symmetric_eig.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+// Subproblems at or below this size are solved directly with implicit QL
+static const int kLeafSize = 32;
+
+// Subproblems at or above this size spawn parallel tasks
+static const int kTaskSize = 256;
+
+static const int kGemmBlock = 64;
+static const double kEps = std::numeric_limits<double>::epsilon();
+
+// QL sweeps allowed per eigenvalue; two or three are typical
+static const int kMaxQlIterations = 60;
+
+// ============================================================================
+// IMPLICIT QL (Section 8.3.3, EISPACK tql2 / Numerical Recipes tqli)
+//
+// d (n) diagonal, e (n) subdiagonal in e[0..n-2], e[n-1] unused.
+// If Z is non-null its columns are rotated along with T, so starting from
+// Z = I gives the eigenvectors of T.
+// Returns false if some eigenvalue did not converge within kMaxQlIterations
+// (e.g. a NaN in T); d and Z then hold the values reached so far.
+// ============================================================================
+static bool tridiagonal_ql(std::vector<double>& d, std::vector<double>& e, Matrix* Z) {
+    const int n = static_cast<int>(d.size());
+    if (n == 0) return true;
+    e[n - 1] = 0.0;
+    bool converged = true;
+
+    for (int l = 0; l < n; l++) {
+        int iter = 0;
+        int m;
+        do {
+            for (m = l; m < n - 1; m++) {
+                double dd = std::abs(d[m]) + std::abs(d[m + 1]);
+                if (std::abs(e[m]) <= kEps * dd) break;
+            }
+            if (m == l) break;
+            if (iter++ == kMaxQlIterations) {
+                converged = false;
+                break;
+            }
+
+            // Wilkinson-style shift from the leading 2×2
+            double g = (d[l + 1] - d[l]) / (2.0 * e[l]);
+            double r = std::hypot(g, 1.0);
+            g = d[m] - d[l] + e[l] / (g + std::copysign(r, g));
+
+            double s = 1.0, c = 1.0, p = 0.0;
+            int i;
+            for (i = m - 1; i >= l; i--) {
+                double f = s * e[i];
+                double b = c * e[i];
+                r = std::hypot(f, g);
+                e[i + 1] = r;
+                if (r == 0.0) {
+                    d[i + 1] -= p;
+                    e[m] = 0.0;
+                    break;
+                }
+                s = f / r;
+                c = g / r;
+                g = d[i + 1] - p;
+                r = (d[i] - g) * s + 2.0 * c * b;
+                p = s * r;
+                d[i + 1] = g + p;
+                g = c * r - b;
+
+                if (Z) {
+                    for (int k = 0; k < Z->m; k++) {
+                        double z_k1 = (*Z)(k, i + 1);
+                        (*Z)(k, i + 1) = s * (*Z)(k, i) + c * z_k1;
+                        (*Z)(k, i) = c * (*Z)(k, i) - s * z_k1;
+                    }
+                }
+            }
+            if (r == 0.0 && i >= l) continue;
+            d[l] -= p;
+            e[l] = g;
+            e[m] = 0.0;
+        } while (m != l);
+    }
+    return converged;
+}
+
+bool tridiagonal_eigenvalues(std::vector<double> d, std::vector<double> e,
+                             std::vector<double>& lambda) {
+    e.resize(d.size(), 0.0);
+    bool converged = tridiagonal_ql(d, e, nullptr);
+    std::sort(d.begin(), d.end());
+    lambda = d;
+    return converged;
+}
+
+// Reorder eigenpairs so that lambda is ascending: out(:, c) = src(:, perm[c])
+static void sort_eigenpairs(std::vector<double>& lambda, const Matrix& src, Matrix& out) {
+    const int n = static_cast<int>(lambda.size());
+    std::vector<int> perm(n);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::stable_sort(perm.begin(), perm.end(),
+                     [&lambda](int a, int b) { return lambda[a] < lambda[b]; });
+
+    std::vector<double> sorted(n);
+    for (int c = 0; c < n; c++) sorted[c] = lambda[perm[c]];
+    lambda = sorted;
+
+    for (int i = 0; i < src.m; i++) {
+        for (int c = 0; c < n; c++) {
+            out(i, c) = src(i, perm[c]);
+        }
+    }
+}
+
+// ============================================================================
+// SECULAR EQUATION  f(x) = 1 + rho * sum_i z_i^2 / (d_i - x) = 0
+//
+// With rho > 0 and d ascending, root j lies in (d_j, d_{j+1}), and the
+// last root lies in (d_{k-1}, d_{k-1} + rho). Each root is stored relative
+// to the closer pole, lambda_j = d[origin] + tau, so the differences
+// d_i - lambda_j needed for the eigenvectors keep full relative accuracy.
+//
+// Iteration: fixed-weight rational model (Bunch, Nielsen & Sorensen).
+// The sums left and right of the root are each replaced by
+// a + b/(pole - x), matched in value and slope at the current iterate.
+// The resulting quadratic is solved, with bisection as a safeguard.
+// ============================================================================
+static void secular_root(const std::vector<double>& dk, const std::vector<double>& z2,
+                         double rho, int j, int& origin, double& tau) {
+    const int k = static_cast<int>(dk.size());
+    double lo, hi;
+
+    if (j < k - 1) {
+        double half = 0.5 * (dk[j + 1] - dk[j]);
+        double f_mid = 1.0;
+        for (int i = 0; i < k; i++) f_mid += rho * z2[i] / ((dk[i] - dk[j]) - half);
+        if (f_mid >= 0.0) {
+            origin = j;
+            lo = 0.0;
+            hi = half;
+        } else {
+            origin = j + 1;
+            lo = -half;
+            hi = 0.0;
+        }
+    } else {
+        origin = k - 1;
+        lo = 0.0;
+        hi = rho;
+    }
+
+    const double d_org = dk[origin];
+    const double left = dk[j] - d_org;
+    const double right = (j < k - 1) ? dk[j + 1] - d_org : 0.0;
+
+    tau = 0.5 * (lo + hi);
+    for (int iter = 0; iter < 200; iter++) {
+        double psi = 0.0, dpsi = 0.0, phi = 0.0, dphi = 0.0;
+        for (int i = 0; i <= j; i++) {
+            double t = rho * z2[i] / ((dk[i] - d_org) - tau);
+            psi += t;
+            dpsi += t / ((dk[i] - d_org) - tau);
+        }
+        for (int i = j + 1; i < k; i++) {
+            double t = rho * z2[i] / ((dk[i] - d_org) - tau);
+            phi += t;
+            dphi += t / ((dk[i] - d_org) - tau);
+        }
+        double f = 1.0 + psi + phi;
+
+        if (f < 0.0) lo = tau; else hi = tau;
+        double err_bound = 8.0 * kEps * k * (1.0 + std::abs(psi) + std::abs(phi));
+        if (std::abs(f) <= err_bound) break;
+        if (hi - lo <= 2.0 * kEps * std::max(std::abs(lo), std::abs(hi))) break;
+
+        // Fixed-weight model step
+        double a = left - tau;
+        double q = dpsi * a * a;
+        double p = psi - dpsi * a;
+        double x;
+        if (j < k - 1) {
+            double b = right - tau;
+            double s = dphi * b * b;
+            double r = phi - dphi * b;
+            double C = 1.0 + p + r;
+            double B = -(C * (left + right) + q + s);
+            double E = C * left * right + q * right + s * left;
+            double disc = B * B - 4.0 * C * E;
+            x = 0.5 * (lo + hi);
+            if (disc >= 0.0 && C != 0.0) {
+                double qq = -0.5 * (B + std::copysign(std::sqrt(disc), B));
+                double x1 = qq / C;
+                double x2 = (qq != 0.0) ? E / qq : x1;
+                if (x1 > lo && x1 < hi) x = x1;
+                else if (x2 > lo && x2 < hi) x = x2;
+            }
+        } else {
+            double C = 1.0 + p + phi;
+            x = (C != 0.0) ? left + q / C : 0.5 * (lo + hi);
+        }
+
+        if (!(x > lo && x < hi)) x = 0.5 * (lo + hi);
+        tau = x;
+    }
+}
+
+// ============================================================================
+// RANK-ONE MERGE (Section 8.4.4, LAPACK xLAED2/xLAED3)
+//
+// Eigen-decomposes  Qb * (D + rho*z*z^T) * Qb^T  where Qb = diag(U1, U2).
+//   1. Deflation: tiny z_i, or nearly equal d_i (Givens rotation), leave
+//      d_i as an eigenvalue with the (rotated) column of Qb as its vector
+//   2. Secular equation for the k remaining roots
+//   3. Lowner's formula recomputes z from the roots so the vectors come
+//      out numerically orthogonal (Gu & Eisenstat)
+//   4. U(:, nondeflated) = Qb(:, nondeflated) * S          (GEMM)
+// ============================================================================
+static void merge_rank_one(std::vector<double>& D, std::vector<double>& z, double rho,
+                           Matrix& Qb, std::vector<double>& lambda, Matrix& U) {
+    const int n = static_cast<int>(D.size());
+
+    double znorm = 0.0;
+    for (double zi : z) znorm += zi * zi;
+    znorm = std::sqrt(znorm);
+    for (double& zi : z) zi /= znorm;
+    rho *= znorm * znorm;
+
+    // Work with rho > 0: eig(D + rho zz^T) = -eig(-D - rho zz^T)
+    const bool flipped = rho < 0.0;
+    if (flipped) {
+        for (double& di : D) di = -di;
+        rho = -rho;
+    }
+
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&D](int a, int b) { return D[a] < D[b]; });
+
+    double d_max = 0.0;
+    for (double di : D) d_max = std::max(d_max, std::abs(di));
+    const double tol = 8.0 * kEps * std::max(d_max, rho);
+
+    std::vector<int> kept, deflated;
+    int pending = -1;
+    for (int idx : order) {
+        if (rho * std::abs(z[idx]) <= tol) {
+            deflated.push_back(idx);
+            continue;
+        }
+        if (pending < 0) {
+            pending = idx;
+            continue;
+        }
+        double r = std::hypot(z[pending], z[idx]);
+        double c = z[idx] / r;
+        double s = z[pending] / r;
+        if (std::abs(c * s * (D[pending] - D[idx])) <= tol) {
+            // Rotate columns so z[pending] becomes zero
+            for (int i = 0; i < n; i++) {
+                double qp = Qb(i, pending), qi = Qb(i, idx);
+                Qb(i, pending) = c * qp - s * qi;
+                Qb(i, idx) = s * qp + c * qi;
+            }
+            double dp = D[pending], di = D[idx];
+            D[pending] = c * c * dp + s * s * di;
+            D[idx] = s * s * dp + c * c * di;
+            z[pending] = 0.0;
+            z[idx] = r;
+            deflated.push_back(pending);
+        } else {
+            kept.push_back(pending);
+        }
+        pending = idx;
+    }
+    if (pending >= 0) kept.push_back(pending);
+
+    const int k = static_cast<int>(kept.size());
+    std::vector<double> dk(k), zk(k), z2(k);
+    for (int i = 0; i < k; i++) {
+        dk[i] = D[kept[i]];
+        zk[i] = z[kept[i]];
+        z2[i] = zk[i] * zk[i];
+    }
+
+    // Secular equation, one independent root per iteration
+    std::vector<int> origin(k);
+    std::vector<double> tau(k);
+    #pragma omp taskloop shared(dk, z2, origin, tau) if (k >= kTaskSize)
+    for (int j = 0; j < k; j++) {
+        secular_root(dk, z2, rho, j, origin[j], tau[j]);
+    }
+
+    // delta(i, j) = d_i - lambda_j, computed from the stored origin
+    auto delta = [&](int i, int j) { return (dk[i] - dk[origin[j]]) - tau[j]; };
+
+    // Lowner: z_i^2 = prod_j (lambda_j - d_i) / (rho * prod_{j != i} (d_j - d_i))
+    std::vector<double> zhat(k);
+    #pragma omp taskloop shared(dk, zk, zhat) if (k >= kTaskSize)
+    for (int i = 0; i < k; i++) {
+        double w = -delta(i, i) / rho;
+        for (int j = 0; j < k; j++) {
+            if (j != i) w *= -delta(i, j) / (dk[j] - dk[i]);
+        }
+        zhat[i] = std::copysign(std::sqrt(std::abs(w)), zk[i]);
+    }
+
+    // S(i, j) = zhat_i / (d_i - lambda_j), columns normalised
+    Matrix S(k, k);
+    std::vector<double> col_norm(k, 0.0);
+    for (int i = 0; i < k; i++) {
+        for (int j = 0; j < k; j++) {
+            double s_ij = zhat[i] / delta(i, j);
+            S(i, j) = s_ij;
+            col_norm[j] += s_ij * s_ij;
+        }
+    }
+    for (double& c : col_norm) c = 1.0 / std::sqrt(c);
+    for (int i = 0; i < k; i++) {
+        for (int j = 0; j < k; j++) S(i, j) *= col_norm[j];
+    }
+
+    // Assemble unsorted eigenpairs: kept roots first, then deflated values
+    Matrix Q_kept(n, k);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < k; j++) Q_kept(i, j) = Qb(i, kept[j]);
+    }
+    Matrix V_kept(n, k);
+    gemm_blocked(Q_kept, S, V_kept, kGemmBlock);
+
+    std::vector<double> lam(n);
+    Matrix unsorted(n, n);
+    for (int j = 0; j < k; j++) lam[j] = dk[origin[j]] + tau[j];
+    for (size_t t = 0; t < deflated.size(); t++) lam[k + t] = D[deflated[t]];
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < k; j++) unsorted(i, j) = V_kept(i, j);
+        for (size_t t = 0; t < deflated.size(); t++) {
+            unsorted(i, k + t) = Qb(i, deflated[t]);
+        }
+    }
+    if (flipped) {
+        for (double& l : lam) l = -l;
+    }
+
+    lambda = lam;
+    sort_eigenpairs(lambda, unsorted, U);
+}
+
+// ============================================================================
+// DIVIDE AND CONQUER (Cuppen, Section 8.4.4)
+//
+// T = diag(T1, T2) + rho * v * v^T,  v = e_{m-1} + e_m,  rho = e[m-1]
+// where T1, T2 have their touching diagonal entries reduced by rho.
+// The two halves are independent and solved as parallel tasks.
+// ============================================================================
+static bool dc_recurse(const double* d, const double* e, int n,
+                       std::vector<double>& lambda, Matrix& U) {
+    if (n <= kLeafSize) {
+        std::vector<double> dd(d, d + n), ee(n, 0.0);
+        std::copy(e, e + n - 1, ee.begin());
+        Matrix Z(n, n);
+        for (int i = 0; i < n; i++) Z(i, i) = 1.0;
+        bool converged = tridiagonal_ql(dd, ee, &Z);
+        lambda = dd;
+        sort_eigenpairs(lambda, Z, U);
+        return converged;
+    }
+
+    const int m = n / 2;
+    const double rho = e[m - 1];
+
+    std::vector<double> d1(d, d + m), d2(d + m, d + n);
+    d1[m - 1] -= rho;
+    d2[0] -= rho;
+
+    std::vector<double> lam1, lam2;
+    Matrix U1(m, m), U2(n - m, n - m);
+
+    bool ok1 = true, ok2 = true;
+    #pragma omp task shared(d1, lam1, U1, ok1) if (n >= kTaskSize)
+    ok1 = dc_recurse(d1.data(), e, m, lam1, U1);
+    #pragma omp task shared(d2, lam2, U2, ok2) if (n >= kTaskSize)
+    ok2 = dc_recurse(d2.data(), e + m, n - m, lam2, U2);
+    #pragma omp taskwait
+
+    // D + rho * z z^T in the basis Qb = diag(U1, U2)
+    std::vector<double> D(n), z(n);
+    Matrix Qb(n, n);
+    for (int i = 0; i < m; i++) {
+        D[i] = lam1[i];
+        z[i] = U1(m - 1, i);
+        for (int j = 0; j < m; j++) Qb(i, j) = U1(i, j);
+    }
+    for (int i = 0; i < n - m; i++) {
+        D[m + i] = lam2[i];
+        z[m + i] = U2(0, i);
+        for (int j = 0; j < n - m; j++) Qb(m + i, m + j) = U2(i, j);
+    }
+
+    merge_rank_one(D, z, rho, Qb, lambda, U);
+    return ok1 && ok2;
+}
+
+bool tridiagonal_eig_dc(const std::vector<double>& d, const std::vector<double>& e,
+                        std::vector<double>& lambda, Matrix& U) {
+    const int n = static_cast<int>(d.size());
+    U = Matrix(n, n);
+    lambda.assign(n, 0.0);
+    if (n == 0) return true;
+
+    bool converged = true;
+    #pragma omp parallel
+    #pragma omp single
+    converged = dc_recurse(d.data(), e.data(), n, lambda, U);
+    return converged;
+}
@@ -0,0 +1,213 @@
+#include "symmetric_eig.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+#include "../../chapter5/householder/householder.h"
+#include "../../chapter1/symv/symv.h"
+#include <algorithm>
+
+// Block size handed to gemm_blocked, and height of the block rows used
+// for the lower-triangular trailing update
+static const int kGemmBlock = 64;
+
+// ============================================================================
+// UNBLOCKED REFERENCE (Algorithm 8.3.1)
+//
+// for k = 0 .. n-2:
+//     generate P_k from A(k+1:n, k)
+//     p = tau * A22 * v,  w = p - (tau/2)(p^T v) v
+//     A22 = A22 - v*w^T - w*v^T          (lower triangle only)
+// ============================================================================
+void tridiagonalize_unblocked(Matrix& A, std::vector<double>& d,
+                              std::vector<double>& e, std::vector<double>& tau) {
+    const int n = A.n;
+    d.assign(n, 0.0);
+    e.assign(std::max(n - 1, 0), 0.0);
+    tau.assign(std::max(n - 1, 0), 0.0);
+    std::vector<double> v(n), w(n);
+
+    for (int k = 0; k < n - 1; k++) {
+        double t = householder_column(A, k + 1, k);
+        tau[k] = t;
+        d[k] = A(k, k);
+        e[k] = A(k + 1, k);
+        if (t == 0.0) continue;
+
+        const int len = n - k - 1;
+        v[0] = 1.0;
+        for (int i = 1; i < len; i++) v[i] = A(k + 1 + i, k);
+
+        std::fill(w.begin(), w.begin() + len, 0.0);
+        symv_lower(A, k + 1, v.data(), w.data());
+        double pv = 0.0;
+        for (int i = 0; i < len; i++) {
+            w[i] *= t;
+            pv += w[i] * v[i];
+        }
+        double alpha = -0.5 * t * pv;
+        for (int i = 0; i < len; i++) w[i] += alpha * v[i];
+
+        for (int i = 0; i < len; i++) {
+            double* a_row = &A(k + 1 + i, k + 1);
+            for (int j = 0; j <= i; j++) {
+                a_row[j] -= v[i] * w[j] + w[i] * v[j];
+            }
+        }
+    }
+    if (n > 0) d[n - 1] = A(n - 1, n - 1);
+}
+
+// ============================================================================
+// PANEL FACTORIZATION (LAPACK xLATRD, lower)
+//
+// Reduces columns j0 .. j0+nb-1. The trailing matrix is left untouched;
+// instead the panel accumulates V and W so that, once the panel is done,
+//   A22 = A22 - V*W^T - W*V^T
+// Column j is brought up to date with the same formula just before its
+// reflector is generated, and w_c is built from the untouched A22:
+//   w = tau * (A22*v - V*(W^T v) - W*(V^T v)),  w = w - (tau/2)(w^T v) v
+// ============================================================================
+static void tridiagonal_panel(Matrix& A, std::vector<double>& d,
+                              std::vector<double>& e, std::vector<double>& tau,
+                              int j0, int nb, Matrix& V, Matrix& W) {
+    const int n = A.n;
+    std::vector<double> v(n), w(n), vw(nb), vv(nb);
+
+    for (int c = 0; c < nb; c++) {
+        const int j = j0 + c;
+
+        // Bring column j (rows j..n-1) up to date
+        for (int i = j; i < n; i++) {
+            double s = 0.0;
+            for (int p = 0; p < c; p++) {
+                s += V(i, p) * W(j, p) + W(i, p) * V(j, p);
+            }
+            A(i, j) -= s;
+        }
+
+        double t = householder_column(A, j + 1, j);
+        tau[j] = t;
+        d[j] = A(j, j);
+        e[j] = A(j + 1, j);
+
+        const int r0 = j + 1;
+        const int len = n - r0;
+        v[0] = 1.0;
+        for (int i = 1; i < len; i++) v[i] = A(r0 + i, j);
+        for (int i = 0; i < len; i++) V(r0 + i, c) = v[i];
+        if (t == 0.0) continue;
+
+        // w = A22 * v using the untouched lower triangle (chapter1/symv)
+        std::fill(w.begin(), w.begin() + len, 0.0);
+        symv_lower(A, r0, v.data(), w.data());
+
+        // vw = W^T v, vv = V^T v (rows r0..n-1)
+        std::fill(vw.begin(), vw.begin() + c, 0.0);
+        std::fill(vv.begin(), vv.begin() + c, 0.0);
+        for (int i = 0; i < len; i++) {
+            for (int p = 0; p < c; p++) {
+                vw[p] += W(r0 + i, p) * v[i];
+                vv[p] += V(r0 + i, p) * v[i];
+            }
+        }
+
+        double wv = 0.0;
+        for (int i = 0; i < len; i++) {
+            double s = 0.0;
+            for (int p = 0; p < c; p++) {
+                s += V(r0 + i, p) * vw[p] + W(r0 + i, p) * vv[p];
+            }
+            w[i] = t * (w[i] - s);
+            wv += w[i] * v[i];
+        }
+
+        double alpha = -0.5 * t * wv;
+        for (int i = 0; i < len; i++) W(r0 + i, c) = w[i] + alpha * v[i];
+    }
+}
+
+// ============================================================================
+// BLOCKED TRIDIAGONALIZATION
+//
+// for each panel of block_size columns:
+//     factor the panel -> V, W
+//     for each block row I of the trailing matrix (lower triangle only):
+//         A(I, jt:I_end) -= V(I,:) * W(jt:I_end,:)^T + W(I,:) * V(jt:I_end,:)^T
+//
+// Updating block rows up to the diagonal does half the work of a full
+// GEMM update; the upper triangle goes stale and is never read again.
+// ============================================================================
+void tridiagonalize_blocked(Matrix& A, std::vector<double>& d,
+                            std::vector<double>& e, std::vector<double>& tau,
+                            int block_size) {
+    const int n = A.n;
+    d.assign(n, 0.0);
+    e.assign(std::max(n - 1, 0), 0.0);
+    tau.assign(std::max(n - 1, 0), 0.0);
+
+    for (int j0 = 0; j0 < n - 1; j0 += block_size) {
+        const int nb = std::min(block_size, n - 1 - j0);
+
+        Matrix V(n, nb), W(n, nb);
+        tridiagonal_panel(A, d, e, tau, j0, nb, V, W);
+
+        const int jt = j0 + nb;
+        const int rest = n - jt;
+        if (rest <= 0) continue;
+
+        Matrix Vt = V.block(jt, 0, rest, nb).transpose();
+        Matrix Wt = W.block(jt, 0, rest, nb).transpose();
+
+        for (int ib = jt; ib < n; ib += kGemmBlock) {
+            const int h = std::min(kGemmBlock, n - ib);
+            const int width = ib + h - jt;
+
+            Matrix C = A.block(ib, jt, h, width);
+            Matrix V_neg = V.block(ib, 0, h, nb);
+            Matrix W_neg = W.block(ib, 0, h, nb);
+            for (auto& x : V_neg.data) x = -x;
+            for (auto& x : W_neg.data) x = -x;
+
+            gemm_blocked(V_neg, Wt.block(0, 0, nb, width), C, kGemmBlock);
+            gemm_blocked(W_neg, Vt.block(0, 0, nb, width), C, kGemmBlock);
+            A.set_block(ib, jt, C);
+        }
+    }
+    if (n > 0) d[n - 1] = A(n - 1, n - 1);
+}
+
+// ============================================================================
+// BLOCKED BACK-TRANSFORMATION
+//
+// Q = B_0 * B_1 * ... with B_b = I - V_b*T_b*V_b^T covering block_size
+// reflectors, so Q*Z applies the last block first. Each block costs two
+// GEMMs over the rows of Z it touches.
+// ============================================================================
+void tridiagonal_back_transform(const Matrix& A, const std::vector<double>& tau,
+                                Matrix& Z, int block_size) {
+    const int n = A.n;
+    if (n < 2) return;
+    const int num_blocks = (n - 1 + block_size - 1) / block_size;
+
+    for (int b = num_blocks - 1; b >= 0; b--) {
+        const int j0 = b * block_size;
+        const int nb = std::min(block_size, n - 1 - j0);
+        const int r0 = j0 + 1;
+        const int rows = n - r0;
+
+        // V(:, c) holds v_{j0+c}, which starts at local row c
+        Matrix V(rows, nb);
+        std::vector<double> tau_b(tau.begin() + j0, tau.begin() + j0 + nb);
+        for (int c = 0; c < nb; c++) {
+            V(c, c) = 1.0;
+            for (int i = c + 1; i < rows; i++) V(i, c) = A(r0 + i, j0 + c);
+        }
+
+        Matrix T = householder_block_t(V, tau_b);
+        Matrix Z_low = Z.block(r0, 0, rows, Z.n);
+        apply_block_reflector_left(V, T, Z_low, false);
+        Z.set_block(r0, 0, Z_low);
+    }
+}
+
+double tridiagonalize_flops(int n) {
+    return 4.0 / 3.0 * static_cast<double>(n) * n * n;
+}
@@ -0,0 +1,173 @@
+#include "matrix_functions.h"
+#include "../../chapter3/lu/lu.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+// Block size handed to lu_blocked
+static const int kLuBlock = 64;
+
+// Largest ||A||_1 for which the [m/m] Padé approximant has backward error
+// below unit roundoff (Higham 2005, Table 10.2)
+static const int kDegrees[] = {3, 5, 7, 9, 13};
+static const double kTheta[] = {1.495585217958292e-2, 2.539398330063230e-1,
+                                9.504178996162932e-1, 2.097847961257068e0,
+                                5.371920351148152e0};
+
+// Coefficients b_0..b_m of the Padé numerator p_m(x); q_m(x) = p_m(-x)
+static const double kPade3[] = {120.0, 60.0, 12.0, 1.0};
+static const double kPade5[] = {30240.0, 15120.0, 3360.0, 420.0, 30.0, 1.0};
+static const double kPade7[] = {17297280.0, 8648640.0, 1995840.0, 277200.0,
+                                25200.0, 1512.0, 56.0, 1.0};
+static const double kPade9[] = {17643225600.0, 8821612800.0, 2075673600.0,
+                                302702400.0, 30270240.0, 2162160.0, 110880.0,
+                                3960.0, 90.0, 1.0};
+static const double kPade13[] = {64764752532480000.0, 32382376266240000.0,
+                                 7771770303897600.0, 1187353796428800.0,
+                                 129060195264000.0, 10559470521600.0,
+                                 670442572800.0, 33522128640.0, 1323241920.0,
+                                 40840800.0, 960960.0, 16380.0, 182.0, 1.0};
+
+// Workspace slots (0 is the LU slot)
+enum { kScaled = 1, kA2, kA4, kA6, kA8, kU, kV, kTmp };
+
+// Y = beta*I + sum_k coef[k] * X[k]
+static void combine(Matrix& Y, double beta, int count, const double* coef,
+                    const Matrix* const* X) {
+    const int n = Y.n;
+    std::fill(Y.data.begin(), Y.data.end(), 0.0);
+    for (int k = 0; k < count; k++) {
+        const double c = coef[k];
+        const double* x = X[k]->data.data();
+        double* y = Y.data.data();
+        for (int i = 0; i < n * n; i++) y[i] += c * x[i];
+    }
+    for (int i = 0; i < n; i++) Y(i, i) += beta;
+}
+
+// Y += X
+static void add_into(Matrix& Y, const Matrix& X) {
+    for (size_t i = 0; i < Y.data.size(); i++) Y.data[i] += X.data[i];
+}
+
+// ============================================================================
+// U = A * sum_j b_{2j+1} A^{2j},  V = sum_j b_{2j} A^{2j}
+//
+// Degrees 3..9 form A^2, A^4, ... and spend one more GEMM on U.
+// Degree 13 splits both sums at A^6 (Higham 2005, eq. 10.35):
+//   U = A [A6 (b13 A6 + b11 A4 + b9 A2) + b7 A6 + b5 A4 + b3 A2 + b1 I]
+//   V =    A6 (b12 A6 + b10 A4 + b8 A2) + b6 A6 + b4 A4 + b2 A2 + b0 I
+// so degree 13 costs 6 GEMMs instead of the 7 the plain scheme would need.
+// ============================================================================
+static void pade_numerator_denominator(int m, MatrixFunctionWorkspace& ws, int n,
+                                       MatrixFunctionStats* stats) {
+    Matrix& As = ws.get(kScaled, n);
+    Matrix& A2 = ws.get(kA2, n);
+    Matrix& A4 = ws.get(kA4, n);
+    Matrix& A6 = ws.get(kA6, n);
+    Matrix& U = ws.get(kU, n);
+    Matrix& V = ws.get(kV, n);
+    Matrix& tmp = ws.get(kTmp, n);
+
+    multiply(As, As, A2, stats);
+    if (m >= 5) multiply(A2, A2, A4, stats);
+    if (m >= 7) multiply(A4, A2, A6, stats);
+
+    if (m == 13) {
+        const double* b = kPade13;
+        const Matrix* pows[] = {&A6, &A4, &A2};
+
+        double c_u[] = {b[13], b[11], b[9]};
+        combine(tmp, 0.0, 3, c_u, pows);
+        multiply(A6, tmp, V, stats);
+        double c_u_low[] = {b[7], b[5], b[3]};
+        combine(tmp, b[1], 3, c_u_low, pows);
+        add_into(tmp, V);
+        multiply(As, tmp, U, stats);
+
+        double c_v[] = {b[12], b[10], b[8]};
+        combine(tmp, 0.0, 3, c_v, pows);
+        multiply(A6, tmp, V, stats);
+        double c_v_low[] = {b[6], b[4], b[2]};
+        combine(tmp, b[0], 3, c_v_low, pows);
+        add_into(V, tmp);
+        return;
+    }
+
+    const double* b = (m == 3) ? kPade3 : (m == 5) ? kPade5 : (m == 7) ? kPade7 : kPade9;
+    const Matrix* pows[] = {&A2, &A4, &A6, nullptr};
+    if (m == 9) {
+        Matrix& A8 = ws.get(kA8, n);
+        multiply(A4, A4, A8, stats);
+        pows[3] = &A8;
+    }
+    const int half = m / 2;   // number of even powers beyond I
+    double c_u[4], c_v[4];
+    for (int j = 1; j <= half; j++) {
+        c_u[j - 1] = b[2 * j + 1];
+        c_v[j - 1] = b[2 * j];
+    }
+    combine(tmp, b[1], half, c_u, pows);
+    multiply(As, tmp, U, stats);
+    combine(V, b[0], half, c_v, pows);
+}
+
+bool expm(const Matrix& A, Matrix& E, MatrixFunctionStats* stats, MatrixFunctionWorkspace* ws) {
+    const int n = A.n;
+    MatrixFunctionWorkspace local;
+    if (!ws) ws = &local;
+
+    // Smallest degree whose theta covers ||A||_1, else scale into theta_13.
+    // A NaN or Inf entry leaves no scaling that works.
+    const double norm = norm1(A);
+    if (!std::isfinite(norm)) return false;
+    int m = 13, s = 0;
+    for (int k = 0; k < 4; k++) {
+        if (norm <= kTheta[k]) {
+            m = kDegrees[k];
+            break;
+        }
+    }
+    if (m == 13 && norm > kTheta[4]) {
+        s = static_cast<int>(std::ceil(std::log2(norm / kTheta[4])));
+    }
+
+    Matrix& As = ws->get(kScaled, n);
+    const double scale = std::ldexp(1.0, -s);   // exact power of two
+    for (size_t i = 0; i < A.data.size(); i++) As.data[i] = scale * A.data[i];
+
+    pade_numerator_denominator(m, *ws, n, stats);
+
+    // r_m = (V - U)^-1 (V + U): P overwrites U, Q overwrites V
+    Matrix& P = ws->get(kU, n);
+    Matrix& Q = ws->get(kV, n);
+    for (size_t i = 0; i < P.data.size(); i++) {
+        const double u = P.data[i], v = Q.data[i];
+        P.data[i] = v + u;
+        Q.data[i] = v - u;
+    }
+    if (stats) stats->solves++;
+    if (!lu_blocked(Q, ws->piv, kLuBlock)) return false;
+    lu_solve(Q, ws->piv, P);
+
+    // Undo the scaling: r_m^(2^s), ping-ponging between two buffers
+    Matrix* R = &P;
+    Matrix* tmp = &ws->get(kTmp, n);
+    for (int k = 0; k < s; k++) {
+        multiply(*R, *R, *tmp, stats);
+        std::swap(R, tmp);
+    }
+
+    if (E.m != n || E.n != n) E = Matrix(n, n);
+    E.data = R->data;
+    if (stats) {
+        stats->pade_degree = m;
+        stats->squarings = s;
+    }
+
+    // A nearly singular V - U, or exp(A) beyond the range of double
+    for (double e : E.data) {
+        if (!std::isfinite(e)) return false;
+    }
+    return true;
+}
@@ -0,0 +1,154 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include "matrix_functions.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+
+// Baseline for matrix_power: binary powering with a new Matrix per product
+Matrix power_allocating(const Matrix& A, int k, MatrixFunctionStats* stats) {
+    Matrix R = A;
+    int top = 0;
+    while ((k >> (top + 1)) > 0) top++;
+    for (int b = top - 1; b >= 0; b--) {
+        Matrix R2(A.n, A.n);
+        gemm_blocked(R, R, R2, 64);
+        R = R2;
+        stats->gemms++;
+        if ((k >> b) & 1) {
+            Matrix RA(A.n, A.n);
+            gemm_blocked(R, A, RA, 64);
+            R = RA;
+            stats->gemms++;
+        }
+    }
+    return R;
+}
+
+// One LU plus an n-column solve is 8/3 n^3 flops, 4/3 of a GEMM
+double gemm_equivalents(const MatrixFunctionStats& s) {
+    return s.gemms + 4.0 / 3.0 * s.solves;
+}
+
+void print_row(const char* label, double ms, const MatrixFunctionStats& s) {
+    std::cout << "  " << std::left << std::setw(28) << label
+              << std::right << std::setw(10) << std::setprecision(1) << ms << " ms"
+              << std::setw(5) << s.iterations << " it"
+              << std::setw(5) << s.gemms << " GEMM"
+              << std::setw(4) << s.solves << " LU"
+              << std::setw(8) << std::setprecision(1) << gemm_equivalents(s) << " GEMM-eq\n";
+}
+
+// Time every function at one size, all sharing one workspace
+void benchmark_size(int n, double expm_norm) {
+    Timer timer;
+    MatrixFunctionWorkspace ws;
+    Matrix F(n, n), U(n, n), H(n, n);
+
+    std::cout << "Matrix size: " << n << "×" << n << "\n";
+    std::cout << std::fixed;
+
+    // Exponential of a random matrix with ||A||_1 = expm_norm
+    Matrix A(n, n);
+    A.fill_random();
+    double s = expm_norm / norm1(A);
+    for (double& a : A.data) a *= s;
+
+    MatrixFunctionStats st_exp;
+    timer.start();
+    expm(A, F, &st_exp, &ws);
+    double t_exp = timer.elapsed_ms();
+    std::cout << "  expm (degree " << st_exp.pade_degree << ", " << st_exp.squarings
+              << " squarings)\n";
+    print_row("Scaling and squaring:", t_exp, st_exp);
+
+    // Square root of an SPD matrix
+    Matrix P = random_spd(n);
+    MatrixFunctionStats st_db, st_ns;
+    timer.start();
+    sqrtm_denman_beavers(P, F, &st_db, &ws);
+    double t_db = timer.elapsed_ms();
+    timer.start();
+    sqrtm_newton_schulz(P, F, &st_ns, &ws);
+    double t_ns = timer.elapsed_ms();
+    std::cout << "  sqrtm (SPD)\n";
+    print_row("Denman-Beavers:", t_db, st_db);
+    print_row("Newton-Schulz:", t_ns, st_ns);
+
+    // Sign and polar factor of a random matrix
+    MatrixFunctionStats st_sign, st_polar;
+    timer.start();
+    matrix_sign(A, F, &st_sign, &ws);
+    double t_sign = timer.elapsed_ms();
+    timer.start();
+    polar_decomposition(A, U, H, &st_polar, &ws);
+    double t_polar = timer.elapsed_ms();
+    std::cout << "  sign / polar (Newton, Newton-Schulz finish)\n";
+    print_row("Sign:", t_sign, st_sign);
+    print_row("Polar:", t_polar, st_polar);
+
+    // Powers and a degree-16 polynomial of a matrix with ||A||_1 = 1
+    Matrix B = A;
+    s = 1.0 / norm1(B);
+    for (double& b : B.data) b *= s;
+    const int k = 100;
+    MatrixFunctionStats st_alloc, st_pow, st_h, st_ps, st_vec;
+    timer.start();
+    Matrix R = power_allocating(B, k, &st_alloc);
+    double t_alloc = timer.elapsed_ms();
+    timer.start();
+    matrix_power(B, k, F, &st_pow, &ws);
+    double t_pow = timer.elapsed_ms();
+    std::vector<double> c(17, 1.0), x(n, 1.0), y;
+    timer.start();
+    polynomial_horner(B, c, F, &st_h, &ws);
+    double t_h = timer.elapsed_ms();
+    timer.start();
+    polynomial_paterson_stockmeyer(B, c, F, &st_ps, &ws);
+    double t_ps = timer.elapsed_ms();
+    timer.start();
+    matrix_power_vector(B, k, x, y, &st_vec, &ws);
+    double t_vec = timer.elapsed_ms();
+    std::cout << "  A^" << k << " and degree-16 polynomial\n";
+    print_row("A^k, new Matrix per GEMM:", t_alloc, st_alloc);
+    print_row("A^k, workspace:", t_pow, st_pow);
+    print_row("p(A), Horner:", t_h, st_h);
+    print_row("p(A), Paterson-Stockmeyer:", t_ps, st_ps);
+    print_row("A^k x (mat-vecs):", t_vec, st_vec);
+    std::cout << "\n";
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "================================================================\n";
+    std::cout << "MATRIX FUNCTION BENCHMARK\n";
+    std::cout << "exp, sqrt, sign and polar by GEMM count and wall time\n";
+    std::cout << "================================================================\n\n";
+
+    std::vector<int> sizes = {128, 256, 512};
+    double expm_norm = 20.0;
+
+    // Usage: ./matrix_functions_bench [n] [||A||_1 for expm]
+    if (argc > 1) sizes = {atoi(argv[1])};
+    if (argc > 2) expm_norm = atof(argv[2]);
+
+    for (int n : sizes) {
+        benchmark_size(n, expm_norm);
+    }
+
+    std::cout << "What to look for:\n";
+    std::cout << "  • GEMM-eq counts each LU + solve as 4/3 GEMM; wall time should\n";
+    std::cout << "    track it, since every kernel is gemm_blocked or the blocked LU\n";
+    std::cout << "  • expm: 6 GEMMs and one solve for the degree-13 Padé, then one\n";
+    std::cout << "    GEMM per squaring (squarings grow with log2 ||A||_1)\n";
+    std::cout << "  • Newton-Schulz trades inverses for GEMMs: more iterations,\n";
+    std::cout << "    no LU, and it only converges when ||I - A/c|| < 1\n";
+    std::cout << "  • Sign and polar spend their inverses early, then finish with\n";
+    std::cout << "    GEMM-only steps\n";
+    std::cout << "  • Powers and polynomials ping-pong between workspace buffers;\n";
+    std::cout << "    Paterson-Stockmeyer needs about 2 sqrt(d) GEMMs, Horner d - 1\n";
+    std::cout << "  • A^k x by k mat-vecs costs 2kn^2 flops; forming A^k first would\n";
+    std::cout << "    cost 8 GEMMs (k = 100) before the final product\n";
+    std::cout << "Usage: " << argv[0] << " [n] [expm_norm]\n";
+
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include "matrix_functions.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+#include "../../chapter3/lu/lu.h"
+#include <algorithm>
+#include <cmath>
+
+// Block size handed to gemm_blocked and lu_blocked
+static const int kGemmBlock = 64;
+
+// Workspace slot reserved for the LU factors in invert()
+static const int kLuSlot = 0;
+
+Matrix& MatrixFunctionWorkspace::get(int k, int n) {
+    while (static_cast<int>(buffers.size()) <= k) {
+        buffers.emplace_back(0, 0);
+    }
+    Matrix& B = buffers[k];
+    if (B.m != n || B.n != n) {
+        B = Matrix(n, n);
+        allocations++;
+    }
+    return B;
+}
+
+void multiply(const Matrix& A, const Matrix& B, Matrix& C, MatrixFunctionStats* stats) {
+    std::fill(C.data.begin(), C.data.end(), 0.0);
+    gemm_blocked(A, B, C, kGemmBlock);
+    if (stats) stats->gemms++;
+}
+
+bool invert(const Matrix& X, Matrix& Xinv, double& log_abs_det,
+            MatrixFunctionWorkspace& ws, MatrixFunctionStats* stats) {
+    Matrix& LU = ws.get(kLuSlot, X.n);
+    LU.data = X.data;
+    if (stats) stats->solves++;
+    if (!lu_blocked(LU, ws.piv, kGemmBlock)) return false;
+    log_abs_det = lu_log_abs_det(LU);
+    set_identity(Xinv);
+    lu_solve(LU, ws.piv, Xinv);
+    return true;
+}
+
+double norm1(const Matrix& A) {
+    std::vector<double> col_sum(A.n, 0.0);
+    for (int i = 0; i < A.m; i++) {
+        const double* a_row = &A(i, 0);
+        for (int j = 0; j < A.n; j++) col_sum[j] += std::abs(a_row[j]);
+    }
+    return A.n > 0 ? *std::max_element(col_sum.begin(), col_sum.end()) : 0.0;
+}
+
+double distance_to_identity(const Matrix& A) {
+    std::vector<double> col_sum(A.n, 0.0);
+    for (int i = 0; i < A.m; i++) {
+        const double* a_row = &A(i, 0);
+        for (int j = 0; j < A.n; j++) {
+            col_sum[j] += std::abs(a_row[j] - (i == j ? 1.0 : 0.0));
+        }
+    }
+    return A.n > 0 ? *std::max_element(col_sum.begin(), col_sum.end()) : 0.0;
+}
+
+void set_identity(Matrix& A) {
+    std::fill(A.data.begin(), A.data.end(), 0.0);
+    for (int i = 0; i < std::min(A.m, A.n); i++) A(i, i) = 1.0;
+}
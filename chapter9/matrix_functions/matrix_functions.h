@@ -0,0 +1,145 @@
+#ifndef MATRIX_FUNCTIONS_H
+#define MATRIX_FUNCTIONS_H
+
+#include <deque>
+#include <vector>
+#include "../../chapter1/src/matrix_utils.h"
+
+// Matrix functions by GEMM-heavy iterations
+// Golub & Van Loan Chapter 9; Higham, "Functions of Matrices" (2008)
+//
+// Every product goes through gemm_blocked, and every inverse or solve goes
+// through the blocked LU in chapter3/lu. The stats count both so the
+// algorithms can be compared by GEMM count as well as wall time.
+
+// Work done by one call
+struct MatrixFunctionStats {
+    int gemms = 0;        // n×n matrix products
+    int solves = 0;       // LU factorizations, each followed by an n-column solve
+    int iterations = 0;   // Newton / Denman-Beavers / Newton-Schulz steps
+    int pade_degree = 0;  // expm: degree m of the Padé approximant
+    int squarings = 0;    // expm: s in exp(A) = r_m(A / 2^s)^(2^s)
+    int matvecs = 0;      // matrix_power_vector: n×n matrix-vector products
+};
+
+// Reusable n×n buffers. Slot 0 holds the LU factors used by invert(); each
+// routine uses fixed slots after it, so passing the same workspace to repeated
+// calls of the same size allocates nothing after the first call. Without one,
+// each call makes its own.
+struct MatrixFunctionWorkspace {
+    std::deque<Matrix> buffers;   // deque: growing keeps earlier references valid
+    std::vector<int> piv;
+    int allocations = 0;   // buffers created so far
+
+    // Buffer k resized to n×n (contents unspecified)
+    Matrix& get(int k, int n);
+};
+
+// ============================================================================
+// Matrix exponential: scaling and squaring with Padé approximation
+// (Higham 2005, Algorithm 10.20 in "Functions of Matrices"; GVL 9.3.1)
+//
+// The degree m in {3, 5, 7, 9, 13} is the smallest whose backward error
+// bound theta_m covers ||A||_1; beyond theta_13, A is scaled by 2^-s.
+// The numerator and denominator share the even powers of A, evaluated
+// Paterson-Stockmeyer style: degree 13 costs 6 GEMMs plus one solve,
+// followed by s squarings.
+//
+// Returns false if A has a NaN or Inf entry, V - U is singular, or the
+// result is not finite (exp(A) overflows); E is then unspecified.
+// ============================================================================
+bool expm(const Matrix& A, Matrix& E, MatrixFunctionStats* stats = nullptr,
+          MatrixFunctionWorkspace* ws = nullptr);
+
+// ============================================================================
+// Principal square root, X*X = A, for A with no eigenvalues on the closed
+// negative real axis. Both return false if the iteration does not converge.
+// ============================================================================
+
+// Product-form Denman-Beavers with determinant scaling (Higham 6.29-6.30):
+//   M_{k+1} = (I + (mu^2 M + mu^-2 M^-1) / 2) / 2,    M_0 = A
+//   Y_{k+1} = mu Y (I + mu^-2 M^-1) / 2,              Y_0 = A
+// One inverse and one GEMM per step; M -> I and Y -> A^(1/2).
+bool sqrtm_denman_beavers(const Matrix& A, Matrix& X, MatrixFunctionStats* stats = nullptr,
+                          MatrixFunctionWorkspace* ws = nullptr);
+
+// Coupled Newton-Schulz (inverse free), Y_0 = A / c, Z_0 = I, c = ||A||_F:
+//   T = (3I - Z Y) / 2,   Y = Y T,   Z = T Z          (3 GEMMs per step)
+// Y -> (A/c)^(1/2). Converges when ||I - A/c|| < 1, e.g. for SPD A.
+bool sqrtm_newton_schulz(const Matrix& A, Matrix& X, MatrixFunctionStats* stats = nullptr,
+                         MatrixFunctionWorkspace* ws = nullptr);
+
+// ============================================================================
+// Sign and polar decomposition: scaled Newton until the iterate is close,
+// then a Newton-Schulz finish that needs GEMMs only
+// ============================================================================
+
+// sign(A) for A with no purely imaginary eigenvalues:
+//   Newton:         X = (mu X + mu^-1 X^-1) / 2,  mu = |det X|^(-1/n)
+//   Newton-Schulz:  X = X (3I - X^2) / 2          (once ||I - X^2||_1 < 1)
+bool matrix_sign(const Matrix& A, Matrix& S, MatrixFunctionStats* stats = nullptr,
+                 MatrixFunctionWorkspace* ws = nullptr);
+
+// A = U * H for square nonsingular A, U orthogonal, H symmetric positive definite:
+//   Newton:         X = (mu X + mu^-1 X^-T) / 2
+//   Newton-Schulz:  X = X (3I - X^T X) / 2
+// then H = U^T A, symmetrized.
+bool polar_decomposition(const Matrix& A, Matrix& U, Matrix& H,
+                         MatrixFunctionStats* stats = nullptr,
+                         MatrixFunctionWorkspace* ws = nullptr);
+
+// ============================================================================
+// Powers and polynomials (power_poly.cpp). All work buffers come from the
+// workspace and iterates ping-pong between them by pointer swap, so no
+// Matrix is allocated per product.
+// ============================================================================
+
+// P = A^k, k >= 0, by left-to-right binary powering: one squaring per bit
+// after the leading one and one product per further set bit. Two buffers.
+void matrix_power(const Matrix& A, int k, Matrix& P, MatrixFunctionStats* stats = nullptr,
+                  MatrixFunctionWorkspace* ws = nullptr);
+
+// y = A^k x. Uses k matrix-vector products (2kn^2 flops) unless binary
+// powering plus one product is cheaper, which needs k > n log2 k or so.
+void matrix_power_vector(const Matrix& A, int k, const std::vector<double>& x,
+                         std::vector<double>& y, MatrixFunctionStats* stats = nullptr,
+                         MatrixFunctionWorkspace* ws = nullptr);
+
+// P = c[0] I + c[1] A + ... + c[d] A^d
+//
+// Horner: P = (...(c[d] A + c[d-1] I) A + ...) + c[0] I, d - 1 GEMMs, two
+// buffers.
+void polynomial_horner(const Matrix& A, const std::vector<double>& c, Matrix& P,
+                       MatrixFunctionStats* stats = nullptr,
+                       MatrixFunctionWorkspace* ws = nullptr);
+
+// Paterson-Stockmeyer (Higham 4.2, GVL 9.2.4): with s ~ sqrt(d) and
+// B_j = sum_{i<s} c[js+i] A^i, Horner in A^s over the blocks,
+//   P = (...(B_r A^s + B_{r-1}) A^s + ...) + B_0,    r = floor(d / s)
+// about 2 sqrt(d) GEMMs; A^2..A^s take s - 1 buffers besides the two
+// ping-pong buffers.
+void polynomial_paterson_stockmeyer(const Matrix& A, const std::vector<double>& c, Matrix& P,
+                                    MatrixFunctionStats* stats = nullptr,
+                                    MatrixFunctionWorkspace* ws = nullptr);
+
+// ============================================================================
+// Building blocks (matrix_functions.cpp)
+// ============================================================================
+
+// C = A * B with gemm_blocked (C is overwritten), counted in stats
+void multiply(const Matrix& A, const Matrix& B, Matrix& C, MatrixFunctionStats* stats);
+
+// Xinv = X^-1 through the workspace LU; log|det X| in log_abs_det.
+// Returns false if X is exactly singular.
+bool invert(const Matrix& X, Matrix& Xinv, double& log_abs_det,
+            MatrixFunctionWorkspace& ws, MatrixFunctionStats* stats);
+
+// ||A||_1 (max column sum)
+double norm1(const Matrix& A);
+
+// ||A - I||_1
+double distance_to_identity(const Matrix& A);
+
+void set_identity(Matrix& A);
+
+#endif // MATRIX_FUNCTIONS_H
@@ -0,0 +1,174 @@
+#include "matrix_functions.h"
+#include "../../chapter1/row_v_col/gaxpy.h"
+#include <cmath>
+#include <utility>
+
+// Workspace slots (0 is the LU slot); the powers A^2..A^s of
+// Paterson-Stockmeyer start at kPow
+enum { kR = 1, kTmp, kPow };
+
+// Y += c * X
+static void add_scaled(Matrix& Y, double c, const Matrix& X) {
+    double* y = Y.data.data();
+    const double* x = X.data.data();
+    for (size_t i = 0; i < Y.data.size(); i++) y[i] += c * x[i];
+}
+
+static void add_identity(Matrix& Y, double c) {
+    for (int i = 0; i < Y.n; i++) Y(i, i) += c;
+}
+
+// GEMMs of binary powering: floor(log2 k) squarings, popcount(k) - 1 products
+static int power_gemms(int k) {
+    int squarings = 0, bits = 0;
+    for (int b = k; b > 1; b >>= 1) squarings++;
+    for (int b = k; b > 0; b >>= 1) bits += b & 1;
+    return squarings + bits - 1;
+}
+
+// ============================================================================
+// Left-to-right binary powering: R = A, then for each bit below the
+// leading one R = R^2 and, if the bit is set, R = R A. R and tmp swap
+// after every product.
+// ============================================================================
+void matrix_power(const Matrix& A, int k, Matrix& P, MatrixFunctionStats* stats,
+                  MatrixFunctionWorkspace* ws) {
+    const int n = A.n;
+    MatrixFunctionWorkspace local;
+    if (!ws) ws = &local;
+    if (P.m != n || P.n != n) P = Matrix(n, n);
+    if (k == 0) {
+        set_identity(P);
+        return;
+    }
+
+    Matrix* R = &ws->get(kR, n);
+    Matrix* tmp = &ws->get(kTmp, n);
+    R->data = A.data;
+    int top = 0;
+    while ((k >> (top + 1)) > 0) top++;
+    for (int b = top - 1; b >= 0; b--) {
+        multiply(*R, *R, *tmp, stats);
+        std::swap(R, tmp);
+        if ((k >> b) & 1) {
+            multiply(*R, A, *tmp, stats);
+            std::swap(R, tmp);
+        }
+    }
+    P.data = R->data;
+}
+
+// ============================================================================
+// A^k x: k matrix-vector products cost 2kn^2, binary powering costs
+// 2n^3 per GEMM; take the cheaper one
+// ============================================================================
+void matrix_power_vector(const Matrix& A, int k, const std::vector<double>& x,
+                         std::vector<double>& y, MatrixFunctionStats* stats,
+                         MatrixFunctionWorkspace* ws) {
+    const int n = A.n;
+    MatrixFunctionWorkspace local;
+    if (!ws) ws = &local;
+
+    std::vector<double> t(n);
+    if (k == 0 || static_cast<double>(k) <= static_cast<double>(power_gemms(k)) * n) {
+        y = x;
+        for (int i = 0; i < k; i++) {
+            std::fill(t.begin(), t.end(), 0.0);
+            gaxpy_row_oriented(A, y, t);
+            std::swap(y, t);
+        }
+        if (stats) stats->matvecs += k;
+        return;
+    }
+
+    Matrix& P = ws->get(kPow, n);
+    matrix_power(A, k, P, stats, ws);
+    gaxpy_row_oriented(P, x, t);
+    y = std::move(t);
+    if (stats) stats->matvecs++;
+}
+
+// ============================================================================
+// Horner: R = c[d] A + c[d-1] I, then R = R A + c[j] I for j = d-2 .. 0
+// ============================================================================
+void polynomial_horner(const Matrix& A, const std::vector<double>& c, Matrix& P,
+                       MatrixFunctionStats* stats, MatrixFunctionWorkspace* ws) {
+    const int n = A.n;
+    const int d = static_cast<int>(c.size()) - 1;
+    MatrixFunctionWorkspace local;
+    if (!ws) ws = &local;
+    if (P.m != n || P.n != n) P = Matrix(n, n);
+    if (d <= 0) {
+        set_identity(P);
+        for (double& p : P.data) p *= (d == 0) ? c[0] : 0.0;
+        return;
+    }
+
+    Matrix* R = &ws->get(kR, n);
+    Matrix* tmp = &ws->get(kTmp, n);
+    for (size_t i = 0; i < A.data.size(); i++) R->data[i] = c[d] * A.data[i];
+    add_identity(*R, c[d - 1]);
+    for (int j = d - 2; j >= 0; j--) {
+        multiply(*R, A, *tmp, stats);
+        std::swap(R, tmp);
+        add_identity(*R, c[j]);
+    }
+    P.data = R->data;
+}
+
+// ============================================================================
+// Paterson-Stockmeyer
+//
+// pow[i] = A^i for i = 1..s (s - 1 GEMMs), then Horner in A^s over the
+// blocks B_j (r GEMMs). When s divides d the top block is c[d] I, so the
+// first product is just a scaling of A^s.
+// ============================================================================
+void polynomial_paterson_stockmeyer(const Matrix& A, const std::vector<double>& c, Matrix& P,
+                                    MatrixFunctionStats* stats, MatrixFunctionWorkspace* ws) {
+    const int n = A.n;
+    const int d = static_cast<int>(c.size()) - 1;
+    if (d <= 2) {
+        polynomial_horner(A, c, P, stats, ws);
+        return;
+    }
+    MatrixFunctionWorkspace local;
+    if (!ws) ws = &local;
+    if (P.m != n || P.n != n) P = Matrix(n, n);
+
+    const int s = std::max(2, static_cast<int>(std::lround(std::sqrt(static_cast<double>(d)))));
+    const int r = d / s;
+
+    std::vector<const Matrix*> pow(s + 1, &A);
+    for (int i = 2; i <= s; i++) {
+        Matrix& Ai = ws->get(kPow + i - 2, n);
+        multiply(*pow[i - 1], A, Ai, stats);
+        pow[i] = &Ai;
+    }
+    const Matrix& As = *pow[s];
+
+    // Y += B_j = sum_{i < s, js + i <= d} c[js + i] A^i
+    auto add_block = [&](Matrix& Y, int j) {
+        const int lo = j * s;
+        const int hi = std::min(d, lo + s - 1);
+        for (int i = 1; i <= hi - lo; i++) add_scaled(Y, c[lo + i], *pow[i]);
+        add_identity(Y, c[lo]);
+    };
+
+    Matrix* R = &ws->get(kR, n);
+    Matrix* tmp = &ws->get(kTmp, n);
+    int j = r;
+    if (r * s == d) {
+        for (size_t i = 0; i < As.data.size(); i++) R->data[i] = c[d] * As.data[i];
+        add_block(*R, r - 1);
+        j = r - 1;
+    } else {
+        std::fill(R->data.begin(), R->data.end(), 0.0);
+        add_block(*R, r);
+    }
+    for (j = j - 1; j >= 0; j--) {
+        multiply(*R, As, *tmp, stats);
+        std::swap(R, tmp);
+        add_block(*R, j);
+    }
+    P.data = R->data;
+}
@@ -0,0 +1,155 @@
+#include "matrix_functions.h"
+#include <cmath>
+#include <limits>
+#include <utility>
+
+static const int kMaxIterations = 100;
+
+// Newton steps stop being scaled once the relative change drops below this
+static const double kScalingOff = 1e-2;
+
+// Newton hands over to Newton-Schulz once the relative change drops below
+// kSwitch; Newton-Schulz is only kept while its residual is below
+// kSchulzRadius (it converges for residuals below 1, slowly near 1)
+static const double kSwitch = 0.1;
+static const double kSchulzRadius = 0.5;
+
+// Workspace slots (0 is the LU slot)
+enum { kX = 1, kInv, kX2, kTmp, kXt };
+
+// B = A^T (B already A.n × A.m)
+static void transpose_into(const Matrix& A, Matrix& B) {
+    for (int i = 0; i < A.m; i++) {
+        for (int j = 0; j < A.n; j++) B(j, i) = A(i, j);
+    }
+}
+
+// ||X_new - X||_1 / ||X_new||_1
+static double relative_change(const Matrix& X_new, const Matrix& X) {
+    std::vector<double> diff(X.n, 0.0), mag(X.n, 0.0);
+    for (int i = 0; i < X.m; i++) {
+        for (int j = 0; j < X.n; j++) {
+            diff[j] += std::abs(X_new(i, j) - X(i, j));
+            mag[j] += std::abs(X_new(i, j));
+        }
+    }
+    double d = 0.0, m = 0.0;
+    for (int j = 0; j < X.n; j++) {
+        d = std::max(d, diff[j]);
+        m = std::max(m, mag[j]);
+    }
+    return m > 0.0 ? d / m : d;
+}
+
+// ============================================================================
+// Shared driver: sign (polar = false) or orthogonal polar factor (polar = true)
+//
+// while not converged:
+//     if in the Newton-Schulz phase:
+//         G = X^2 (sign) or X^T X (polar),  r = ||I - G||_1
+//         stop if r is at tolerance or has stopped decreasing
+//         if r < kSchulzRadius: X = X (3I - G) / 2, done if r^2 is below tolerance
+//         otherwise fall back to Newton
+//     Newton: X = (mu X + mu^-1 X^-1) / 2   (X^-T for polar)
+//     switch to Newton-Schulz once ||X_new - X|| / ||X_new|| < kSwitch
+// ============================================================================
+static bool newton_schulz_iteration(const Matrix& A, bool polar, Matrix*& X,
+                                    MatrixFunctionStats* stats, MatrixFunctionWorkspace& ws) {
+    const int n = A.n;
+    const double eps = std::numeric_limits<double>::epsilon();
+    const double tol = n * eps;
+
+    X = &ws.get(kX, n);
+    Matrix* tmp = &ws.get(kTmp, n);
+    Matrix& Xinv = ws.get(kInv, n);
+    Matrix& G = ws.get(kX2, n);
+    Matrix& Xt = ws.get(kXt, n);
+    X->data = A.data;
+
+    bool scaling = true;
+    bool schulz = false;
+    double r_prev = std::numeric_limits<double>::infinity();
+
+    for (int it = 0; it < kMaxIterations; it++) {
+        if (schulz) {
+            if (polar) {
+                transpose_into(*X, Xt);
+                multiply(Xt, *X, G, stats);
+            } else {
+                multiply(*X, *X, G, stats);
+            }
+            const double r = distance_to_identity(G);
+            if (r <= tol) return true;
+            if (r >= r_prev && r < std::sqrt(eps)) return true;
+            r_prev = r;
+
+            if (r < kSchulzRadius) {
+                // G = (3I - G) / 2
+                for (double& g : G.data) g = -0.5 * g;
+                for (int i = 0; i < n; i++) G(i, i) += 1.5;
+                multiply(*X, G, *tmp, stats);
+                std::swap(X, tmp);
+                if (stats) stats->iterations++;
+                if (r * r <= tol) return true;
+                continue;
+            }
+            schulz = false;
+        }
+
+        double log_abs_det;
+        if (!invert(*X, Xinv, log_abs_det, ws, stats)) return false;
+        const double mu = scaling ? std::exp(-log_abs_det / n) : 1.0;
+        const double a = 0.5 * mu, b = 0.5 / mu;
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                (*tmp)(i, j) = a * (*X)(i, j) + b * (polar ? Xinv(j, i) : Xinv(i, j));
+            }
+        }
+        const double delta = relative_change(*tmp, *X);
+        std::swap(X, tmp);
+        if (stats) stats->iterations++;
+
+        if (delta <= tol) return true;
+        if (delta < kScalingOff) scaling = false;
+        if (delta < kSwitch) schulz = true;
+    }
+    return false;
+}
+
+bool matrix_sign(const Matrix& A, Matrix& S, MatrixFunctionStats* stats,
+                 MatrixFunctionWorkspace* ws) {
+    MatrixFunctionWorkspace local;
+    if (!ws) ws = &local;
+
+    Matrix* X = nullptr;
+    bool converged = newton_schulz_iteration(A, false, X, stats, *ws);
+    if (S.m != A.n || S.n != A.n) S = Matrix(A.n, A.n);
+    S.data = X->data;
+    return converged;
+}
+
+bool polar_decomposition(const Matrix& A, Matrix& U, Matrix& H,
+                         MatrixFunctionStats* stats, MatrixFunctionWorkspace* ws) {
+    const int n = A.n;
+    MatrixFunctionWorkspace local;
+    if (!ws) ws = &local;
+
+    Matrix* X = nullptr;
+    bool converged = newton_schulz_iteration(A, true, X, stats, *ws);
+    if (U.m != n || U.n != n) U = Matrix(n, n);
+    U.data = X->data;
+
+    // H = U^T A, symmetrized
+    Matrix& Ut = ws->get(kXt, n);
+    transpose_into(U, Ut);
+    if (H.m != n || H.n != n) H = Matrix(n, n);
+    multiply(Ut, A, H, stats);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < i; j++) {
+            double h = 0.5 * (H(i, j) + H(j, i));
+            H(i, j) = h;
+            H(j, i) = h;
+        }
+    }
+    return converged;
+}
@@ -0,0 +1,142 @@
+#include "matrix_functions.h"
+#include <cmath>
+#include <limits>
+#include <utility>
+
+static const int kMaxIterations = 100;
+
+// Stop determinant scaling once ||M - I||_1 drops below this; from here the
+// unscaled iteration converges quadratically
+static const double kScalingOff = 1e-2;
+
+// Newton-Schulz gives up once ||I - Z Y||_1 exceeds this
+static const double kDiverged = 1e6;
+
+// Workspace slots (0 is the LU slot)
+enum { kM = 1, kY, kInv, kTmp, kZ };
+
+// ============================================================================
+// DENMAN-BEAVERS (product form, determinant scaled)
+// ============================================================================
+bool sqrtm_denman_beavers(const Matrix& A, Matrix& X, MatrixFunctionStats* stats,
+                          MatrixFunctionWorkspace* ws) {
+    const int n = A.n;
+    const double eps = std::numeric_limits<double>::epsilon();
+    const double tol = n * eps;
+    MatrixFunctionWorkspace local;
+    if (!ws) ws = &local;
+
+    Matrix& M = ws->get(kM, n);
+    Matrix& Minv = ws->get(kInv, n);
+    Matrix* Y = &ws->get(kY, n);
+    Matrix* tmp = &ws->get(kTmp, n);
+    M.data = A.data;
+    Y->data = A.data;
+
+    bool scaling = true;
+    bool converged = false;
+    double r_prev = std::numeric_limits<double>::infinity();
+
+    for (int it = 0; it < kMaxIterations && !converged; it++) {
+        double log_abs_det;
+        if (!invert(M, Minv, log_abs_det, *ws, stats)) return false;
+        const double mu = scaling ? std::exp(-log_abs_det / (2.0 * n)) : 1.0;
+
+        // Y = (mu/2) Y + 1/(2 mu) Y M^-1
+        multiply(*Y, Minv, *tmp, stats);
+        for (size_t i = 0; i < Y->data.size(); i++) {
+            tmp->data[i] = 0.5 * mu * Y->data[i] + 0.5 / mu * tmp->data[i];
+        }
+        std::swap(Y, tmp);
+
+        // M = I/2 + (mu^2 M + mu^-2 M^-1) / 4
+        const double a = 0.25 * mu * mu, b = 0.25 / (mu * mu);
+        for (size_t i = 0; i < M.data.size(); i++) {
+            M.data[i] = a * M.data[i] + b * Minv.data[i];
+        }
+        for (int i = 0; i < n; i++) M(i, i) += 0.5;
+
+        if (stats) stats->iterations++;
+        const double r = distance_to_identity(M);
+        if (r <= tol) converged = true;
+        // Quadratic convergence has hit round-off
+        if (!scaling && r >= r_prev && r < std::sqrt(eps)) converged = true;
+        if (r < kScalingOff) scaling = false;
+        r_prev = r;
+    }
+
+    if (X.m != n || X.n != n) X = Matrix(n, n);
+    X.data = Y->data;
+    return converged;
+}
+
+// ============================================================================
+// COUPLED NEWTON-SCHULZ
+//
+// The residual ||I - Z Y||_1 falls out of the first product of each step.
+// When its square is below the tolerance, the next iterate is converged:
+// Y is updated one last time and the Z product is skipped.
+// ============================================================================
+bool sqrtm_newton_schulz(const Matrix& A, Matrix& X, MatrixFunctionStats* stats,
+                         MatrixFunctionWorkspace* ws) {
+    const int n = A.n;
+    const double eps = std::numeric_limits<double>::epsilon();
+    const double tol = n * eps;
+    MatrixFunctionWorkspace local;
+    if (!ws) ws = &local;
+
+    double c = 0.0;
+    for (double a : A.data) c += a * a;
+    c = std::sqrt(c);
+    if (c == 0.0) {
+        if (X.m != n || X.n != n) X = Matrix(n, n);
+        std::fill(X.data.begin(), X.data.end(), 0.0);
+        return true;
+    }
+
+    Matrix* Y = &ws->get(kY, n);
+    Matrix* Z = &ws->get(kZ, n);
+    Matrix& T = ws->get(kM, n);
+    Matrix* tmp = &ws->get(kTmp, n);
+    for (size_t i = 0; i < A.data.size(); i++) Y->data[i] = A.data[i] / c;
+    set_identity(*Z);
+
+    bool converged = false;
+    double r_prev = std::numeric_limits<double>::infinity();
+
+    for (int it = 0; it < kMaxIterations; it++) {
+        multiply(*Z, *Y, T, stats);
+        const double r = distance_to_identity(T);
+        if (r <= tol) {
+            converged = true;
+            break;
+        }
+        // The residual need not fall monotonically in the first steps, so
+        // only a blow-up counts as divergence; late on, a rise means round-off
+        if (!(r < kDiverged)) break;
+        if (r >= r_prev && r < std::sqrt(eps)) {
+            converged = true;
+            break;
+        }
+        r_prev = r;
+
+        // T = (3I - Z Y) / 2
+        for (double& t : T.data) t = -0.5 * t;
+        for (int i = 0; i < n; i++) T(i, i) += 1.5;
+
+        multiply(*Y, T, *tmp, stats);
+        std::swap(Y, tmp);
+        if (stats) stats->iterations++;
+        if (r * r <= tol) {
+            converged = true;
+            break;
+        }
+        multiply(T, *Z, *tmp, stats);
+        std::swap(Z, tmp);
+    }
+
+    if (X.m != n || X.n != n) X = Matrix(n, n);
+    const double root_c = std::sqrt(c);
+    for (size_t i = 0; i < X.data.size(); i++) X.data[i] = root_c * Y->data[i];
+    return converged;
+}
@@ -0,0 +1,426 @@
+#include <iostream>
+#include <cmath>
+#include <limits>
+#include <string>
+#include "matrix_functions.h"
+#include "../../chapter1/blocked_game/blocked_gemm.h"
+
+Matrix identity(int n) {
+    Matrix I(n, n);
+    for (int i = 0; i < n; i++) I(i, i) = 1.0;
+    return I;
+}
+
+Matrix product(const Matrix& A, const Matrix& B) {
+    Matrix C(A.m, B.n);
+    gemm_ikj(A, B, C);
+    return C;
+}
+
+double max_abs(const Matrix& A) {
+    double m = 0.0;
+    for (double a : A.data) m = std::max(m, std::abs(a));
+    return m;
+}
+
+// Random matrix scaled to ||A||_1 = target
+Matrix random_with_norm(int n, double target) {
+    Matrix A(n, n);
+    A.fill_random();
+    double s = target / norm1(A);
+    for (double& a : A.data) a *= s;
+    return A;
+}
+
+bool test_expm_known() {
+    std::cout << "Testing expm on known exponentials... ";
+
+    // Diagonal
+    Matrix D(3, 3);
+    D(0, 0) = -1.0; D(1, 1) = 0.5; D(2, 2) = 4.0;
+    Matrix E(3, 3);
+    expm(D, E);
+    for (int i = 0; i < 3; i++) {
+        if (std::abs(E(i, i) - std::exp(D(i, i))) > 1e-14 * std::exp(D(i, i))) {
+            std::cout << "FAILED (diagonal)\n";
+            return false;
+        }
+    }
+
+    // Nilpotent: exp([0 1; 0 0]) = [1 1; 0 1]
+    Matrix N(2, 2);
+    N(0, 1) = 1.0;
+    expm(N, E);
+    if (std::abs(E(0, 0) - 1) > 1e-15 || std::abs(E(0, 1) - 1) > 1e-15 ||
+        std::abs(E(1, 0)) > 1e-15 || std::abs(E(1, 1) - 1) > 1e-15) {
+        std::cout << "FAILED (nilpotent)\n";
+        return false;
+    }
+
+    // Rotation generator, large enough to need squaring
+    const double theta = 10.0;
+    Matrix G(2, 2);
+    G(0, 1) = -theta;
+    G(1, 0) = theta;
+    MatrixFunctionStats stats;
+    expm(G, E, &stats);
+    if (stats.squarings == 0 ||
+        std::abs(E(0, 0) - std::cos(theta)) > 1e-13 || std::abs(E(0, 1) + std::sin(theta)) > 1e-13 ||
+        std::abs(E(1, 0) - std::sin(theta)) > 1e-13 || std::abs(E(1, 1) - std::cos(theta)) > 1e-13) {
+        std::cout << "FAILED (rotation)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+// NaN or Inf input and an exponential beyond the range of double are
+// reported instead of returned as a matrix of Inf and NaN
+bool test_expm_failure() {
+    std::cout << "Testing expm failure reporting... ";
+
+    Matrix A(3, 3), E(3, 3);
+    A(0, 1) = 2.0;
+    A(2, 2) = -1.0;
+    if (!expm(A, E)) {
+        std::cout << "FAILED (finite input refused)\n";
+        return false;
+    }
+
+    const double bad[] = {std::numeric_limits<double>::quiet_NaN(),
+                          std::numeric_limits<double>::infinity()};
+    for (double v : bad) {
+        Matrix B = A;
+        B(1, 0) = v;
+        if (expm(B, E)) {
+            std::cout << "FAILED (" << v << " entry accepted)\n";
+            return false;
+        }
+    }
+
+    // exp(1000) overflows
+    Matrix D(2, 2);
+    D(0, 0) = 1000.0;
+    if (expm(D, E)) {
+        std::cout << "FAILED (overflow accepted)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_expm_identities() {
+    std::cout << "Testing expm degrees and identities... ";
+
+    // One norm per Padé degree, plus one that needs scaling
+    const double norms[] = {0.01, 0.2, 0.9, 2.0, 5.0, 40.0};
+    const int degrees[] = {3, 5, 7, 9, 13, 13};
+    const int gemms[] = {2, 3, 4, 5, 6, 6};
+    const int n = 40;
+
+    for (int k = 0; k < 6; k++) {
+        Matrix A = random_with_norm(n, norms[k]);
+        Matrix minus_A = A;
+        for (double& a : minus_A.data) a = -a;
+        Matrix two_A = A;
+        for (double& a : two_A.data) a *= 2.0;
+
+        MatrixFunctionStats stats;
+        Matrix E(n, n), E_minus(n, n), E_two(n, n);
+        expm(A, E, &stats);
+        expm(minus_A, E_minus);
+        expm(two_A, E_two);
+
+        if (stats.pade_degree != degrees[k] || stats.gemms != gemms[k] + stats.squarings ||
+            stats.solves != 1) {
+            std::cout << "FAILED (||A||=" << norms[k] << ", degree " << stats.pade_degree
+                      << ", " << stats.gemms << " GEMMs)\n";
+            return false;
+        }
+        // exp(A) exp(-A) = I and exp(2A) = exp(A)^2
+        double scale = max_abs(E) * max_abs(E_minus);
+        if (max_abs_diff(product(E, E_minus), identity(n)) > 1e-12 * n * scale) {
+            std::cout << "FAILED (||A||=" << norms[k] << ", exp(A)exp(-A) != I)\n";
+            return false;
+        }
+        if (max_abs_diff(product(E, E), E_two) > 1e-12 * n * max_abs(E_two)) {
+            std::cout << "FAILED (||A||=" << norms[k] << ", exp(2A) != exp(A)^2)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_sqrtm() {
+    std::cout << "Testing square roots (Denman-Beavers, Newton-Schulz)... ";
+
+    for (int n : {1, 5, 60}) {
+        Matrix A = random_spd(n);
+        double tol = 1e-12 * n * max_abs(A);
+
+        Matrix X_db(n, n), X_ns(n, n);
+        if (!sqrtm_denman_beavers(A, X_db) || !sqrtm_newton_schulz(A, X_ns)) {
+            std::cout << "FAILED (n=" << n << ", no convergence)\n";
+            return false;
+        }
+        if (max_abs_diff(product(X_db, X_db), A) > tol ||
+            max_abs_diff(product(X_ns, X_ns), A) > tol) {
+            std::cout << "FAILED (n=" << n << ", X*X != A)\n";
+            return false;
+        }
+        if (max_abs_diff(X_db, X_ns) > 1e-10 * max_abs(X_db)) {
+            std::cout << "FAILED (n=" << n << ", methods disagree)\n";
+            return false;
+        }
+    }
+
+    // Nonsymmetric with positive real eigenvalues: Denman-Beavers only
+    const int n = 30;
+    Matrix A(n, n);
+    A.fill_random();
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < i; j++) A(i, j) *= 0.1;
+        A(i, i) = 1.0 + i;
+    }
+    Matrix X(n, n);
+    if (!sqrtm_denman_beavers(A, X) ||
+        max_abs_diff(product(X, X), A) > 1e-11 * n * max_abs(A)) {
+        std::cout << "FAILED (nonsymmetric)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_sign() {
+    std::cout << "Testing matrix sign... ";
+
+    // A = V diag(d) V^-1 with d of both signs: sign(A) = V diag(sign d) V^-1
+    const int n = 50;
+    Matrix V(n, n);
+    V.fill_random();
+    for (int i = 0; i < n; i++) V(i, i) += 4.0;
+    Matrix Vinv(n, n);
+    MatrixFunctionWorkspace ws;
+    double log_abs_det;
+    invert(V, Vinv, log_abs_det, ws, nullptr);
+
+    Matrix D(n, n), Dsign(n, n);
+    for (int i = 0; i < n; i++) {
+        double d = (i % 3 == 0 ? -1.0 : 1.0) * (0.1 + i);
+        D(i, i) = d;
+        Dsign(i, i) = d > 0 ? 1.0 : -1.0;
+    }
+    Matrix A = product(product(V, D), Vinv);
+    Matrix S_expected = product(product(V, Dsign), Vinv);
+
+    MatrixFunctionStats stats;
+    Matrix S(n, n);
+    if (!matrix_sign(A, S, &stats, &ws)) {
+        std::cout << "FAILED (no convergence)\n";
+        return false;
+    }
+    if (max_abs_diff(S, S_expected) > 1e-10 * max_abs(S_expected)) {
+        std::cout << "FAILED (sign(A) wrong)\n";
+        return false;
+    }
+    if (max_abs_diff(product(S, S), identity(n)) > 1e-10 * max_abs(S) * max_abs(S)) {
+        std::cout << "FAILED (S^2 != I)\n";
+        return false;
+    }
+    if (stats.gemms == 0) {
+        std::cout << "FAILED (Newton-Schulz finish never used)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_polar() {
+    std::cout << "Testing polar decomposition... ";
+
+    for (int n : {1, 7, 80}) {
+        Matrix A(n, n);
+        A.fill_random();
+        Matrix U(n, n), H(n, n);
+        if (!polar_decomposition(A, U, H)) {
+            std::cout << "FAILED (n=" << n << ", no convergence)\n";
+            return false;
+        }
+        if (max_abs_diff(product(U.transpose(), U), identity(n)) > 1e-12 * n) {
+            std::cout << "FAILED (n=" << n << ", U not orthogonal)\n";
+            return false;
+        }
+        if (max_abs_diff(product(U, H), A) > 1e-12 * n) {
+            std::cout << "FAILED (n=" << n << ", U*H != A)\n";
+            return false;
+        }
+        // H positive definite: x^T H x > 0 for a few random x
+        for (int trial = 0; trial < 5; trial++) {
+            Matrix x(n, 1);
+            x.fill_random();
+            Matrix Hx = product(H, x);
+            double q = 0.0;
+            for (int i = 0; i < n; i++) q += x(i, 0) * Hx(i, 0);
+            if (q <= 0.0) {
+                std::cout << "FAILED (n=" << n << ", H not positive definite)\n";
+                return false;
+            }
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_power() {
+    std::cout << "Testing matrix powers and A^k x... ";
+
+    const int n = 20;
+    Matrix A = random_with_norm(n, 1.0);
+    MatrixFunctionWorkspace ws;
+    Matrix P(n, n);
+
+    // Against repeated products; GEMM count of binary powering
+    Matrix ref = identity(n);
+    const int expected_gemms[] = {0, 0, 1, 2, 2, 3, 3, 4};
+    for (int k = 0; k <= 40; k++) {
+        MatrixFunctionStats st;
+        matrix_power(A, k, P, &st, &ws);
+        if (max_abs_diff(P, ref) > 1e-13 || (k < 8 && st.gemms != expected_gemms[k])) {
+            std::cout << "FAILED (k=" << k << ", " << st.gemms << " GEMMs)\n";
+            return false;
+        }
+        ref = product(ref, A);
+    }
+
+    // A^k x: mat-vecs for small k, binary powering once k exceeds ~n log2 k
+    Matrix x(n, 1);
+    x.fill_random();
+    for (int k : {5, 300}) {
+        MatrixFunctionStats st;
+        std::vector<double> y;
+        matrix_power_vector(A, k, x.data, y, &st, &ws);
+        matrix_power(A, k, P, nullptr, &ws);
+        Matrix y_ref = product(P, x);
+        double diff = 0.0;
+        for (int i = 0; i < n; i++) diff = std::max(diff, std::abs(y[i] - y_ref.data[i]));
+        const bool matvec_route = (k == 5);
+        if (diff > 1e-13 * std::max(1.0, max_abs(y_ref)) ||
+            (matvec_route && (st.gemms != 0 || st.matvecs != k)) ||
+            (!matvec_route && (st.gemms == 0 || st.matvecs != 1))) {
+            std::cout << "FAILED (A^" << k << " x: " << st.gemms << " GEMMs, "
+                      << st.matvecs << " mat-vecs)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_polynomial() {
+    std::cout << "Testing Horner and Paterson-Stockmeyer... ";
+
+    const int n = 25;
+    Matrix A = random_with_norm(n, 1.5);
+    MatrixFunctionWorkspace ws;
+    Matrix P(n, n);
+
+    for (int d : {0, 1, 2, 3, 4, 9, 12, 16, 17, 30}) {
+        std::vector<double> c(d + 1);
+        for (int j = 0; j <= d; j++) c[j] = 1.0 / (1.0 + j) * ((j % 3 == 1) ? -1.0 : 1.0);
+
+        // sum c_j A^j with explicit powers
+        Matrix ref(n, n), Aj = identity(n);
+        for (int j = 0; j <= d; j++) {
+            for (size_t i = 0; i < ref.data.size(); i++) ref.data[i] += c[j] * Aj.data[i];
+            Aj = product(Aj, A);
+        }
+        const double tol = 1e-13 * std::max(1.0, max_abs(ref));
+
+        MatrixFunctionStats st_h, st_ps;
+        polynomial_horner(A, c, P, &st_h, &ws);
+        if (max_abs_diff(P, ref) > tol || st_h.gemms != std::max(0, d - 1)) {
+            std::cout << "FAILED (Horner, degree " << d << ")\n";
+            return false;
+        }
+        polynomial_paterson_stockmeyer(A, c, P, &st_ps, &ws);
+        if (max_abs_diff(P, ref) > tol || st_ps.gemms > st_h.gemms ||
+            (d >= 16 && st_ps.gemms > 2 * std::sqrt(d))) {
+            std::cout << "FAILED (Paterson-Stockmeyer, degree " << d << ", "
+                      << st_ps.gemms << " GEMMs)\n";
+            return false;
+        }
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+bool test_workspace_reuse() {
+    std::cout << "Testing workspace reuse across calls... ";
+
+    const int n = 30;
+    Matrix A = random_spd(n);
+    Matrix F(n, n), U(n, n), H(n, n);
+    MatrixFunctionWorkspace ws;
+
+    expm(A, F, nullptr, &ws);
+    sqrtm_denman_beavers(A, F, nullptr, &ws);
+    sqrtm_newton_schulz(A, F, nullptr, &ws);
+    matrix_sign(A, F, nullptr, &ws);
+    polar_decomposition(A, U, H, nullptr, &ws);
+    matrix_power(A, 13, F, nullptr, &ws);
+    polynomial_paterson_stockmeyer(A, std::vector<double>(20, 0.5), F, nullptr, &ws);
+    int after_first = ws.allocations;
+
+    expm(A, F, nullptr, &ws);
+    sqrtm_denman_beavers(A, F, nullptr, &ws);
+    sqrtm_newton_schulz(A, F, nullptr, &ws);
+    matrix_sign(A, F, nullptr, &ws);
+    polar_decomposition(A, U, H, nullptr, &ws);
+    matrix_power(A, 13, F, nullptr, &ws);
+    polynomial_paterson_stockmeyer(A, std::vector<double>(20, 0.5), F, nullptr, &ws);
+
+    if (ws.allocations != after_first) {
+        std::cout << "FAILED (" << ws.allocations - after_first << " new buffers)\n";
+        return false;
+    }
+
+    std::cout << "PASSED ✓\n";
+    return true;
+}
+
+int main() {
+    std::cout << "==============================================\n";
+    std::cout << "Testing Matrix Functions\n";
+    std::cout << "==============================================\n\n";
+
+    bool all_passed = true;
+
+    all_passed &= test_expm_known();
+    all_passed &= test_expm_failure();
+    all_passed &= test_expm_identities();
+    all_passed &= test_sqrtm();
+    all_passed &= test_sign();
+    all_passed &= test_polar();
+    all_passed &= test_power();
+    all_passed &= test_polynomial();
+    all_passed &= test_workspace_reuse();
+
+    std::cout << "\n";
+    if (all_passed) {
+        std::cout << "✓ All tests passed!\n";
+    } else {
+        std::cout << "✗ Some tests failed!\n";
+    }
+
+    return all_passed ? 0 : 1;
+}